@@ -0,0 +1,108 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief v1(RpcHeader嵌套)与v2(固定帧头)帧格式的编解码开销对比
+ */
+#include "rpccodec.h"
+#include "rpcheader.pb.h"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// 防止编译器优化掉结果
+static size_t g_sink = 0;
+
+// v1：请求序列化到params，再序列化整个RpcHeader
+static void EncodeV1(const TheChat::RequestHeader &request, std::string *out)
+{
+    TheChat::RpcHeader rpc_header;
+    rpc_header.set_service_name("UserService");
+    rpc_header.set_method_name("Login");
+    rpc_header.set_request_id(1);
+    rpc_header.set_keep_alive(true);
+    request.SerializeToString(rpc_header.mutable_params());
+    out->assign(4, '\0');
+    rpc_header.AppendToString(out);
+    uint32_t network_length = htonl(static_cast<uint32_t>(out->size() - 4));
+    memcpy(&(*out)[0], &network_length, 4);
+}
+
+// v1：解析RpcHeader，params拷贝出来后再解析请求
+static bool DecodeV1(const std::string &frame, TheChat::RequestHeader *request)
+{
+    TheChat::RpcHeader rpc_header;
+    if (!rpc_header.ParseFromArray(frame.data() + 4, static_cast<int>(frame.size() - 4)))
+        return false;
+    return request->ParseFromString(rpc_header.params());
+}
+
+// v2：固定帧头+扩展头+请求原始字节
+static void EncodeV2(const TheChat::RequestHeader &request, std::string *out)
+{
+    TheChat::RpcMeta meta;
+    meta.set_service_name("UserService");
+    meta.set_method_name("Login");
+    FrameHeader header;
+    header.request_id = 1;
+    out->clear();
+    AppendFrame(header, &meta, &request, out);
+}
+
+// v2：解码帧头，扩展头和请求直接在接收缓冲区上解析
+static bool DecodeV2(const std::string &frame, TheChat::RequestHeader *request)
+{
+    FrameHeader header;
+    if (!DecodeFrameHeader(frame.data(), &header))
+        return false;
+    TheChat::RpcMeta meta;
+    const char *meta_data = frame.data() + kFrameHeaderSize;
+    if (!meta.ParseFromArray(meta_data, static_cast<int>(header.meta_len)))
+        return false;
+    return request->ParseFromArray(meta_data + header.meta_len, static_cast<int>(header.body_len));
+}
+
+template <typename F>
+static double NsPerOp(int iterations, F &&f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        f();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+int main()
+{
+    const size_t payload_sizes[] = {64, 1024, 64 * 1024};
+    printf("%-10s %-8s %10s %14s %14s\n", "payload", "format", "frame(B)", "encode(ns)", "decode(ns)");
+    for (size_t payload_size : payload_sizes)
+    {
+        TheChat::RequestHeader request;
+        request.set_message_id(42);
+        request.set_content(std::string(payload_size, 'x'));
+        const int iterations = payload_size >= 64 * 1024 ? 20000 : 500000;
+
+        std::string v1, v2;
+        EncodeV1(request, &v1);
+        EncodeV2(request, &v2);
+        TheChat::RequestHeader decoded;
+
+        double v1_encode = NsPerOp(iterations, [&]
+                                   { EncodeV1(request, &v1); g_sink += v1.size(); });
+        double v1_decode = NsPerOp(iterations, [&]
+                                   { g_sink += DecodeV1(v1, &decoded); });
+        double v2_encode = NsPerOp(iterations, [&]
+                                   { EncodeV2(request, &v2); g_sink += v2.size(); });
+        double v2_decode = NsPerOp(iterations, [&]
+                                   { g_sink += DecodeV2(v2, &decoded); });
+
+        printf("%-10zu %-8s %10zu %14.1f %14.1f\n", payload_size, "v1", v1.size(), v1_encode, v1_decode);
+        printf("%-10zu %-8s %10zu %14.1f %14.1f\n", payload_size, "v2", v2.size(), v2_encode, v2_decode);
+    }
+    fprintf(stderr, "sink=%zu\n", g_sink);
+    return 0;
+}
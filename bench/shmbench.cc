@@ -0,0 +1,264 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 同机两个进程之间一问一答的往返延迟：TCP回环、Unix域套接字与共享内存字节环对比
+ */
+#include "shmtransport.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// 与RpcSession读线程相同的自旋时间，只有一个CPU时不自旋
+static const auto kClientSpin = std::chrono::microseconds(std::thread::hardware_concurrency() > 1 ? 50 : 0);
+
+// socket上完整读写len字节
+static bool ReadFull(int fd, char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = recv(fd, buf, len, 0);
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool WriteFull(int fd, const char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// 字节环上完整读写len字节，spin为阻塞等待前的自旋时间：服务端与RpcProvider的IO线程一样不自旋
+static void ShmReadFull(ShmTransport &shm, char *buf, size_t len, std::chrono::microseconds spin)
+{
+    while (len > 0)
+    {
+        const auto spin_deadline = Clock::now() + spin;
+        while (shm.Readable() == 0 && Clock::now() < spin_deadline)
+        {
+        }
+        size_t n = shm.Read(buf, len);
+        if (n == 0)
+        {
+            pollfd pfd{shm.ReadableFd(), POLLIN, 0};
+            poll(&pfd, 1, -1);
+            ShmTransport::ClearFd(shm.ReadableFd());
+            continue;
+        }
+        buf += n;
+        len -= n;
+    }
+}
+
+static void ShmWriteFull(ShmTransport &shm, const char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        size_t n = shm.Write(buf, len);
+        buf += n;
+        len -= n;
+        if (len > 0)
+        {
+            pollfd pfd{shm.WritableFd(), POLLIN, 0};
+            poll(&pfd, 1, -1);
+            ShmTransport::ClearFd(shm.WritableFd());
+        }
+    }
+}
+
+struct Result
+{
+    double avg_us;
+    double p50_us;
+    double p99_us;
+    double rps;
+};
+
+// 由每次往返的耗时得到统计结果
+static Result Summarize(std::vector<double> &samples, Clock::duration total)
+{
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double v : samples)
+        sum += v;
+    Result result;
+    result.avg_us = sum / samples.size();
+    result.p50_us = samples[samples.size() / 2];
+    result.p99_us = samples[samples.size() * 99 / 100];
+    result.rps = samples.size() / std::chrono::duration<double>(total).count();
+    return result;
+}
+
+// 客户端一问一答地发送rounds次，每次消息size字节
+template <typename Send, typename Recv>
+static Result PingPong(size_t size, int rounds, Send &&send_fn, Recv &&recv_fn)
+{
+    std::string request(size, 'x');
+    std::string response(size, '\0');
+    std::vector<double> samples;
+    samples.reserve(rounds);
+    // 预热
+    for (int i = 0; i < rounds / 10; ++i)
+    {
+        send_fn(request.data(), size);
+        recv_fn(&response[0], size);
+    }
+    const auto start = Clock::now();
+    for (int i = 0; i < rounds; ++i)
+    {
+        const auto begin = Clock::now();
+        send_fn(request.data(), size);
+        recv_fn(&response[0], size);
+        samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - begin).count());
+    }
+    return Summarize(samples, Clock::now() - start);
+}
+
+// 在子进程中运行回显服务，消息数和大小与客户端约定
+template <typename Echo>
+static pid_t Spawn(Echo &&echo)
+{
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        echo();
+        _exit(0);
+    }
+    return pid;
+}
+
+static Result BenchTcp(size_t size, int rounds)
+{
+    int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    bind(listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    listen(listen_fd, 1);
+    getsockname(listen_fd, reinterpret_cast<sockaddr *>(&addr), &addr_len);
+    const int total = rounds + rounds / 10;
+    pid_t pid = Spawn([&]
+                      {
+                          int fd = accept(listen_fd, nullptr, nullptr);
+                          int on = 1;
+                          setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+                          std::string buf(size, '\0');
+                          for (int i = 0; i < total && ReadFull(fd, &buf[0], size); ++i)
+                              WriteFull(fd, buf.data(), size);
+                          close(fd); });
+    close(listen_fd);
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    Result result = PingPong(
+        size, rounds, [&](const char *data, size_t len)
+        { WriteFull(fd, data, len); },
+        [&](char *data, size_t len)
+        { ReadFull(fd, data, len); });
+    close(fd);
+    waitpid(pid, nullptr, 0);
+    return result;
+}
+
+static Result BenchUnix(size_t size, int rounds)
+{
+    int sv[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+    const int total = rounds + rounds / 10;
+    pid_t pid = Spawn([&]
+                      {
+                          close(sv[0]);
+                          std::string buf(size, '\0');
+                          for (int i = 0; i < total && ReadFull(sv[1], &buf[0], size); ++i)
+                              WriteFull(sv[1], buf.data(), size); });
+    close(sv[1]);
+    Result result = PingPong(
+        size, rounds, [&](const char *data, size_t len)
+        { WriteFull(sv[0], data, len); },
+        [&](char *data, size_t len)
+        { ReadFull(sv[0], data, len); });
+    close(sv[0]);
+    waitpid(pid, nullptr, 0);
+    return result;
+}
+
+static Result BenchShm(size_t size, int rounds)
+{
+    int sv[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+    const int total = rounds + rounds / 10;
+    // 与RpcProvider一样由服务端创建共享内存段并交给客户端
+    pid_t pid = Spawn([&]
+                      {
+                          close(sv[0]);
+                          std::unique_ptr<ShmTransport> shm = ShmTransport::Create(1024 * 1024);
+                          if (!shm || !shm->Send(sv[1]))
+                              return;
+                          std::string buf(size, '\0');
+                          for (int i = 0; i < total; ++i)
+                          {
+                              ShmReadFull(*shm, &buf[0], size, std::chrono::microseconds(0));
+                              ShmWriteFull(*shm, buf.data(), size);
+                          } });
+    close(sv[1]);
+    std::unique_ptr<ShmTransport> shm = ShmTransport::Receive(sv[0], 1000);
+    if (!shm)
+    {
+        fprintf(stderr, "shared memory setup failed\n");
+        waitpid(pid, nullptr, 0);
+        return Result{};
+    }
+    Result result = PingPong(
+        size, rounds, [&](const char *data, size_t len)
+        { ShmWriteFull(*shm, data, len); },
+        [&](char *data, size_t len)
+        { ShmReadFull(*shm, data, len, kClientSpin); });
+    close(sv[0]);
+    waitpid(pid, nullptr, 0);
+    return result;
+}
+
+int main()
+{
+    const size_t sizes[] = {64, 1024, 16 * 1024};
+    printf("%-8s %-6s %10s %10s %10s %12s\n", "size", "mode", "avg(us)", "p50(us)", "p99(us)", "rps");
+    for (size_t size : sizes)
+    {
+        const int rounds = 100000;
+        const std::pair<const char *, Result> results[] = {
+            {"tcp", BenchTcp(size, rounds)},
+            {"unix", BenchUnix(size, rounds)},
+            {"shm", BenchShm(size, rounds)}};
+        for (const auto &item : results)
+        {
+            printf("%-8zu %-6s %10.2f %10.2f %10.2f %12.0f\n", size, item.first,
+                   item.second.avg_us, item.second.p50_us, item.second.p99_us, item.second.rps);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,266 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 服务端读取路径对比：epoll+read与io_uring multishot recv，统计每次调用的服务端系统调用数和往返延迟
+ */
+#include "iouring.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+/*
+ * 客户端在conns个TCP回环连接上同时各发一个size字节的请求，再等齐所有回显，重复rounds轮，
+ * 与RpcProvider一样服务端每个请求回写一次。服务端在子进程中运行，自己统计发出的系统调用数。
+ */
+
+static bool ReadFull(int fd, char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = recv(fd, buf, len, 0);
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool WriteFull(int fd, const char *buf, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// 服务端：muduo的方式，epoll_wait后对每个可读连接read一次，按请求大小回写
+static long EchoEpoll(int listen_fd, int conns, size_t size)
+{
+    long syscalls = 0;
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    std::vector<std::string> pending(conns);
+    std::vector<int> fds;
+    for (int i = 0; i < conns; ++i)
+    {
+        int fd = accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK);
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.u32 = static_cast<uint32_t>(i);
+        epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+        fds.push_back(fd);
+    }
+    std::vector<char> chunk(64 * 1024);
+    std::vector<epoll_event> events(conns);
+    int open = conns;
+    while (open > 0)
+    {
+        int n = epoll_wait(epfd, events.data(), conns, -1);
+        ++syscalls;
+        for (int i = 0; i < n; ++i)
+        {
+            const uint32_t index = events[i].data.u32;
+            ssize_t len = read(fds[index], chunk.data(), chunk.size());
+            ++syscalls;
+            if (len <= 0)
+            {
+                epoll_ctl(epfd, EPOLL_CTL_DEL, fds[index], nullptr);
+                close(fds[index]);
+                --open;
+                continue;
+            }
+            std::string &buf = pending[index];
+            buf.append(chunk.data(), len);
+            while (buf.size() >= size)
+            {
+                WriteFull(fds[index], buf.data(), size);
+                ++syscalls;
+                buf.erase(0, size);
+            }
+        }
+    }
+    close(epfd);
+    return syscalls;
+}
+
+// 服务端：UringServer的方式，每个连接一个multishot recv，一次io_uring_enter取回所有连接的数据
+static long EchoUring(int listen_fd, int conns, size_t size)
+{
+    long syscalls = 0;
+    IoUring ring;
+    if (!ring.Init(256) || !ring.SetupBufferRing(0, 256, 16 * 1024))
+    {
+        return -1;
+    }
+    std::vector<std::string> pending(conns);
+    std::vector<int> fds;
+    for (int i = 0; i < conns; ++i)
+    {
+        int fd = accept4(listen_fd, nullptr, nullptr, SOCK_NONBLOCK);
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        IoUring::PrepMultishotRecv(ring.GetSqe(), fd, 0, static_cast<uint64_t>(i));
+        fds.push_back(fd);
+    }
+    int open = conns;
+    while (open > 0)
+    {
+        ring.SubmitAndWait(-1);
+        ++syscalls;
+        ring.ForEachCqe([&](const io_uring_cqe &cqe)
+                        {
+                            const size_t index = cqe.user_data;
+                            uint16_t buffer_id = 0;
+                            const bool has_buffer = IoUring::BufferId(cqe, &buffer_id);
+                            if (cqe.res > 0)
+                            {
+                                pending[index].append(ring.Buffer(buffer_id), cqe.res);
+                            }
+                            if (has_buffer)
+                            {
+                                ring.RecycleBuffer(buffer_id);
+                            }
+                            if (!IoUring::HasMore(cqe))
+                            {
+                                if (cqe.res > 0 || cqe.res == -ENOBUFS)
+                                {
+                                    IoUring::PrepMultishotRecv(ring.GetSqe(), fds[index], 0, index);
+                                }
+                                else
+                                {
+                                    close(fds[index]);
+                                    --open;
+                                    return;
+                                }
+                            }
+                            std::string &buf = pending[index];
+                            while (buf.size() >= size)
+                            {
+                                WriteFull(fds[index], buf.data(), size);
+                                ++syscalls;
+                                buf.erase(0, size);
+                            }
+                        });
+    }
+    return syscalls;
+}
+
+struct Result
+{
+    double syscalls_per_rpc;
+    double p50_us;
+    double p99_us;
+    double rps;
+};
+
+template <typename Echo>
+static Result Bench(int conns, size_t size, int rounds, Echo &&echo)
+{
+    int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    bind(listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    listen(listen_fd, conns);
+    getsockname(listen_fd, reinterpret_cast<sockaddr *>(&addr), &addr_len);
+    // 子进程把系统调用数写回管道
+    int report[2];
+    pipe(report);
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(report[0]);
+        long syscalls = echo(listen_fd, conns, size);
+        write(report[1], &syscalls, sizeof(syscalls));
+        _exit(0);
+    }
+    close(report[1]);
+    close(listen_fd);
+
+    std::vector<int> fds;
+    for (int i = 0; i < conns; ++i)
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        fds.push_back(fd);
+    }
+    std::string request(size, 'x');
+    std::string response(size, '\0');
+    std::vector<double> samples;
+    samples.reserve(rounds);
+    const auto start = Clock::now();
+    for (int i = 0; i < rounds; ++i)
+    {
+        const auto begin = Clock::now();
+        for (int fd : fds)
+            WriteFull(fd, request.data(), size);
+        for (int fd : fds)
+            ReadFull(fd, &response[0], size);
+        samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - begin).count());
+    }
+    const auto total = Clock::now() - start;
+    for (int fd : fds)
+        close(fd);
+    long syscalls = 0;
+    read(report[0], &syscalls, sizeof(syscalls));
+    close(report[0]);
+    waitpid(pid, nullptr, 0);
+
+    std::sort(samples.begin(), samples.end());
+    Result result;
+    result.syscalls_per_rpc = static_cast<double>(syscalls) / (static_cast<double>(rounds) * conns);
+    result.p50_us = samples[samples.size() / 2];
+    result.p99_us = samples[samples.size() * 99 / 100];
+    result.rps = static_cast<double>(rounds) * conns / std::chrono::duration<double>(total).count();
+    return result;
+}
+
+int main()
+{
+    if (!IoUring::Supported())
+    {
+        fprintf(stderr, "io_uring with multishot recv is not supported, only epoll is measured\n");
+    }
+    const int conns_list[] = {1, 16};
+    const size_t sizes[] = {64, 4096};
+    const int rounds = 20000;
+    printf("%-6s %-8s %-6s %14s %10s %10s %12s\n", "conns", "size", "mode", "syscalls/rpc", "p50(us)", "p99(us)", "rps");
+    for (int conns : conns_list)
+    {
+        for (size_t size : sizes)
+        {
+            Result epoll_result = Bench(conns, size, rounds, EchoEpoll);
+            printf("%-6d %-8zu %-6s %14.2f %10.2f %10.2f %12.0f\n", conns, size, "epoll",
+                   epoll_result.syscalls_per_rpc, epoll_result.p50_us, epoll_result.p99_us, epoll_result.rps);
+            if (IoUring::Supported())
+            {
+                Result uring_result = Bench(conns, size, rounds, EchoUring);
+                printf("%-6d %-8zu %-6s %14.2f %10.2f %10.2f %12.0f\n", conns, size, "uring",
+                       uring_result.syscalls_per_rpc, uring_result.p50_us, uring_result.p99_us, uring_result.rps);
+            }
+        }
+    }
+    return 0;
+}
@@ -16,7 +16,8 @@ enum class RpcErrorType
     RESOURCE_EXHAUSTED,  // 资源耗尽
     CONFIG_ERROR,        // 配置错误
     INVALID_RESPONSE,    // 无效响应
-    SYSTEM_ERROR         // 系统错误（不触发熔断）
+    SYSTEM_ERROR,        // 系统错误（不触发熔断）
+    DEADLINE_EXCEEDED    // 调用方截止时间已过，服务端跳过执行（不触发熔断）
 };
 class RpcException : public std::exception
 {
@@ -90,6 +91,8 @@ private:
             return "Resource limit exceeded";
         case RpcErrorType::CONFIG_ERROR:
             return "Invalid configuration";
+        case RpcErrorType::DEADLINE_EXCEEDED:
+            return "Deadline exceeded";
         default:
             return "Unknown RPC error";
         }
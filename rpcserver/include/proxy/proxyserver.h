@@ -7,14 +7,19 @@
 #ifndef PROXYSERVER_H
 #define PROXYSERVER_H
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 #include <muduo/net/EventLoop.h>
 #include "proxyservice.h"
+#include "adminservice.h"
+#include "metricsserver.h"
 
 class ProxyServer
 {
 public:
+    ProxyServer();
     void Start();
     void RegisterMessageHandler(int message_id, MessageHandler &&cb);
 
@@ -26,10 +31,20 @@ private:
     void onMessage(const muduo::net::TcpConnectionPtr &conn,
                    muduo::net::Buffer *buffer,
                    muduo::Timestamp time);
+    // 自省消息：请求内容为StatsRequest，回复带4字节长度头的ResponseHeader，content为StatsResponse
+    void onAdminMessage(int message_id, const std::string &content, const muduo::net::TcpConnectionPtr &conn);
+    // 收集网关自身的指标
+    void CollectStats(TheChat::StatsResponse *response) const;
     // 事件循环
     ::muduo::net::EventLoop loop_;
     // 处理服务
     ProxyService proxy_service_;
+    // 当前的客户端连接数
+    std::atomic<size_t> connection_count_{0};
+    // 内置的自省服务，gateadminmsgid非0时以该消息号提供
+    RpcAdminService admin_service_;
+    // gatemetricsport非0时以Prometheus文本格式输出统计的本地HTTP端点
+    std::unique_ptr<MetricsServer> metrics_server_;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 内置的自省服务：方法调用统计、连接数、连接池占用、熔断器状态和配置，RpcProvider和ProxyServer自动注册
+ */
+#ifndef ADMINSERVICE_H
+#define ADMINSERVICE_H
+
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <google/protobuf/service.h>
+#include "rpcadmin.pb.h"
+#include "methodmetrics.h"
+
+/*
+ * 所有统计都来自原子计数或分片直方图的合并，收集时不持有业务路径上的锁
+ * (熔断器表的锁只在复制状态期间持有)，可以在任意线程中随时调用。
+ * 同一份StatsResponse既作为GetStats的响应，也可以转换为Prometheus文本格式供HTTP端点输出。
+ */
+class RpcAdminService : public TheChat::AdminService
+{
+public:
+    // 填入方法调用统计和节点自身的数值指标，必须是非阻塞的
+    using Collector = std::function<void(TheChat::StatsResponse *)>;
+
+    /**
+     * @brief 构造函数
+     * @param role 节点角色，provider或gateway
+     * @param collector 节点自身统计的收集函数
+     */
+    RpcAdminService(std::string role, Collector collector);
+
+    void GetStats(google::protobuf::RpcController *controller, const TheChat::StatsRequest *request,
+                  TheChat::StatsResponse *response, google::protobuf::Closure *done) override;
+
+    /**
+     * @brief 收集本进程的统计：节点自身的统计、连接池占用、熔断器状态和配置
+     * @param include_config 是否附带配置项
+     * @param response 结果
+     */
+    void Collect(bool include_config, TheChat::StatsResponse *response) const;
+
+    // 转换为Prometheus文本格式(0.0.4)
+    static std::string ToPrometheus(const TheChat::StatsResponse &stats);
+
+    /**
+     * @brief 把方法调用统计快照写入MethodStats
+     * @param name 方法名Service.Method
+     * @param snapshot 统计快照
+     * @param stats 结果
+     */
+    static void FillMethodStats(const std::string &name, const MethodMetrics::Snapshot &snapshot, TheChat::MethodStats *stats);
+
+    /**
+     * @brief 添加一个数值指标
+     * @param response 结果
+     * @param name 指标名
+     * @param value 取值
+     * @param counter 是否为只增不减的累计值
+     * @param labels 标签，可为空
+     */
+    static void AddMetric(TheChat::StatsResponse *response, const std::string &name, double value, bool counter,
+                          std::initializer_list<std::pair<const char *, std::string>> labels = {});
+
+private:
+    // 配置项的值是否需要隐去(口令、密钥等)
+    static bool IsSensitiveKey(const std::string &key);
+
+    const std::string role_;
+    Collector collector_;
+};
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 自己完成监听和接收的服务端，可监听TCP地址或Unix域套接字，接收到的连接与TcpServer一样交给muduo的TcpConnection处理
+ */
+#ifndef LISTENSERVER_H
+#define LISTENSERVER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <muduo/net/Callbacks.h>
+#include <muduo/net/Channel.h>
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThreadPool.h>
+#include <muduo/net/InetAddress.h>
+#include <muduo/net/TcpConnection.h>
+
+/*
+ * muduo的TcpServer无法监听Unix域套接字，也没有停止接收新连接的接口，
+ * 本类按TcpServer的方式自己完成监听和接收，监听socket由本类持有，可以随时停止接收；
+ * 连接建立后的读写、关闭仍由TcpConnection负责，因此同一套连接回调和消息回调可以同时服务TCP连接和Unix域套接字连接。
+ * 所有接口都必须在loop所在线程中调用。
+ */
+class ListenServer
+{
+public:
+    /**
+     * @brief 构造函数，监听TCP地址
+     * @param loop 监听所在的事件循环
+     * @param address 监听地址
+     * @param name 名称，用作连接名前缀和IO线程名
+     * @param reuse_port 是否设置SO_REUSEPORT
+     */
+    ListenServer(muduo::net::EventLoop *loop, const muduo::net::InetAddress &address, const std::string &name, bool reuse_port);
+    /**
+     * @brief 构造函数，监听Unix域套接字
+     * @param loop 监听所在的事件循环
+     * @param path 套接字文件路径
+     * @param name 名称，用作连接名前缀和IO线程名
+     */
+    ListenServer(muduo::net::EventLoop *loop, const std::string &path, const std::string &name);
+    ~ListenServer();
+
+    void SetConnectionCallback(const muduo::net::ConnectionCallback &cb) { connection_callback_ = cb; }
+    void SetMessageCallback(const muduo::net::MessageCallback &cb) { message_callback_ = cb; }
+    // IO线程数，0表示连接也在loop中处理，必须在Start之前设置
+    void SetThreadNum(int num) { thread_num_ = num; }
+    void SetThreadInitCallback(const muduo::net::EventLoopThreadPool::ThreadInitCallback &cb) { thread_init_callback_ = cb; }
+    // 非0时为每个新连接创建该大小的共享内存字节环并交给对端，连接的context预置为std::shared_ptr<ShmTransport>，
+    // 只用于Unix域套接字，必须在Start之前设置
+    void SetShmCapacity(size_t capacity) { shm_capacity_ = capacity; }
+
+    /**
+     * @brief 绑定并开始监听，Unix域套接字先删除残留的套接字文件
+     * @return 成功返回true，失败时已记录日志
+     */
+    bool Start();
+
+    // 停止接收新连接并关闭监听socket，Unix域套接字同时删除套接字文件，已建立的连接不受影响
+    void StopAccepting();
+
+    // Unix域套接字的路径，监听TCP地址时为空
+    const std::string &Path() const { return path_; }
+
+private:
+    // 创建监听socket，失败时返回-1并记录日志
+    int ListenTcp();
+    int ListenUnix();
+    // 日志中的监听地址
+    std::string Where() const;
+    // 监听socket可读：接收一个新连接并分配给IO线程
+    void HandleAccept(muduo::Timestamp);
+    // 连接关闭，由连接所在的IO线程调用
+    void RemoveConnection(const muduo::net::TcpConnectionPtr &conn);
+    void RemoveConnectionInLoop(const muduo::net::TcpConnectionPtr &conn);
+
+    muduo::net::EventLoop *loop_;
+    const muduo::net::InetAddress address_;
+    const std::string path_;
+    const std::string name_;
+    const bool reuse_port_ = false;
+    int listen_fd_ = -1;
+    // 预留的空闲fd，文件描述符耗尽时用它接收并立即关闭新连接，避免水平触发的监听事件忙等
+    int idle_fd_ = -1;
+    std::unique_ptr<muduo::net::Channel> accept_channel_;
+    std::unique_ptr<muduo::net::EventLoopThreadPool> thread_pool_;
+    int thread_num_ = 0;
+    size_t shm_capacity_ = 0;
+    muduo::net::ConnectionCallback connection_callback_;
+    muduo::net::MessageCallback message_callback_;
+    muduo::net::EventLoopThreadPool::ThreadInitCallback thread_init_callback_;
+    int next_conn_id_ = 1;
+    // 连接名到连接的映射，连接关闭前由本对象持有
+    std::map<std::string, muduo::net::TcpConnectionPtr> connections_;
+
+    ListenServer(const ListenServer &) = delete;
+    ListenServer &operator=(const ListenServer &) = delete;
+};
+
+#endif
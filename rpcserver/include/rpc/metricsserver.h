@@ -0,0 +1,58 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 本地HTTP指标端点：在独立线程和端口上以Prometheus文本格式输出统计
+ */
+#ifndef METRICSSERVER_H
+#define METRICSSERVER_H
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <muduo/base/Timestamp.h>
+#include <muduo/net/Buffer.h>
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/InetAddress.h>
+#include <muduo/net/TcpConnection.h>
+
+/*
+ * 只处理"GET /metrics"，每个请求应答后关闭连接。监听循环运行在自己的线程中，
+ * 抓取和渲染不占用服务的IO线程和业务线程，渲染函数只读取原子计数，不阻塞业务路径。
+ */
+class MetricsServer
+{
+public:
+    // 生成响应正文
+    using Renderer = std::function<std::string()>;
+
+    /**
+     * @brief 构造函数
+     * @param address 监听地址，通常为127.0.0.1
+     * @param renderer 生成Prometheus文本的函数，在监听线程中调用
+     */
+    MetricsServer(const muduo::net::InetAddress &address, Renderer renderer);
+    // 停止监听循环并等待线程退出
+    ~MetricsServer();
+
+    // 启动监听线程，监听开始后返回
+    void Start();
+
+private:
+    // 监听线程：创建、运行和销毁TcpServer
+    void ThreadFunc(std::promise<void> *started);
+    void OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp);
+    // 写回响应并在写完后关闭连接
+    static void Reply(const muduo::net::TcpConnectionPtr &conn, const char *status, const std::string &body);
+
+    const muduo::net::InetAddress address_;
+    Renderer renderer_;
+    std::thread thread_;
+    std::atomic<muduo::net::EventLoop *> loop_{nullptr};
+
+    MetricsServer(const MetricsServer &) = delete;
+    MetricsServer &operator=(const MetricsServer &) = delete;
+};
+
+#endif
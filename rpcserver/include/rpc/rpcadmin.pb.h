@@ -0,0 +1,2324 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpcadmin.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpcadmin_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpcadmin_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/service.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpcadmin_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rpcadmin_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcadmin_2eproto;
+namespace TheChat {
+class BreakerStats;
+struct BreakerStatsDefaultTypeInternal;
+extern BreakerStatsDefaultTypeInternal _BreakerStats_default_instance_;
+class MethodStats;
+struct MethodStatsDefaultTypeInternal;
+extern MethodStatsDefaultTypeInternal _MethodStats_default_instance_;
+class MetricValue;
+struct MetricValueDefaultTypeInternal;
+extern MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+class MetricValue_LabelsEntry_DoNotUse;
+struct MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal;
+extern MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal _MetricValue_LabelsEntry_DoNotUse_default_instance_;
+class PoolStats;
+struct PoolStatsDefaultTypeInternal;
+extern PoolStatsDefaultTypeInternal _PoolStats_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class StatsResponse;
+struct StatsResponseDefaultTypeInternal;
+extern StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+class StatsResponse_ConfigEntry_DoNotUse;
+struct StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal;
+extern StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal _StatsResponse_ConfigEntry_DoNotUse_default_instance_;
+}  // namespace TheChat
+PROTOBUF_NAMESPACE_OPEN
+template<> ::TheChat::BreakerStats* Arena::CreateMaybeMessage<::TheChat::BreakerStats>(Arena*);
+template<> ::TheChat::MethodStats* Arena::CreateMaybeMessage<::TheChat::MethodStats>(Arena*);
+template<> ::TheChat::MetricValue* Arena::CreateMaybeMessage<::TheChat::MetricValue>(Arena*);
+template<> ::TheChat::MetricValue_LabelsEntry_DoNotUse* Arena::CreateMaybeMessage<::TheChat::MetricValue_LabelsEntry_DoNotUse>(Arena*);
+template<> ::TheChat::PoolStats* Arena::CreateMaybeMessage<::TheChat::PoolStats>(Arena*);
+template<> ::TheChat::StatsRequest* Arena::CreateMaybeMessage<::TheChat::StatsRequest>(Arena*);
+template<> ::TheChat::StatsResponse* Arena::CreateMaybeMessage<::TheChat::StatsResponse>(Arena*);
+template<> ::TheChat::StatsResponse_ConfigEntry_DoNotUse* Arena::CreateMaybeMessage<::TheChat::StatsResponse_ConfigEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace TheChat {
+
+// ===================================================================
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  ~StatsRequest() override;
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsRequest& from) {
+    StatsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIncludeConfigFieldNumber = 1,
+  };
+  // bool include_config = 1;
+  void clear_include_config();
+  bool include_config() const;
+  void set_include_config(bool value);
+  private:
+  bool _internal_include_config() const;
+  void _internal_set_include_config(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool include_config_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MethodStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.MethodStats) */ {
+ public:
+  inline MethodStats() : MethodStats(nullptr) {}
+  ~MethodStats() override;
+  explicit PROTOBUF_CONSTEXPR MethodStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MethodStats(const MethodStats& from);
+  MethodStats(MethodStats&& from) noexcept
+    : MethodStats() {
+    *this = ::std::move(from);
+  }
+
+  inline MethodStats& operator=(const MethodStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MethodStats& operator=(MethodStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MethodStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MethodStats* internal_default_instance() {
+    return reinterpret_cast<const MethodStats*>(
+               &_MethodStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MethodStats& a, MethodStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MethodStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MethodStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MethodStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MethodStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MethodStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MethodStats& from) {
+    MethodStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MethodStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.MethodStats";
+  }
+  protected:
+  explicit MethodStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kRequestsFieldNumber = 2,
+    kErrorsFieldNumber = 3,
+    kInflightFieldNumber = 4,
+    kRequestBytesFieldNumber = 5,
+    kResponseBytesFieldNumber = 6,
+    kLatencySumUsFieldNumber = 7,
+    kLatencyMaxUsFieldNumber = 8,
+    kLatencyP50UsFieldNumber = 9,
+    kLatencyP90UsFieldNumber = 10,
+    kLatencyP99UsFieldNumber = 11,
+    kLatencyP999UsFieldNumber = 12,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 requests = 2;
+  void clear_requests();
+  uint64_t requests() const;
+  void set_requests(uint64_t value);
+  private:
+  uint64_t _internal_requests() const;
+  void _internal_set_requests(uint64_t value);
+  public:
+
+  // uint64 errors = 3;
+  void clear_errors();
+  uint64_t errors() const;
+  void set_errors(uint64_t value);
+  private:
+  uint64_t _internal_errors() const;
+  void _internal_set_errors(uint64_t value);
+  public:
+
+  // uint64 inflight = 4;
+  void clear_inflight();
+  uint64_t inflight() const;
+  void set_inflight(uint64_t value);
+  private:
+  uint64_t _internal_inflight() const;
+  void _internal_set_inflight(uint64_t value);
+  public:
+
+  // uint64 request_bytes = 5;
+  void clear_request_bytes();
+  uint64_t request_bytes() const;
+  void set_request_bytes(uint64_t value);
+  private:
+  uint64_t _internal_request_bytes() const;
+  void _internal_set_request_bytes(uint64_t value);
+  public:
+
+  // uint64 response_bytes = 6;
+  void clear_response_bytes();
+  uint64_t response_bytes() const;
+  void set_response_bytes(uint64_t value);
+  private:
+  uint64_t _internal_response_bytes() const;
+  void _internal_set_response_bytes(uint64_t value);
+  public:
+
+  // uint64 latency_sum_us = 7;
+  void clear_latency_sum_us();
+  uint64_t latency_sum_us() const;
+  void set_latency_sum_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_sum_us() const;
+  void _internal_set_latency_sum_us(uint64_t value);
+  public:
+
+  // uint64 latency_max_us = 8;
+  void clear_latency_max_us();
+  uint64_t latency_max_us() const;
+  void set_latency_max_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_max_us() const;
+  void _internal_set_latency_max_us(uint64_t value);
+  public:
+
+  // uint64 latency_p50_us = 9;
+  void clear_latency_p50_us();
+  uint64_t latency_p50_us() const;
+  void set_latency_p50_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_p50_us() const;
+  void _internal_set_latency_p50_us(uint64_t value);
+  public:
+
+  // uint64 latency_p90_us = 10;
+  void clear_latency_p90_us();
+  uint64_t latency_p90_us() const;
+  void set_latency_p90_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_p90_us() const;
+  void _internal_set_latency_p90_us(uint64_t value);
+  public:
+
+  // uint64 latency_p99_us = 11;
+  void clear_latency_p99_us();
+  uint64_t latency_p99_us() const;
+  void set_latency_p99_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_p99_us() const;
+  void _internal_set_latency_p99_us(uint64_t value);
+  public:
+
+  // uint64 latency_p999_us = 12;
+  void clear_latency_p999_us();
+  uint64_t latency_p999_us() const;
+  void set_latency_p999_us(uint64_t value);
+  private:
+  uint64_t _internal_latency_p999_us() const;
+  void _internal_set_latency_p999_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.MethodStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t requests_;
+    uint64_t errors_;
+    uint64_t inflight_;
+    uint64_t request_bytes_;
+    uint64_t response_bytes_;
+    uint64_t latency_sum_us_;
+    uint64_t latency_max_us_;
+    uint64_t latency_p50_us_;
+    uint64_t latency_p90_us_;
+    uint64_t latency_p99_us_;
+    uint64_t latency_p999_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricValue_LabelsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MetricValue_LabelsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MetricValue_LabelsEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  MetricValue_LabelsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR MetricValue_LabelsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit MetricValue_LabelsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MetricValue_LabelsEntry_DoNotUse& other);
+  static const MetricValue_LabelsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MetricValue_LabelsEntry_DoNotUse*>(&_MetricValue_LabelsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TheChat.MetricValue.LabelsEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TheChat.MetricValue.LabelsEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class MetricValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.MetricValue) */ {
+ public:
+  inline MetricValue() : MetricValue(nullptr) {}
+  ~MetricValue() override;
+  explicit PROTOBUF_CONSTEXPR MetricValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricValue(const MetricValue& from);
+  MetricValue(MetricValue&& from) noexcept
+    : MetricValue() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricValue& operator=(const MetricValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricValue& operator=(MetricValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricValue* internal_default_instance() {
+    return reinterpret_cast<const MetricValue*>(
+               &_MetricValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MetricValue& a, MetricValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricValue& from) {
+    MetricValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.MetricValue";
+  }
+  protected:
+  explicit MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelsFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kCounterFieldNumber = 3,
+  };
+  // map<string, string> labels = 4;
+  int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
+  void clear_labels();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_labels() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_labels();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      labels() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_labels();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // bool counter = 3;
+  void clear_counter();
+  bool counter() const;
+  void set_counter(bool value);
+  private:
+  bool _internal_counter() const;
+  void _internal_set_counter(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.MetricValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        MetricValue_LabelsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> labels_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double value_;
+    bool counter_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PoolStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.PoolStats) */ {
+ public:
+  inline PoolStats() : PoolStats(nullptr) {}
+  ~PoolStats() override;
+  explicit PROTOBUF_CONSTEXPR PoolStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PoolStats(const PoolStats& from);
+  PoolStats(PoolStats&& from) noexcept
+    : PoolStats() {
+    *this = ::std::move(from);
+  }
+
+  inline PoolStats& operator=(const PoolStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PoolStats& operator=(PoolStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PoolStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PoolStats* internal_default_instance() {
+    return reinterpret_cast<const PoolStats*>(
+               &_PoolStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(PoolStats& a, PoolStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PoolStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PoolStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PoolStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PoolStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PoolStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PoolStats& from) {
+    PoolStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PoolStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.PoolStats";
+  }
+  protected:
+  explicit PoolStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kConnectionsFieldNumber = 2,
+    kMaxConnectionsFieldNumber = 3,
+    kWaitersFieldNumber = 4,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 connections = 2;
+  void clear_connections();
+  uint64_t connections() const;
+  void set_connections(uint64_t value);
+  private:
+  uint64_t _internal_connections() const;
+  void _internal_set_connections(uint64_t value);
+  public:
+
+  // uint64 max_connections = 3;
+  void clear_max_connections();
+  uint64_t max_connections() const;
+  void set_max_connections(uint64_t value);
+  private:
+  uint64_t _internal_max_connections() const;
+  void _internal_set_max_connections(uint64_t value);
+  public:
+
+  // uint64 waiters = 4;
+  void clear_waiters();
+  uint64_t waiters() const;
+  void set_waiters(uint64_t value);
+  private:
+  uint64_t _internal_waiters() const;
+  void _internal_set_waiters(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.PoolStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t connections_;
+    uint64_t max_connections_;
+    uint64_t waiters_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BreakerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.BreakerStats) */ {
+ public:
+  inline BreakerStats() : BreakerStats(nullptr) {}
+  ~BreakerStats() override;
+  explicit PROTOBUF_CONSTEXPR BreakerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BreakerStats(const BreakerStats& from);
+  BreakerStats(BreakerStats&& from) noexcept
+    : BreakerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline BreakerStats& operator=(const BreakerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BreakerStats& operator=(BreakerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BreakerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BreakerStats* internal_default_instance() {
+    return reinterpret_cast<const BreakerStats*>(
+               &_BreakerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(BreakerStats& a, BreakerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BreakerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BreakerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BreakerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BreakerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BreakerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BreakerStats& from) {
+    BreakerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BreakerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.BreakerStats";
+  }
+  protected:
+  explicit BreakerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceFieldNumber = 1,
+    kStateFieldNumber = 2,
+  };
+  // string service = 1;
+  void clear_service();
+  const std::string& service() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service();
+  PROTOBUF_NODISCARD std::string* release_service();
+  void set_allocated_service(std::string* service);
+  private:
+  const std::string& _internal_service() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service(const std::string& value);
+  std::string* _internal_mutable_service();
+  public:
+
+  // int32 state = 2;
+  void clear_state();
+  int32_t state() const;
+  void set_state(int32_t value);
+  private:
+  int32_t _internal_state() const;
+  void _internal_set_state(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.BreakerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_;
+    int32_t state_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse_ConfigEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_ConfigEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StatsResponse_ConfigEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  StatsResponse_ConfigEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR StatsResponse_ConfigEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit StatsResponse_ConfigEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const StatsResponse_ConfigEntry_DoNotUse& other);
+  static const StatsResponse_ConfigEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const StatsResponse_ConfigEntry_DoNotUse*>(&_StatsResponse_ConfigEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TheChat.StatsResponse.ConfigEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TheChat.StatsResponse.ConfigEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class StatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.StatsResponse) */ {
+ public:
+  inline StatsResponse() : StatsResponse(nullptr) {}
+  ~StatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsResponse(const StatsResponse& from);
+  StatsResponse(StatsResponse&& from) noexcept
+    : StatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsResponse& operator=(StatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatsResponse*>(
+               &_StatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StatsResponse& a, StatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsResponse& from) {
+    StatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.StatsResponse";
+  }
+  protected:
+  explicit StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMethodsFieldNumber = 2,
+    kMetricsFieldNumber = 3,
+    kPoolsFieldNumber = 4,
+    kBreakersFieldNumber = 5,
+    kConfigFieldNumber = 6,
+    kRoleFieldNumber = 1,
+  };
+  // repeated .TheChat.MethodStats methods = 2;
+  int methods_size() const;
+  private:
+  int _internal_methods_size() const;
+  public:
+  void clear_methods();
+  ::TheChat::MethodStats* mutable_methods(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MethodStats >*
+      mutable_methods();
+  private:
+  const ::TheChat::MethodStats& _internal_methods(int index) const;
+  ::TheChat::MethodStats* _internal_add_methods();
+  public:
+  const ::TheChat::MethodStats& methods(int index) const;
+  ::TheChat::MethodStats* add_methods();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MethodStats >&
+      methods() const;
+
+  // repeated .TheChat.MetricValue metrics = 3;
+  int metrics_size() const;
+  private:
+  int _internal_metrics_size() const;
+  public:
+  void clear_metrics();
+  ::TheChat::MetricValue* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MetricValue >*
+      mutable_metrics();
+  private:
+  const ::TheChat::MetricValue& _internal_metrics(int index) const;
+  ::TheChat::MetricValue* _internal_add_metrics();
+  public:
+  const ::TheChat::MetricValue& metrics(int index) const;
+  ::TheChat::MetricValue* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MetricValue >&
+      metrics() const;
+
+  // repeated .TheChat.PoolStats pools = 4;
+  int pools_size() const;
+  private:
+  int _internal_pools_size() const;
+  public:
+  void clear_pools();
+  ::TheChat::PoolStats* mutable_pools(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::PoolStats >*
+      mutable_pools();
+  private:
+  const ::TheChat::PoolStats& _internal_pools(int index) const;
+  ::TheChat::PoolStats* _internal_add_pools();
+  public:
+  const ::TheChat::PoolStats& pools(int index) const;
+  ::TheChat::PoolStats* add_pools();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::PoolStats >&
+      pools() const;
+
+  // repeated .TheChat.BreakerStats breakers = 5;
+  int breakers_size() const;
+  private:
+  int _internal_breakers_size() const;
+  public:
+  void clear_breakers();
+  ::TheChat::BreakerStats* mutable_breakers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::BreakerStats >*
+      mutable_breakers();
+  private:
+  const ::TheChat::BreakerStats& _internal_breakers(int index) const;
+  ::TheChat::BreakerStats* _internal_add_breakers();
+  public:
+  const ::TheChat::BreakerStats& breakers(int index) const;
+  ::TheChat::BreakerStats* add_breakers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::BreakerStats >&
+      breakers() const;
+
+  // map<string, string> config = 6;
+  int config_size() const;
+  private:
+  int _internal_config_size() const;
+  public:
+  void clear_config();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_config() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_config();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      config() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_config();
+
+  // string role = 1;
+  void clear_role();
+  const std::string& role() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_role(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_role();
+  PROTOBUF_NODISCARD std::string* release_role();
+  void set_allocated_role(std::string* role);
+  private:
+  const std::string& _internal_role() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role(const std::string& value);
+  std::string* _internal_mutable_role();
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.StatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MethodStats > methods_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MetricValue > metrics_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::PoolStats > pools_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::BreakerStats > breakers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        StatsResponse_ConfigEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> config_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr role_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcadmin_2eproto;
+};
+// ===================================================================
+
+class AdminService_Stub;
+
+class AdminService : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline AdminService() {};
+ public:
+  virtual ~AdminService();
+
+  typedef AdminService_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void GetStats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::TheChat::StatsRequest* request,
+                       ::TheChat::StatsResponse* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(AdminService);
+};
+
+class AdminService_Stub : public AdminService {
+ public:
+  AdminService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  AdminService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~AdminService_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements AdminService ------------------------------------------
+
+  void GetStats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::TheChat::StatsRequest* request,
+                       ::TheChat::StatsResponse* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(AdminService_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// StatsRequest
+
+// bool include_config = 1;
+inline void StatsRequest::clear_include_config() {
+  _impl_.include_config_ = false;
+}
+inline bool StatsRequest::_internal_include_config() const {
+  return _impl_.include_config_;
+}
+inline bool StatsRequest::include_config() const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsRequest.include_config)
+  return _internal_include_config();
+}
+inline void StatsRequest::_internal_set_include_config(bool value) {
+  
+  _impl_.include_config_ = value;
+}
+inline void StatsRequest::set_include_config(bool value) {
+  _internal_set_include_config(value);
+  // @@protoc_insertion_point(field_set:TheChat.StatsRequest.include_config)
+}
+
+// -------------------------------------------------------------------
+
+// MethodStats
+
+// string name = 1;
+inline void MethodStats::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MethodStats::name() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MethodStats::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.name)
+}
+inline std::string* MethodStats::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:TheChat.MethodStats.name)
+  return _s;
+}
+inline const std::string& MethodStats::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MethodStats::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MethodStats::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MethodStats::release_name() {
+  // @@protoc_insertion_point(field_release:TheChat.MethodStats.name)
+  return _impl_.name_.Release();
+}
+inline void MethodStats::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.MethodStats.name)
+}
+
+// uint64 requests = 2;
+inline void MethodStats::clear_requests() {
+  _impl_.requests_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_requests() const {
+  return _impl_.requests_;
+}
+inline uint64_t MethodStats::requests() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.requests)
+  return _internal_requests();
+}
+inline void MethodStats::_internal_set_requests(uint64_t value) {
+  
+  _impl_.requests_ = value;
+}
+inline void MethodStats::set_requests(uint64_t value) {
+  _internal_set_requests(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.requests)
+}
+
+// uint64 errors = 3;
+inline void MethodStats::clear_errors() {
+  _impl_.errors_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_errors() const {
+  return _impl_.errors_;
+}
+inline uint64_t MethodStats::errors() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.errors)
+  return _internal_errors();
+}
+inline void MethodStats::_internal_set_errors(uint64_t value) {
+  
+  _impl_.errors_ = value;
+}
+inline void MethodStats::set_errors(uint64_t value) {
+  _internal_set_errors(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.errors)
+}
+
+// uint64 inflight = 4;
+inline void MethodStats::clear_inflight() {
+  _impl_.inflight_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_inflight() const {
+  return _impl_.inflight_;
+}
+inline uint64_t MethodStats::inflight() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.inflight)
+  return _internal_inflight();
+}
+inline void MethodStats::_internal_set_inflight(uint64_t value) {
+  
+  _impl_.inflight_ = value;
+}
+inline void MethodStats::set_inflight(uint64_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.inflight)
+}
+
+// uint64 request_bytes = 5;
+inline void MethodStats::clear_request_bytes() {
+  _impl_.request_bytes_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_request_bytes() const {
+  return _impl_.request_bytes_;
+}
+inline uint64_t MethodStats::request_bytes() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.request_bytes)
+  return _internal_request_bytes();
+}
+inline void MethodStats::_internal_set_request_bytes(uint64_t value) {
+  
+  _impl_.request_bytes_ = value;
+}
+inline void MethodStats::set_request_bytes(uint64_t value) {
+  _internal_set_request_bytes(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.request_bytes)
+}
+
+// uint64 response_bytes = 6;
+inline void MethodStats::clear_response_bytes() {
+  _impl_.response_bytes_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_response_bytes() const {
+  return _impl_.response_bytes_;
+}
+inline uint64_t MethodStats::response_bytes() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.response_bytes)
+  return _internal_response_bytes();
+}
+inline void MethodStats::_internal_set_response_bytes(uint64_t value) {
+  
+  _impl_.response_bytes_ = value;
+}
+inline void MethodStats::set_response_bytes(uint64_t value) {
+  _internal_set_response_bytes(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.response_bytes)
+}
+
+// uint64 latency_sum_us = 7;
+inline void MethodStats::clear_latency_sum_us() {
+  _impl_.latency_sum_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_sum_us() const {
+  return _impl_.latency_sum_us_;
+}
+inline uint64_t MethodStats::latency_sum_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_sum_us)
+  return _internal_latency_sum_us();
+}
+inline void MethodStats::_internal_set_latency_sum_us(uint64_t value) {
+  
+  _impl_.latency_sum_us_ = value;
+}
+inline void MethodStats::set_latency_sum_us(uint64_t value) {
+  _internal_set_latency_sum_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_sum_us)
+}
+
+// uint64 latency_max_us = 8;
+inline void MethodStats::clear_latency_max_us() {
+  _impl_.latency_max_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_max_us() const {
+  return _impl_.latency_max_us_;
+}
+inline uint64_t MethodStats::latency_max_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_max_us)
+  return _internal_latency_max_us();
+}
+inline void MethodStats::_internal_set_latency_max_us(uint64_t value) {
+  
+  _impl_.latency_max_us_ = value;
+}
+inline void MethodStats::set_latency_max_us(uint64_t value) {
+  _internal_set_latency_max_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_max_us)
+}
+
+// uint64 latency_p50_us = 9;
+inline void MethodStats::clear_latency_p50_us() {
+  _impl_.latency_p50_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_p50_us() const {
+  return _impl_.latency_p50_us_;
+}
+inline uint64_t MethodStats::latency_p50_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_p50_us)
+  return _internal_latency_p50_us();
+}
+inline void MethodStats::_internal_set_latency_p50_us(uint64_t value) {
+  
+  _impl_.latency_p50_us_ = value;
+}
+inline void MethodStats::set_latency_p50_us(uint64_t value) {
+  _internal_set_latency_p50_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_p50_us)
+}
+
+// uint64 latency_p90_us = 10;
+inline void MethodStats::clear_latency_p90_us() {
+  _impl_.latency_p90_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_p90_us() const {
+  return _impl_.latency_p90_us_;
+}
+inline uint64_t MethodStats::latency_p90_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_p90_us)
+  return _internal_latency_p90_us();
+}
+inline void MethodStats::_internal_set_latency_p90_us(uint64_t value) {
+  
+  _impl_.latency_p90_us_ = value;
+}
+inline void MethodStats::set_latency_p90_us(uint64_t value) {
+  _internal_set_latency_p90_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_p90_us)
+}
+
+// uint64 latency_p99_us = 11;
+inline void MethodStats::clear_latency_p99_us() {
+  _impl_.latency_p99_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_p99_us() const {
+  return _impl_.latency_p99_us_;
+}
+inline uint64_t MethodStats::latency_p99_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_p99_us)
+  return _internal_latency_p99_us();
+}
+inline void MethodStats::_internal_set_latency_p99_us(uint64_t value) {
+  
+  _impl_.latency_p99_us_ = value;
+}
+inline void MethodStats::set_latency_p99_us(uint64_t value) {
+  _internal_set_latency_p99_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_p99_us)
+}
+
+// uint64 latency_p999_us = 12;
+inline void MethodStats::clear_latency_p999_us() {
+  _impl_.latency_p999_us_ = uint64_t{0u};
+}
+inline uint64_t MethodStats::_internal_latency_p999_us() const {
+  return _impl_.latency_p999_us_;
+}
+inline uint64_t MethodStats::latency_p999_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.MethodStats.latency_p999_us)
+  return _internal_latency_p999_us();
+}
+inline void MethodStats::_internal_set_latency_p999_us(uint64_t value) {
+  
+  _impl_.latency_p999_us_ = value;
+}
+inline void MethodStats::set_latency_p999_us(uint64_t value) {
+  _internal_set_latency_p999_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.MethodStats.latency_p999_us)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MetricValue
+
+// string name = 1;
+inline void MetricValue::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& MetricValue::name() const {
+  // @@protoc_insertion_point(field_get:TheChat.MetricValue.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricValue::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.MetricValue.name)
+}
+inline std::string* MetricValue::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:TheChat.MetricValue.name)
+  return _s;
+}
+inline const std::string& MetricValue::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void MetricValue::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricValue::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricValue::release_name() {
+  // @@protoc_insertion_point(field_release:TheChat.MetricValue.name)
+  return _impl_.name_.Release();
+}
+inline void MetricValue::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.MetricValue.name)
+}
+
+// double value = 2;
+inline void MetricValue::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double MetricValue::_internal_value() const {
+  return _impl_.value_;
+}
+inline double MetricValue::value() const {
+  // @@protoc_insertion_point(field_get:TheChat.MetricValue.value)
+  return _internal_value();
+}
+inline void MetricValue::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void MetricValue::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:TheChat.MetricValue.value)
+}
+
+// bool counter = 3;
+inline void MetricValue::clear_counter() {
+  _impl_.counter_ = false;
+}
+inline bool MetricValue::_internal_counter() const {
+  return _impl_.counter_;
+}
+inline bool MetricValue::counter() const {
+  // @@protoc_insertion_point(field_get:TheChat.MetricValue.counter)
+  return _internal_counter();
+}
+inline void MetricValue::_internal_set_counter(bool value) {
+  
+  _impl_.counter_ = value;
+}
+inline void MetricValue::set_counter(bool value) {
+  _internal_set_counter(value);
+  // @@protoc_insertion_point(field_set:TheChat.MetricValue.counter)
+}
+
+// map<string, string> labels = 4;
+inline int MetricValue::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
+inline int MetricValue::labels_size() const {
+  return _internal_labels_size();
+}
+inline void MetricValue::clear_labels() {
+  _impl_.labels_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+MetricValue::_internal_labels() const {
+  return _impl_.labels_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+MetricValue::labels() const {
+  // @@protoc_insertion_point(field_map:TheChat.MetricValue.labels)
+  return _internal_labels();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+MetricValue::_internal_mutable_labels() {
+  return _impl_.labels_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+MetricValue::mutable_labels() {
+  // @@protoc_insertion_point(field_mutable_map:TheChat.MetricValue.labels)
+  return _internal_mutable_labels();
+}
+
+// -------------------------------------------------------------------
+
+// PoolStats
+
+// string name = 1;
+inline void PoolStats::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& PoolStats::name() const {
+  // @@protoc_insertion_point(field_get:TheChat.PoolStats.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PoolStats::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.PoolStats.name)
+}
+inline std::string* PoolStats::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:TheChat.PoolStats.name)
+  return _s;
+}
+inline const std::string& PoolStats::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void PoolStats::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PoolStats::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PoolStats::release_name() {
+  // @@protoc_insertion_point(field_release:TheChat.PoolStats.name)
+  return _impl_.name_.Release();
+}
+inline void PoolStats::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.PoolStats.name)
+}
+
+// uint64 connections = 2;
+inline void PoolStats::clear_connections() {
+  _impl_.connections_ = uint64_t{0u};
+}
+inline uint64_t PoolStats::_internal_connections() const {
+  return _impl_.connections_;
+}
+inline uint64_t PoolStats::connections() const {
+  // @@protoc_insertion_point(field_get:TheChat.PoolStats.connections)
+  return _internal_connections();
+}
+inline void PoolStats::_internal_set_connections(uint64_t value) {
+  
+  _impl_.connections_ = value;
+}
+inline void PoolStats::set_connections(uint64_t value) {
+  _internal_set_connections(value);
+  // @@protoc_insertion_point(field_set:TheChat.PoolStats.connections)
+}
+
+// uint64 max_connections = 3;
+inline void PoolStats::clear_max_connections() {
+  _impl_.max_connections_ = uint64_t{0u};
+}
+inline uint64_t PoolStats::_internal_max_connections() const {
+  return _impl_.max_connections_;
+}
+inline uint64_t PoolStats::max_connections() const {
+  // @@protoc_insertion_point(field_get:TheChat.PoolStats.max_connections)
+  return _internal_max_connections();
+}
+inline void PoolStats::_internal_set_max_connections(uint64_t value) {
+  
+  _impl_.max_connections_ = value;
+}
+inline void PoolStats::set_max_connections(uint64_t value) {
+  _internal_set_max_connections(value);
+  // @@protoc_insertion_point(field_set:TheChat.PoolStats.max_connections)
+}
+
+// uint64 waiters = 4;
+inline void PoolStats::clear_waiters() {
+  _impl_.waiters_ = uint64_t{0u};
+}
+inline uint64_t PoolStats::_internal_waiters() const {
+  return _impl_.waiters_;
+}
+inline uint64_t PoolStats::waiters() const {
+  // @@protoc_insertion_point(field_get:TheChat.PoolStats.waiters)
+  return _internal_waiters();
+}
+inline void PoolStats::_internal_set_waiters(uint64_t value) {
+  
+  _impl_.waiters_ = value;
+}
+inline void PoolStats::set_waiters(uint64_t value) {
+  _internal_set_waiters(value);
+  // @@protoc_insertion_point(field_set:TheChat.PoolStats.waiters)
+}
+
+// -------------------------------------------------------------------
+
+// BreakerStats
+
+// string service = 1;
+inline void BreakerStats::clear_service() {
+  _impl_.service_.ClearToEmpty();
+}
+inline const std::string& BreakerStats::service() const {
+  // @@protoc_insertion_point(field_get:TheChat.BreakerStats.service)
+  return _internal_service();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BreakerStats::set_service(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.BreakerStats.service)
+}
+inline std::string* BreakerStats::mutable_service() {
+  std::string* _s = _internal_mutable_service();
+  // @@protoc_insertion_point(field_mutable:TheChat.BreakerStats.service)
+  return _s;
+}
+inline const std::string& BreakerStats::_internal_service() const {
+  return _impl_.service_.Get();
+}
+inline void BreakerStats::_internal_set_service(const std::string& value) {
+  
+  _impl_.service_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BreakerStats::_internal_mutable_service() {
+  
+  return _impl_.service_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BreakerStats::release_service() {
+  // @@protoc_insertion_point(field_release:TheChat.BreakerStats.service)
+  return _impl_.service_.Release();
+}
+inline void BreakerStats::set_allocated_service(std::string* service) {
+  if (service != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.service_.SetAllocated(service, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_.IsDefault()) {
+    _impl_.service_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.BreakerStats.service)
+}
+
+// int32 state = 2;
+inline void BreakerStats::clear_state() {
+  _impl_.state_ = 0;
+}
+inline int32_t BreakerStats::_internal_state() const {
+  return _impl_.state_;
+}
+inline int32_t BreakerStats::state() const {
+  // @@protoc_insertion_point(field_get:TheChat.BreakerStats.state)
+  return _internal_state();
+}
+inline void BreakerStats::_internal_set_state(int32_t value) {
+  
+  _impl_.state_ = value;
+}
+inline void BreakerStats::set_state(int32_t value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:TheChat.BreakerStats.state)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// StatsResponse
+
+// string role = 1;
+inline void StatsResponse::clear_role() {
+  _impl_.role_.ClearToEmpty();
+}
+inline const std::string& StatsResponse::role() const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsResponse.role)
+  return _internal_role();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatsResponse::set_role(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.role_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.StatsResponse.role)
+}
+inline std::string* StatsResponse::mutable_role() {
+  std::string* _s = _internal_mutable_role();
+  // @@protoc_insertion_point(field_mutable:TheChat.StatsResponse.role)
+  return _s;
+}
+inline const std::string& StatsResponse::_internal_role() const {
+  return _impl_.role_.Get();
+}
+inline void StatsResponse::_internal_set_role(const std::string& value) {
+  
+  _impl_.role_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatsResponse::_internal_mutable_role() {
+  
+  return _impl_.role_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatsResponse::release_role() {
+  // @@protoc_insertion_point(field_release:TheChat.StatsResponse.role)
+  return _impl_.role_.Release();
+}
+inline void StatsResponse::set_allocated_role(std::string* role) {
+  if (role != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.role_.SetAllocated(role, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.role_.IsDefault()) {
+    _impl_.role_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.StatsResponse.role)
+}
+
+// repeated .TheChat.MethodStats methods = 2;
+inline int StatsResponse::_internal_methods_size() const {
+  return _impl_.methods_.size();
+}
+inline int StatsResponse::methods_size() const {
+  return _internal_methods_size();
+}
+inline void StatsResponse::clear_methods() {
+  _impl_.methods_.Clear();
+}
+inline ::TheChat::MethodStats* StatsResponse::mutable_methods(int index) {
+  // @@protoc_insertion_point(field_mutable:TheChat.StatsResponse.methods)
+  return _impl_.methods_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MethodStats >*
+StatsResponse::mutable_methods() {
+  // @@protoc_insertion_point(field_mutable_list:TheChat.StatsResponse.methods)
+  return &_impl_.methods_;
+}
+inline const ::TheChat::MethodStats& StatsResponse::_internal_methods(int index) const {
+  return _impl_.methods_.Get(index);
+}
+inline const ::TheChat::MethodStats& StatsResponse::methods(int index) const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsResponse.methods)
+  return _internal_methods(index);
+}
+inline ::TheChat::MethodStats* StatsResponse::_internal_add_methods() {
+  return _impl_.methods_.Add();
+}
+inline ::TheChat::MethodStats* StatsResponse::add_methods() {
+  ::TheChat::MethodStats* _add = _internal_add_methods();
+  // @@protoc_insertion_point(field_add:TheChat.StatsResponse.methods)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MethodStats >&
+StatsResponse::methods() const {
+  // @@protoc_insertion_point(field_list:TheChat.StatsResponse.methods)
+  return _impl_.methods_;
+}
+
+// repeated .TheChat.MetricValue metrics = 3;
+inline int StatsResponse::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
+}
+inline int StatsResponse::metrics_size() const {
+  return _internal_metrics_size();
+}
+inline void StatsResponse::clear_metrics() {
+  _impl_.metrics_.Clear();
+}
+inline ::TheChat::MetricValue* StatsResponse::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:TheChat.StatsResponse.metrics)
+  return _impl_.metrics_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MetricValue >*
+StatsResponse::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:TheChat.StatsResponse.metrics)
+  return &_impl_.metrics_;
+}
+inline const ::TheChat::MetricValue& StatsResponse::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
+}
+inline const ::TheChat::MetricValue& StatsResponse::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsResponse.metrics)
+  return _internal_metrics(index);
+}
+inline ::TheChat::MetricValue* StatsResponse::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
+}
+inline ::TheChat::MetricValue* StatsResponse::add_metrics() {
+  ::TheChat::MetricValue* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:TheChat.StatsResponse.metrics)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::MetricValue >&
+StatsResponse::metrics() const {
+  // @@protoc_insertion_point(field_list:TheChat.StatsResponse.metrics)
+  return _impl_.metrics_;
+}
+
+// repeated .TheChat.PoolStats pools = 4;
+inline int StatsResponse::_internal_pools_size() const {
+  return _impl_.pools_.size();
+}
+inline int StatsResponse::pools_size() const {
+  return _internal_pools_size();
+}
+inline void StatsResponse::clear_pools() {
+  _impl_.pools_.Clear();
+}
+inline ::TheChat::PoolStats* StatsResponse::mutable_pools(int index) {
+  // @@protoc_insertion_point(field_mutable:TheChat.StatsResponse.pools)
+  return _impl_.pools_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::PoolStats >*
+StatsResponse::mutable_pools() {
+  // @@protoc_insertion_point(field_mutable_list:TheChat.StatsResponse.pools)
+  return &_impl_.pools_;
+}
+inline const ::TheChat::PoolStats& StatsResponse::_internal_pools(int index) const {
+  return _impl_.pools_.Get(index);
+}
+inline const ::TheChat::PoolStats& StatsResponse::pools(int index) const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsResponse.pools)
+  return _internal_pools(index);
+}
+inline ::TheChat::PoolStats* StatsResponse::_internal_add_pools() {
+  return _impl_.pools_.Add();
+}
+inline ::TheChat::PoolStats* StatsResponse::add_pools() {
+  ::TheChat::PoolStats* _add = _internal_add_pools();
+  // @@protoc_insertion_point(field_add:TheChat.StatsResponse.pools)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::PoolStats >&
+StatsResponse::pools() const {
+  // @@protoc_insertion_point(field_list:TheChat.StatsResponse.pools)
+  return _impl_.pools_;
+}
+
+// repeated .TheChat.BreakerStats breakers = 5;
+inline int StatsResponse::_internal_breakers_size() const {
+  return _impl_.breakers_.size();
+}
+inline int StatsResponse::breakers_size() const {
+  return _internal_breakers_size();
+}
+inline void StatsResponse::clear_breakers() {
+  _impl_.breakers_.Clear();
+}
+inline ::TheChat::BreakerStats* StatsResponse::mutable_breakers(int index) {
+  // @@protoc_insertion_point(field_mutable:TheChat.StatsResponse.breakers)
+  return _impl_.breakers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::BreakerStats >*
+StatsResponse::mutable_breakers() {
+  // @@protoc_insertion_point(field_mutable_list:TheChat.StatsResponse.breakers)
+  return &_impl_.breakers_;
+}
+inline const ::TheChat::BreakerStats& StatsResponse::_internal_breakers(int index) const {
+  return _impl_.breakers_.Get(index);
+}
+inline const ::TheChat::BreakerStats& StatsResponse::breakers(int index) const {
+  // @@protoc_insertion_point(field_get:TheChat.StatsResponse.breakers)
+  return _internal_breakers(index);
+}
+inline ::TheChat::BreakerStats* StatsResponse::_internal_add_breakers() {
+  return _impl_.breakers_.Add();
+}
+inline ::TheChat::BreakerStats* StatsResponse::add_breakers() {
+  ::TheChat::BreakerStats* _add = _internal_add_breakers();
+  // @@protoc_insertion_point(field_add:TheChat.StatsResponse.breakers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TheChat::BreakerStats >&
+StatsResponse::breakers() const {
+  // @@protoc_insertion_point(field_list:TheChat.StatsResponse.breakers)
+  return _impl_.breakers_;
+}
+
+// map<string, string> config = 6;
+inline int StatsResponse::_internal_config_size() const {
+  return _impl_.config_.size();
+}
+inline int StatsResponse::config_size() const {
+  return _internal_config_size();
+}
+inline void StatsResponse::clear_config() {
+  _impl_.config_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+StatsResponse::_internal_config() const {
+  return _impl_.config_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+StatsResponse::config() const {
+  // @@protoc_insertion_point(field_map:TheChat.StatsResponse.config)
+  return _internal_config();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+StatsResponse::_internal_mutable_config() {
+  return _impl_.config_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+StatsResponse::mutable_config() {
+  // @@protoc_insertion_point(field_mutable_map:TheChat.StatsResponse.config)
+  return _internal_mutable_config();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace TheChat
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcadmin_2eproto
@@ -13,6 +13,8 @@
 #include "circuitbreaker.h"
 #include "zookeeperutil.h"
 #include "connectionpool.h"
+#include "rpcsession.h"
+#include "rpccontroller.h"
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -35,25 +37,111 @@ public:
                     google::protobuf::Message *response,
                     google::protobuf::Closure *done);
 
+    /**
+     * @brief 发起一次流式调用，服务端必须支持v2帧
+     * @param method 要远程调用的方法
+     * @param controller rpc控制对象，Timeout()非0时作为整个流的超时时间，失败原因写入其中
+     * @param request 第一个请求消息
+     * @return 已建立的流，失败时返回nullptr
+     */
+    std::shared_ptr<RpcStream> OpenStream(const google::protobuf::MethodDescriptor *method,
+                                          TheRpcController *controller,
+                                          const google::protobuf::Message &request);
+
+    /**
+     * @brief 异步调用，请求发出后立即返回，不占用调用线程等待响应
+     * @param method 要远程调用的方法
+     * @param controller rpc控制对象，失败原因写入其中，调用完成前必须保持有效
+     * @param request 请求参数，只在本函数内使用
+     * @param response 响应，成功时填入，调用完成前必须保持有效
+     * @param done 调用成功、失败或超时后执行一次，在会话读线程或超时定时器线程中执行，不能阻塞；
+     *             服务发现或建立连接失败时在本线程中执行
+     * @param inherited_deadline 所在RPC方法的截止时间，调用的截止时间取它与控制器超时时间中较早的一个
+     */
+    void AsyncCallMethod(const google::protobuf::MethodDescriptor *method,
+                         TheRpcController *controller,
+                         const google::protobuf::Message *request,
+                         google::protobuf::Message *response,
+                         std::function<void()> &&done,
+                         TheRpcController::Clock::time_point inherited_deadline = TheRpcController::CurrentDeadline());
+
 private:
     ZooKeeperClient zk_client_;
     int epoll_fd_;
     struct CachedEndpoint
     {
-        Endpoint endpoint;                                 // 服务端点信息
+        // 一个候选实例
+        struct Candidate
+        {
+            Endpoint endpoint;  // 服务端点信息
+            uint32_t method_id; // 服务端发布的方法id，0表示未发布
+            double load;        // 按权重归一化的负载，越小越优先，旧格式的方法节点为0
+        };
+        // 服务端注册了实例节点时每个实例一项，否则只有方法节点中的一项
+        std::vector<Candidate> candidates;
         std::chrono::steady_clock::time_point expire_time; // 过期时间
         bool IsExpired() const
         {
             return std::chrono::steady_clock::now() > expire_time;
         }
     };
+    // 带TTL的服务发现本地缓存，key为"服务名:方法名"，进程内所有channel共享
+    static std::mutex cache_mutex_;
+    static std::unordered_map<std::string, CachedEndpoint> endpoint_cache_;
 
-    void SendRequest(const ScopedFd &clientfd, const TheChat::RpcHeader &rpc_headers);
-    void ReceiveResponse(const ScopedFd &clientfd, google::protobuf::Message *response, CircuitBreaker &breaker);
+    // 同步调用：通过多路复用会话发送请求，等待按request_id匹配的响应，最多等待到deadline
+    RpcResult Invoke(const Endpoint &endpoint, const google::protobuf::MethodDescriptor *method,
+                     const google::protobuf::Message &request, CallOptions &options,
+                     std::chrono::steady_clock::time_point deadline, bool inherited);
+    // 一次未完成的异步调用
+    struct AsyncCall;
+    // 异步调用完成：写入响应或失败原因，记录熔断，再执行完成回调
+    void FinishAsyncCall(const std::shared_ptr<AsyncCall> &call, RpcResult &&result);
+    // 调用失败：写入控制器，按错误类型记录熔断，服务端不可用时删除缓存的端点
+    void OnCallFailed(const google::protobuf::MethodDescriptor *method, TheRpcController *controller,
+                      CircuitBreaker &breaker, RpcErrorType type, const std::string &reason);
+    // 本次调用的截止时间：取控制器设置的超时时间和所在RPC方法剩余时间中较早的一个，返回是否取了后者
+    static bool ResolveDeadline(TheRpcController *controller, TheRpcController::Clock::time_point inherited_deadline,
+                                TheRpcController::Clock::time_point *deadline);
+    // 获取端点的会话，同一端点上的少量长连接轮流承载所有调用
+    std::shared_ptr<RpcSession> GetSession(const Endpoint &endpoint);
     constexpr bool ShouldTriggerCircuitBreak(RpcErrorType type);
     std::unordered_map<std::string, CircuitBreaker> breaker_map_;
     std::mutex breaker_mutex_;
-    Endpoint GetServiceEndpoint(const std::string &service, const std::string &method);
+    Endpoint GetServiceEndpoint(const std::string &service, const std::string &method, uint32_t &method_id);
+    // 服务端不可用或正在摘流量时删除缓存的端点，下次调用重新做服务发现，不必等TTL过期
+    void InvalidateEndpoint(const std::string &service, const std::string &method);
+    // host是否为本机的地址，本机的服务端发布了Unix域套接字时改用它连接
+    static bool IsLocalHost(const std::string &host);
+    // 由节点中发布的地址和套接字路径得到端点，服务端同机时按配置改走共享内存或Unix域套接字
+    Endpoint MakeEndpoint(const std::string &ip, uint16_t port, const std::string &unix_path, const std::string &shm_path) const;
+    // 读取方法节点下各实例节点发布的端点和负载，没有实例节点时返回false，实例都在摘流量(权重为0)时抛出SERVICE_UNAVAILABLE
+    bool LoadInstances(const std::string &path, CachedEndpoint &entry);
+    // 随机取两个候选实例，选负载较低的一个，避免所有请求方同时涌向同一个负载最低的实例
+    static const CachedEndpoint::Candidate &PickCandidate(const CachedEndpoint &entry);
+
+    struct SessionGroup
+    {
+        std::vector<std::shared_ptr<RpcSession>> sessions;
+        size_t next = 0; // 轮询下标
+    };
+    // 每个端点的会话数
+    size_t sessions_per_endpoint_;
+    // 允许协商的最高协议版本
+    uint8_t max_protocol_;
+    // 向服务端提出的压缩算法和压缩阈值
+    CompressionType compression_;
+    size_t compress_threshold_;
+    // 服务端与本进程同机且发布了Unix域套接字时优先使用
+    bool prefer_unix_;
+    // 服务端与本进程同机且发布了共享内存传输时优先使用，优先于Unix域套接字
+    bool prefer_shm_;
+    // 会话读线程是否使用io_uring
+    bool use_io_uring_;
+    // 实例节点中发布的负载在本地缓存的时间，过期后重新读取
+    std::chrono::milliseconds load_cache_ttl_;
+    std::unordered_map<Endpoint, SessionGroup> session_map_;
+    std::mutex session_mutex_;
 
 };
 
@@ -8,28 +8,18 @@ public:
     using Callback = std::function<void()>;
     RpcClosure(muduo::net::EventLoop *loop, Callback &&cb)
         : loop_(loop),
-          callback_(std::move(cb)),
-          destroyed_(std::make_shared<bool>(false)) {}
-
-    ~RpcClosure() override
-    {
-        *destroyed_ = true;
-    }
+          callback_(std::move(cb)) {}
 
     void Run() override
     {
-        // 使用weak_ptr检测对象是否已被销毁
-        auto destroyed = destroyed_;
+        // 回调被移交给loop_持有，Run之后立即销毁自身也是安全的
         if (loop_->isInLoopThread())
         {
-            if (!*destroyed)
-                callback_();
+            callback_();
         }
         else
         {
-            loop_->queueInLoop([this, destroyed]
-                               {
-                    if (!*destroyed) callback_(); });
+            loop_->queueInLoop(std::move(callback_));
         }
         delete this;
     }
@@ -37,7 +27,6 @@ public:
 private:
     muduo::net::EventLoop *loop_;
     Callback callback_;
-    std::shared_ptr<bool> destroyed_; // 用于检测回调是否有效
 };
 
-#endif
\ No newline at end of file
+#endif
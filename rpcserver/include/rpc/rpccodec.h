@@ -0,0 +1,143 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 帧编解码工具，直接在接收缓冲区上就地解析，避免载荷字段的多次拷贝
+ */
+#ifndef RPCCODEC_H
+#define RPCCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <google/protobuf/message.h>
+#include "compression.h"
+
+/*
+ * v2帧格式(网络字节序)：
+ *   | magic(2) | version(1) | flags(1) | request_id(8) | method_id(4) | meta_len(4) | body_len(4) |
+ *   | meta(RpcMeta, meta_len字节) | body(请求或响应的原始字节, body_len字节) |
+ * v1帧以4字节长度开头，合法长度的首字节不可能是magic的首字节，服务端据此逐帧识别协议版本
+ */
+constexpr uint16_t kFrameMagic = 0x5250; // "RP"
+constexpr uint8_t kProtocolV1 = 1;
+constexpr uint8_t kProtocolV2 = 2;
+constexpr size_t kFrameHeaderSize = 24;
+// 单帧扩展头和消息体的总长度上限
+constexpr uint32_t kMaxFrameBodySize = 64 * 1024 * 1024;
+
+// 帧标志位
+enum FrameFlag : uint8_t
+{
+    kFlagResponse = 0x01,     // 响应帧
+    kFlagStream = 0x02,       // 流帧，request_id即流id
+    kFlagStreamOpen = 0x04,   // 流的首帧，携带方法和第一个请求消息
+    kFlagStreamEnd = 0x08,    // 发送方结束发送；服务端的结束帧带最终响应或错误扩展头
+    kFlagWindowUpdate = 0x10, // 流量控制帧，扩展头的window为新授予对端的消息数
+    kFlagCompressed = 0x20,   // 消息体已压缩，格式见Compression::Compress
+};
+
+// 流每个方向的初始发送额度(消息数)，接收方每消费一半额度后把已消费的数量授予对端
+constexpr uint32_t kStreamWindow = 64;
+
+// v2固定帧头
+struct FrameHeader
+{
+    uint8_t version = kProtocolV2;
+    uint8_t flags = 0;
+    uint64_t request_id = 0;
+    uint32_t method_id = 0; // 0表示按扩展头中的名字分发
+    uint32_t meta_len = 0;
+    uint32_t body_len = 0;
+};
+
+/**
+ * @brief 计算方法id，对方法全名(Service.Method)做FNV-1a哈希，服务端和客户端无需协调即可得到相同结果
+ * @param full_name 方法全名
+ * @return 非0的方法id，0保留给按名字分发的请求
+ */
+uint32_t MethodId(const std::string &full_name);
+
+// 缓冲区开头是否为v2帧，至少需要2个字节才能判断
+bool IsFrameV2(const char *data, size_t len);
+
+// 解码固定帧头，data至少有kFrameHeaderSize字节，magic或版本不符时返回false
+bool DecodeFrameHeader(const char *data, FrameHeader *header);
+
+/**
+ * @brief 编码一个完整的v2帧并追加到out，扩展头和消息体直接序列化到输出中，不经过中间拷贝
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 消息体，为nullptr时不带消息体
+ * @param out 输出
+ * @return 序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const google::protobuf::MessageLite *body, std::string *out);
+
+/**
+ * @brief 编码一个消息体已经序列化好的v2帧并追加到out
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 序列化好的消息体
+ * @param body_len 消息体长度
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const char *body, size_t body_len, std::string *out);
+
+/**
+ * @brief 编码v2帧，连接上协商了压缩且消息体不小于阈值时压缩消息体并置kFlagCompressed
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 消息体，为nullptr时不带消息体
+ * @param compression 连接上协商的压缩算法，NONE时与不带压缩参数的版本相同
+ * @param threshold 压缩阈值，单位字节
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const google::protobuf::MessageLite *body, CompressionType compression, size_t threshold,
+                 std::string *out);
+
+/**
+ * @brief 编码消息体已经序列化好的v2帧，连接上协商了压缩且消息体不小于阈值时压缩消息体并置kFlagCompressed
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 序列化好的消息体
+ * @param body_len 消息体长度
+ * @param compression 连接上协商的压缩算法，NONE时与不带压缩参数的版本相同
+ * @param threshold 压缩阈值，单位字节
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const char *body, size_t body_len, CompressionType compression, size_t threshold,
+                 std::string *out);
+
+/**
+ * @brief 取得帧的消息体，压缩的消息体解压到storage中
+ * @param header 固定帧头
+ * @param body 帧中的消息体
+ * @param storage 解压缓冲区，消息体未压缩时不使用
+ * @param data 输出，消息体的起始位置
+ * @param len 输出，消息体长度
+ * @return 解压失败返回false
+ */
+bool DecodeFrameBody(const FrameHeader &header, const char *body, std::string *storage,
+                     const char **data, size_t *len);
+
+/**
+ * @brief 就地解析带载荷字段的头部消息，载荷字段不拷贝，只返回其在data中的位置
+ * @param data 头部消息的序列化数据，通常直接指向muduo::net::Buffer::peek()
+ * @param len 数据长度
+ * @param payload_field 载荷字段的字段号，必须是bytes/string类型
+ * @param header 输出，除载荷字段外的其余字段
+ * @param payload 输出，载荷在data中的起始位置，不存在时为nullptr
+ * @param payload_len 输出，载荷长度
+ * @return 解析成功返回true
+ */
+bool ParseInPlace(const char *data, size_t len, int payload_field,
+                  google::protobuf::Message *header, const char **payload, size_t *payload_len);
+
+#endif
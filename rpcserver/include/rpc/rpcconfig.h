@@ -17,7 +17,15 @@ public:
     void LoadConfigFile(std::string &config_file);
     // 查询配置项信息
     std::string Load(const std::string &key);
+    // 查询整数配置项，不存在或非法时返回默认值
+    int LoadInt(const std::string &key, int default_value);
+    // 查询布尔配置项(true/false/1/0)，不存在时返回默认值
+    bool LoadBool(const std::string &key, bool default_value);
+    // 查询服务级整数配置项，依次查找"服务名.key"和"key"，都不存在时返回默认值
+    int LoadServiceInt(const std::string &service, const std::string &key, int default_value);
     std::unordered_set<std::string> LoadService();
+    // 全部配置项，加载完成后只读
+    const std::unordered_map<std::string, std::string> &LoadAll() const;
 
 private:
     std::unordered_map<std::string, std::string> config_map_;
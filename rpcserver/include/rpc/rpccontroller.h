@@ -11,10 +11,46 @@
 #include <string>
 #include "muduo/net/TcpConnection.h"
 #include <mutex>
+#include <chrono>
+#include <memory>
+
+class RpcStream;
+
+// 请求优先级，数值即线上取值，未设置时为NORMAL
+enum class RpcPriority : uint32_t
+{
+    NORMAL = 0, // 普通请求
+    HIGH = 1,   // 延迟敏感的请求，优先执行
+    LOW = 2     // 批处理和后台请求，资源紧张时让路
+};
 
 class TheRpcController : public google::protobuf::RpcController, public std::enable_shared_from_this<TheRpcController>
 {
 public:
+    using Clock = std::chrono::steady_clock;
+
+    // 在作用域内设置当前线程正在执行的RPC方法的截止时间，方法内发起的嵌套调用继承剩余时间
+    class DeadlineScope
+    {
+    public:
+        explicit DeadlineScope(Clock::time_point deadline);
+        ~DeadlineScope();
+
+    private:
+        Clock::time_point saved_;
+    };
+
+    // 在作用域内设置当前线程正在执行的RPC方法所属连接的IO线程，业务线程中的协程无法回到线程池时在这里恢复
+    class LoopScope
+    {
+    public:
+        explicit LoopScope(muduo::net::EventLoop *loop);
+        ~LoopScope();
+
+    private:
+        muduo::net::EventLoop *saved_;
+    };
+
     TheRpcController();
     void Reset();
     bool Failed() const;
@@ -27,6 +63,23 @@ public:
     bool IsCanceled() const;
     void NotifyOnCancel(google::protobuf::Closure *callback);
 
+    // 客户端：本次调用的超时时间，单位毫秒，0表示使用默认值
+    void SetTimeout(int64_t timeout_ms);
+    int64_t Timeout() const;
+    // 服务端：请求的截止时间，请求未携带超时时间时为Clock::time_point::max()
+    void SetDeadline(Clock::time_point deadline);
+    Clock::time_point Deadline() const;
+    // 当前线程正在执行的RPC方法的截止时间，不在RPC方法中时为Clock::time_point::max()
+    static Clock::time_point CurrentDeadline();
+    // 当前线程正在执行的RPC方法所属连接的IO线程，不在RPC方法中时为nullptr
+    static muduo::net::EventLoop *CurrentLoop();
+    // 请求优先级，客户端设置后随请求发送，服务端为收到的优先级
+    void SetPriority(RpcPriority priority);
+    RpcPriority Priority() const;
+    // 服务端：流式调用的流，普通调用为nullptr
+    void SetStream(std::shared_ptr<RpcStream> stream);
+    RpcStream *Stream() const;
+
 private:
     bool failed_;          // RPC方法执行过程中的状态
     bool canceled_;        // RPC方法执行过程中是否被取消
@@ -34,6 +87,10 @@ private:
     mutable std::mutex mutex_;
     google::protobuf::Closure *cancel_callback_;
     std::weak_ptr<muduo::net::TcpConnection> connection_;
+    int64_t timeout_ms_;
+    Clock::time_point deadline_;
+    RpcPriority priority_;
+    std::shared_ptr<RpcStream> stream_;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 协程形式的RPC方法：方法体中co_await下游调用，挂起期间不占用线程，协程结束时执行done
+ */
+#ifndef RPCCOROUTINE_H
+#define RPCCOROUTINE_H
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <google/protobuf/service.h>
+#include <muduo/net/EventLoop.h>
+#include "rpcchannel.h"
+#include "rpccontroller.h"
+#include "workerpool.h"
+
+/*
+ * 用法：服务的虚函数转调一个返回RpcTask、参数相同的协程，协程结束(co_return、执行完或抛出异常)时自动执行done，
+ * 抛出的异常写入controller的失败原因。
+ *
+ *   void GetFriends(RpcController *controller, const Req *request, Resp *response, Closure *done) override
+ *   {
+ *       GetFriendsAsync(controller, request, response, done);
+ *   }
+ *   RpcTask GetFriendsAsync(RpcController *controller, const Req *request, Resp *response, Closure *done)
+ *   {
+ *       TheRpcController user_controller;
+ *       UserInfo user;
+ *       co_await RpcCall(channel_, UserServiceRpc::descriptor()->FindMethodByName("GetUser"),
+ *                        &user_controller, &user_request, &user);
+ *       ...
+ *   }
+ *
+ * 协程在业务线程中开始执行，遇到co_await时发出请求后返回，业务线程去执行其他请求；
+ * 响应到达后协程回到原来的业务线程池(没有业务线程时回到原来的IO线程)继续执行，并继承所在RPC方法的截止时间。
+ * 协程的参数按值保存在协程帧中，request、response等指针指向的对象由框架保证在done执行前有效。
+ */
+class RpcTask
+{
+public:
+    class promise_type
+    {
+    public:
+        // 从协程参数中找出控制器和done
+        template <typename... Args>
+        explicit promise_type(Args &...args)
+        {
+            (Capture(args), ...);
+        }
+
+        RpcTask get_return_object() noexcept { return RpcTask(); }
+        // 立即开始执行，第一个co_await之前的部分仍在调用线程中完成
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        // 先销毁协程帧，再执行done，done之后框架会释放请求和响应
+        auto final_suspend() noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    google::protobuf::Closure *done = handle.promise().done_;
+                    handle.destroy();
+                    if (done)
+                    {
+                        done->Run();
+                    }
+                }
+                void await_resume() const noexcept {}
+            };
+            return FinalAwaiter();
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept
+        {
+            if (!controller_)
+            {
+                return;
+            }
+            try
+            {
+                throw;
+            }
+            catch (const std::exception &e)
+            {
+                controller_->SetFailed(std::string("System error: ") + e.what());
+            }
+            catch (...)
+            {
+                controller_->SetFailed("Unknown system error");
+            }
+        }
+
+    private:
+        template <typename T>
+        void Capture(T *ptr)
+        {
+            if constexpr (std::is_base_of_v<google::protobuf::RpcController, T>)
+            {
+                controller_ = ptr;
+            }
+            else if constexpr (std::is_base_of_v<google::protobuf::Closure, T>)
+            {
+                done_ = ptr;
+            }
+        }
+        template <typename T>
+        void Capture(const T &)
+        {
+        }
+
+        google::protobuf::RpcController *controller_ = nullptr;
+        google::protobuf::Closure *done_ = nullptr;
+    };
+};
+
+/*
+ * 协程中等待一次下游调用：co_await RpcCall(...)，恢复后结果在controller和response中。
+ * controller、request和response必须在co_await结束前有效，通常是协程中的局部变量。
+ */
+class RpcCall
+{
+public:
+    /**
+     * @brief 构造函数
+     * @param channel 用于调用的channel
+     * @param method 要远程调用的方法
+     * @param controller rpc控制对象，失败原因写入其中
+     * @param request 请求参数
+     * @param response 响应，成功时填入
+     */
+    RpcCall(TheRpcChannel &channel, const google::protobuf::MethodDescriptor *method, TheRpcController *controller,
+            const google::protobuf::Message *request, google::protobuf::Message *response);
+
+    bool await_ready() const noexcept { return false; }
+    // 发出请求，调用已在本线程中完成(如熔断或服务发现失败)时返回false，不挂起
+    bool await_suspend(std::coroutine_handle<> handle);
+    void await_resume() const noexcept {}
+
+private:
+    // 调用完成，在会话读线程或超时定时器线程中执行
+    void OnComplete();
+    // 回到发起调用的业务线程池或IO线程恢复协程
+    void Resume();
+
+    static constexpr int kPending = 0;   // 请求已发出
+    static constexpr int kSuspended = 1; // 协程已挂起
+    static constexpr int kCompleted = 2; // 调用已完成
+
+    TheRpcChannel &channel_;
+    const google::protobuf::MethodDescriptor *method_;
+    TheRpcController *controller_;
+    const google::protobuf::Message *request_;
+    google::protobuf::Message *response_;
+    std::coroutine_handle<> handle_;
+    std::atomic<int> state_{kPending};
+    // 发起调用时所在的业务线程池，以及所在或所属连接的IO线程，优先提交回线程池，都为空时在完成调用的线程中恢复
+    WorkerPool *pool_ = nullptr;
+    muduo::net::EventLoop *loop_ = nullptr;
+    // 所在RPC方法的截止时间，恢复后的代码继续继承
+    TheRpcController::Clock::time_point deadline_;
+};
+
+#endif
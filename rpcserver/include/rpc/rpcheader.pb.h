@@ -54,6 +54,12 @@ extern ResponseHeaderDefaultTypeInternal _ResponseHeader_default_instance_;
 class RpcHeader;
 struct RpcHeaderDefaultTypeInternal;
 extern RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+class RpcMeta;
+struct RpcMetaDefaultTypeInternal;
+extern RpcMetaDefaultTypeInternal _RpcMeta_default_instance_;
+class RpcResponseHeader;
+struct RpcResponseHeaderDefaultTypeInternal;
+extern RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
 class ServiceEndpoint;
 struct ServiceEndpointDefaultTypeInternal;
 extern ServiceEndpointDefaultTypeInternal _ServiceEndpoint_default_instance_;
@@ -65,6 +71,8 @@ PROTOBUF_NAMESPACE_OPEN
 template<> ::TheChat::RequestHeader* Arena::CreateMaybeMessage<::TheChat::RequestHeader>(Arena*);
 template<> ::TheChat::ResponseHeader* Arena::CreateMaybeMessage<::TheChat::ResponseHeader>(Arena*);
 template<> ::TheChat::RpcHeader* Arena::CreateMaybeMessage<::TheChat::RpcHeader>(Arena*);
+template<> ::TheChat::RpcMeta* Arena::CreateMaybeMessage<::TheChat::RpcMeta>(Arena*);
+template<> ::TheChat::RpcResponseHeader* Arena::CreateMaybeMessage<::TheChat::RpcResponseHeader>(Arena*);
 template<> ::TheChat::ServiceEndpoint* Arena::CreateMaybeMessage<::TheChat::ServiceEndpoint>(Arena*);
 template<> ::TheChat::ServiceMeta* Arena::CreateMaybeMessage<::TheChat::ServiceMeta>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -196,6 +204,12 @@ class RpcHeader final :
     kServiceNameFieldNumber = 1,
     kMethodNameFieldNumber = 2,
     kParamsFieldNumber = 3,
+    kRequestIdFieldNumber = 5,
+    kKeepAliveFieldNumber = 4,
+    kMaxProtocolFieldNumber = 6,
+    kTimeoutMsFieldNumber = 7,
+    kPriorityFieldNumber = 8,
+    kCompressionFieldNumber = 9,
   };
   // string service_name = 1;
   void clear_service_name();
@@ -239,6 +253,60 @@ class RpcHeader final :
   std::string* _internal_mutable_params();
   public:
 
+  // uint64 request_id = 5;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // bool keep_alive = 4;
+  void clear_keep_alive();
+  bool keep_alive() const;
+  void set_keep_alive(bool value);
+  private:
+  bool _internal_keep_alive() const;
+  void _internal_set_keep_alive(bool value);
+  public:
+
+  // uint32 max_protocol = 6;
+  void clear_max_protocol();
+  uint32_t max_protocol() const;
+  void set_max_protocol(uint32_t value);
+  private:
+  uint32_t _internal_max_protocol() const;
+  void _internal_set_max_protocol(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 7;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // uint32 priority = 8;
+  void clear_priority();
+  uint32_t priority() const;
+  void set_priority(uint32_t value);
+  private:
+  uint32_t _internal_priority() const;
+  void _internal_set_priority(uint32_t value);
+  public:
+
+  // uint32 compression = 9;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:TheChat.RpcHeader)
  private:
   class _Internal;
@@ -250,6 +318,12 @@ class RpcHeader final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr params_;
+    uint64_t request_id_;
+    bool keep_alive_;
+    uint32_t max_protocol_;
+    uint32_t timeout_ms_;
+    uint32_t priority_;
+    uint32_t compression_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -257,24 +331,24 @@ class RpcHeader final :
 };
 // -------------------------------------------------------------------
 
-class ServiceMeta final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ServiceMeta) */ {
+class RpcResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.RpcResponseHeader) */ {
  public:
-  inline ServiceMeta() : ServiceMeta(nullptr) {}
-  ~ServiceMeta() override;
-  explicit PROTOBUF_CONSTEXPR ServiceMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RpcResponseHeader() : RpcResponseHeader(nullptr) {}
+  ~RpcResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServiceMeta(const ServiceMeta& from);
-  ServiceMeta(ServiceMeta&& from) noexcept
-    : ServiceMeta() {
+  RpcResponseHeader(const RpcResponseHeader& from);
+  RpcResponseHeader(RpcResponseHeader&& from) noexcept
+    : RpcResponseHeader() {
     *this = ::std::move(from);
   }
 
-  inline ServiceMeta& operator=(const ServiceMeta& from) {
+  inline RpcResponseHeader& operator=(const RpcResponseHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ServiceMeta& operator=(ServiceMeta&& from) noexcept {
+  inline RpcResponseHeader& operator=(RpcResponseHeader&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -297,20 +371,20 @@ class ServiceMeta final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ServiceMeta& default_instance() {
+  static const RpcResponseHeader& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ServiceMeta* internal_default_instance() {
-    return reinterpret_cast<const ServiceMeta*>(
-               &_ServiceMeta_default_instance_);
+  static inline const RpcResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const RpcResponseHeader*>(
+               &_RpcResponseHeader_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     1;
 
-  friend void swap(ServiceMeta& a, ServiceMeta& b) {
+  friend void swap(RpcResponseHeader& a, RpcResponseHeader& b) {
     a.Swap(&b);
   }
-  inline void Swap(ServiceMeta* other) {
+  inline void Swap(RpcResponseHeader* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -323,7 +397,7 @@ class ServiceMeta final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ServiceMeta* other) {
+  void UnsafeArenaSwap(RpcResponseHeader* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -331,14 +405,14 @@ class ServiceMeta final :
 
   // implements Message ----------------------------------------------
 
-  ServiceMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ServiceMeta>(arena);
+  RpcResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcResponseHeader>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ServiceMeta& from);
+  void CopyFrom(const RpcResponseHeader& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ServiceMeta& from) {
-    ServiceMeta::MergeImpl(*this, from);
+  void MergeFrom( const RpcResponseHeader& from) {
+    RpcResponseHeader::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -356,15 +430,15 @@ class ServiceMeta final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ServiceMeta* other);
+  void InternalSwap(RpcResponseHeader* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "TheChat.ServiceMeta";
+    return "TheChat.RpcResponseHeader";
   }
   protected:
-  explicit ServiceMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -378,43 +452,78 @@ class ServiceMeta final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIpFieldNumber = 1,
-    kPortFieldNumber = 2,
-    kKeepAliveFieldNumber = 3,
+    kErrorTextFieldNumber = 3,
+    kResponseFieldNumber = 4,
+    kRequestIdFieldNumber = 1,
+    kErrorCodeFieldNumber = 2,
+    kProtocolFieldNumber = 5,
+    kCompressionFieldNumber = 6,
   };
-  // string ip = 1;
-  void clear_ip();
-  const std::string& ip() const;
+  // string error_text = 3;
+  void clear_error_text();
+  const std::string& error_text() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ip(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ip();
-  PROTOBUF_NODISCARD std::string* release_ip();
-  void set_allocated_ip(std::string* ip);
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
   private:
-  const std::string& _internal_ip() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
-  std::string* _internal_mutable_ip();
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
   public:
 
-  // int32 port = 2;
-  void clear_port();
-  int32_t port() const;
-  void set_port(int32_t value);
+  // bytes response = 4;
+  void clear_response();
+  const std::string& response() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_response(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_response();
+  PROTOBUF_NODISCARD std::string* release_response();
+  void set_allocated_response(std::string* response);
   private:
-  int32_t _internal_port() const;
-  void _internal_set_port(int32_t value);
+  const std::string& _internal_response() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_response(const std::string& value);
+  std::string* _internal_mutable_response();
   public:
 
-  // bool keep_alive = 3;
-  void clear_keep_alive();
-  bool keep_alive() const;
-  void set_keep_alive(bool value);
+  // uint64 request_id = 1;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
   private:
-  bool _internal_keep_alive() const;
-  void _internal_set_keep_alive(bool value);
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:TheChat.ServiceMeta)
+  // int32 error_code = 2;
+  void clear_error_code();
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
+  private:
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
+  public:
+
+  // uint32 protocol = 5;
+  void clear_protocol();
+  uint32_t protocol() const;
+  void set_protocol(uint32_t value);
+  private:
+  uint32_t _internal_protocol() const;
+  void _internal_set_protocol(uint32_t value);
+  public:
+
+  // uint32 compression = 6;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.RpcResponseHeader)
  private:
   class _Internal;
 
@@ -422,9 +531,12 @@ class ServiceMeta final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
-    int32_t port_;
-    bool keep_alive_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr response_;
+    uint64_t request_id_;
+    int32_t error_code_;
+    uint32_t protocol_;
+    uint32_t compression_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -432,24 +544,24 @@ class ServiceMeta final :
 };
 // -------------------------------------------------------------------
 
-class RequestHeader final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.RequestHeader) */ {
+class RpcMeta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.RpcMeta) */ {
  public:
-  inline RequestHeader() : RequestHeader(nullptr) {}
-  ~RequestHeader() override;
-  explicit PROTOBUF_CONSTEXPR RequestHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RpcMeta() : RpcMeta(nullptr) {}
+  ~RpcMeta() override;
+  explicit PROTOBUF_CONSTEXPR RpcMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RequestHeader(const RequestHeader& from);
-  RequestHeader(RequestHeader&& from) noexcept
-    : RequestHeader() {
+  RpcMeta(const RpcMeta& from);
+  RpcMeta(RpcMeta&& from) noexcept
+    : RpcMeta() {
     *this = ::std::move(from);
   }
 
-  inline RequestHeader& operator=(const RequestHeader& from) {
+  inline RpcMeta& operator=(const RpcMeta& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RequestHeader& operator=(RequestHeader&& from) noexcept {
+  inline RpcMeta& operator=(RpcMeta&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -472,20 +584,20 @@ class RequestHeader final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const RequestHeader& default_instance() {
+  static const RpcMeta& default_instance() {
     return *internal_default_instance();
   }
-  static inline const RequestHeader* internal_default_instance() {
-    return reinterpret_cast<const RequestHeader*>(
-               &_RequestHeader_default_instance_);
+  static inline const RpcMeta* internal_default_instance() {
+    return reinterpret_cast<const RpcMeta*>(
+               &_RpcMeta_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(RequestHeader& a, RequestHeader& b) {
+  friend void swap(RpcMeta& a, RpcMeta& b) {
     a.Swap(&b);
   }
-  inline void Swap(RequestHeader* other) {
+  inline void Swap(RpcMeta* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -498,7 +610,7 @@ class RequestHeader final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RequestHeader* other) {
+  void UnsafeArenaSwap(RpcMeta* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -506,14 +618,14 @@ class RequestHeader final :
 
   // implements Message ----------------------------------------------
 
-  RequestHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<RequestHeader>(arena);
+  RpcMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcMeta>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const RequestHeader& from);
+  void CopyFrom(const RpcMeta& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const RequestHeader& from) {
-    RequestHeader::MergeImpl(*this, from);
+  void MergeFrom( const RpcMeta& from) {
+    RpcMeta::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -531,15 +643,15 @@ class RequestHeader final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RequestHeader* other);
+  void InternalSwap(RpcMeta* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "TheChat.RequestHeader";
+    return "TheChat.RpcMeta";
   }
   protected:
-  explicit RequestHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -553,33 +665,103 @@ class RequestHeader final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kContentFieldNumber = 2,
-    kMessageIdFieldNumber = 1,
+    kServiceNameFieldNumber = 1,
+    kMethodNameFieldNumber = 2,
+    kErrorTextFieldNumber = 4,
+    kErrorCodeFieldNumber = 3,
+    kTimeoutMsFieldNumber = 5,
+    kPriorityFieldNumber = 6,
+    kWindowFieldNumber = 7,
+    kCompressionFieldNumber = 8,
   };
-  // bytes content = 2;
-  void clear_content();
-  const std::string& content() const;
+  // string service_name = 1;
+  void clear_service_name();
+  const std::string& service_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_content(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_content();
-  PROTOBUF_NODISCARD std::string* release_content();
-  void set_allocated_content(std::string* content);
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
   private:
-  const std::string& _internal_content() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
-  std::string* _internal_mutable_content();
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
   public:
 
-  // int32 message_id = 1;
-  void clear_message_id();
-  int32_t message_id() const;
-  void set_message_id(int32_t value);
+  // string method_name = 2;
+  void clear_method_name();
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
   private:
-  int32_t _internal_message_id() const;
-  void _internal_set_message_id(int32_t value);
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
   public:
 
-  // @@protoc_insertion_point(class_scope:TheChat.RequestHeader)
+  // string error_text = 4;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // int32 error_code = 3;
+  void clear_error_code();
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
+  private:
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
+  public:
+
+  // uint32 timeout_ms = 5;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // uint32 priority = 6;
+  void clear_priority();
+  uint32_t priority() const;
+  void set_priority(uint32_t value);
+  private:
+  uint32_t _internal_priority() const;
+  void _internal_set_priority(uint32_t value);
+  public:
+
+  // uint32 window = 7;
+  void clear_window();
+  uint32_t window() const;
+  void set_window(uint32_t value);
+  private:
+  uint32_t _internal_window() const;
+  void _internal_set_window(uint32_t value);
+  public:
+
+  // uint32 compression = 8;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.RpcMeta)
  private:
   class _Internal;
 
@@ -587,8 +769,14 @@ class RequestHeader final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-    int32_t message_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    int32_t error_code_;
+    uint32_t timeout_ms_;
+    uint32_t priority_;
+    uint32_t window_;
+    uint32_t compression_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -596,24 +784,24 @@ class RequestHeader final :
 };
 // -------------------------------------------------------------------
 
-class ResponseHeader final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ResponseHeader) */ {
+class ServiceMeta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ServiceMeta) */ {
  public:
-  inline ResponseHeader() : ResponseHeader(nullptr) {}
-  ~ResponseHeader() override;
-  explicit PROTOBUF_CONSTEXPR ResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ServiceMeta() : ServiceMeta(nullptr) {}
+  ~ServiceMeta() override;
+  explicit PROTOBUF_CONSTEXPR ServiceMeta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ResponseHeader(const ResponseHeader& from);
-  ResponseHeader(ResponseHeader&& from) noexcept
-    : ResponseHeader() {
+  ServiceMeta(const ServiceMeta& from);
+  ServiceMeta(ServiceMeta&& from) noexcept
+    : ServiceMeta() {
     *this = ::std::move(from);
   }
 
-  inline ResponseHeader& operator=(const ResponseHeader& from) {
+  inline ServiceMeta& operator=(const ServiceMeta& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ResponseHeader& operator=(ResponseHeader&& from) noexcept {
+  inline ServiceMeta& operator=(ServiceMeta&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -636,20 +824,20 @@ class ResponseHeader final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ResponseHeader& default_instance() {
+  static const ServiceMeta& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ResponseHeader* internal_default_instance() {
-    return reinterpret_cast<const ResponseHeader*>(
-               &_ResponseHeader_default_instance_);
+  static inline const ServiceMeta* internal_default_instance() {
+    return reinterpret_cast<const ServiceMeta*>(
+               &_ServiceMeta_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(ResponseHeader& a, ResponseHeader& b) {
+  friend void swap(ServiceMeta& a, ServiceMeta& b) {
     a.Swap(&b);
   }
-  inline void Swap(ResponseHeader* other) {
+  inline void Swap(ServiceMeta* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -662,7 +850,7 @@ class ResponseHeader final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ResponseHeader* other) {
+  void UnsafeArenaSwap(ServiceMeta* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -670,14 +858,14 @@ class ResponseHeader final :
 
   // implements Message ----------------------------------------------
 
-  ResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ResponseHeader>(arena);
+  ServiceMeta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServiceMeta>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ResponseHeader& from);
+  void CopyFrom(const ServiceMeta& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ResponseHeader& from) {
-    ResponseHeader::MergeImpl(*this, from);
+  void MergeFrom( const ServiceMeta& from) {
+    ServiceMeta::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -695,15 +883,15 @@ class ResponseHeader final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ResponseHeader* other);
+  void InternalSwap(ServiceMeta* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "TheChat.ResponseHeader";
+    return "TheChat.ServiceMeta";
   }
   protected:
-  explicit ResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ServiceMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -717,33 +905,43 @@ class ResponseHeader final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kContentFieldNumber = 2,
-    kMessageIdFieldNumber = 1,
+    kIpFieldNumber = 1,
+    kPortFieldNumber = 2,
+    kKeepAliveFieldNumber = 3,
   };
-  // bytes content = 2;
-  void clear_content();
-  const std::string& content() const;
+  // string ip = 1;
+  void clear_ip();
+  const std::string& ip() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_content(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_content();
-  PROTOBUF_NODISCARD std::string* release_content();
-  void set_allocated_content(std::string* content);
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
   private:
-  const std::string& _internal_content() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
-  std::string* _internal_mutable_content();
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
   public:
 
-  // int32 message_id = 1;
-  void clear_message_id();
-  int32_t message_id() const;
-  void set_message_id(int32_t value);
+  // int32 port = 2;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
   private:
-  int32_t _internal_message_id() const;
-  void _internal_set_message_id(int32_t value);
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:TheChat.ResponseHeader)
+  // bool keep_alive = 3;
+  void clear_keep_alive();
+  bool keep_alive() const;
+  void set_keep_alive(bool value);
+  private:
+  bool _internal_keep_alive() const;
+  void _internal_set_keep_alive(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.ServiceMeta)
  private:
   class _Internal;
 
@@ -751,8 +949,9 @@ class ResponseHeader final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-    int32_t message_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t port_;
+    bool keep_alive_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -760,24 +959,24 @@ class ResponseHeader final :
 };
 // -------------------------------------------------------------------
 
-class ServiceEndpoint final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ServiceEndpoint) */ {
+class RequestHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.RequestHeader) */ {
  public:
-  inline ServiceEndpoint() : ServiceEndpoint(nullptr) {}
-  ~ServiceEndpoint() override;
-  explicit PROTOBUF_CONSTEXPR ServiceEndpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RequestHeader() : RequestHeader(nullptr) {}
+  ~RequestHeader() override;
+  explicit PROTOBUF_CONSTEXPR RequestHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServiceEndpoint(const ServiceEndpoint& from);
-  ServiceEndpoint(ServiceEndpoint&& from) noexcept
-    : ServiceEndpoint() {
+  RequestHeader(const RequestHeader& from);
+  RequestHeader(RequestHeader&& from) noexcept
+    : RequestHeader() {
     *this = ::std::move(from);
   }
 
-  inline ServiceEndpoint& operator=(const ServiceEndpoint& from) {
+  inline RequestHeader& operator=(const RequestHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ServiceEndpoint& operator=(ServiceEndpoint&& from) noexcept {
+  inline RequestHeader& operator=(RequestHeader&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -800,20 +999,20 @@ class ServiceEndpoint final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ServiceEndpoint& default_instance() {
+  static const RequestHeader& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ServiceEndpoint* internal_default_instance() {
-    return reinterpret_cast<const ServiceEndpoint*>(
-               &_ServiceEndpoint_default_instance_);
+  static inline const RequestHeader* internal_default_instance() {
+    return reinterpret_cast<const RequestHeader*>(
+               &_RequestHeader_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(ServiceEndpoint& a, ServiceEndpoint& b) {
+  friend void swap(RequestHeader& a, RequestHeader& b) {
     a.Swap(&b);
   }
-  inline void Swap(ServiceEndpoint* other) {
+  inline void Swap(RequestHeader* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -826,7 +1025,7 @@ class ServiceEndpoint final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ServiceEndpoint* other) {
+  void UnsafeArenaSwap(RequestHeader* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -834,14 +1033,14 @@ class ServiceEndpoint final :
 
   // implements Message ----------------------------------------------
 
-  ServiceEndpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ServiceEndpoint>(arena);
+  RequestHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestHeader>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ServiceEndpoint& from);
+  void CopyFrom(const RequestHeader& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ServiceEndpoint& from) {
-    ServiceEndpoint::MergeImpl(*this, from);
+  void MergeFrom( const RequestHeader& from) {
+    RequestHeader::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -859,15 +1058,15 @@ class ServiceEndpoint final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ServiceEndpoint* other);
+  void InternalSwap(RequestHeader* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "TheChat.ServiceEndpoint";
+    return "TheChat.RequestHeader";
   }
   protected:
-  explicit ServiceEndpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RequestHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -881,121 +1080,983 @@ class ServiceEndpoint final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIpFieldNumber = 1,
-    kVersionFieldNumber = 4,
-    kPortFieldNumber = 2,
-    kWeightFieldNumber = 3,
+    kContentFieldNumber = 2,
+    kMessageIdFieldNumber = 1,
   };
-  // string ip = 1;
-  void clear_ip();
-  const std::string& ip() const;
+  // bytes content = 2;
+  void clear_content();
+  const std::string& content() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ip(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ip();
-  PROTOBUF_NODISCARD std::string* release_ip();
-  void set_allocated_ip(std::string* ip);
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
   private:
-  const std::string& _internal_ip() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
-  std::string* _internal_mutable_ip();
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
   public:
 
-  // string version = 4;
-  void clear_version();
-  const std::string& version() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_version(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_version();
-  PROTOBUF_NODISCARD std::string* release_version();
-  void set_allocated_version(std::string* version);
+  // int32 message_id = 1;
+  void clear_message_id();
+  int32_t message_id() const;
+  void set_message_id(int32_t value);
   private:
-  const std::string& _internal_version() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
-  std::string* _internal_mutable_version();
+  int32_t _internal_message_id() const;
+  void _internal_set_message_id(int32_t value);
   public:
 
-  // uint32 port = 2;
-  void clear_port();
-  uint32_t port() const;
-  void set_port(uint32_t value);
+  // @@protoc_insertion_point(class_scope:TheChat.RequestHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    int32_t message_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ResponseHeader) */ {
+ public:
+  inline ResponseHeader() : ResponseHeader(nullptr) {}
+  ~ResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR ResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResponseHeader(const ResponseHeader& from);
+  ResponseHeader(ResponseHeader&& from) noexcept
+    : ResponseHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline ResponseHeader& operator=(const ResponseHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResponseHeader& operator=(ResponseHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponseHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const ResponseHeader*>(
+               &_ResponseHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ResponseHeader& a, ResponseHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponseHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseHeader& from) {
+    ResponseHeader::MergeImpl(*this, from);
+  }
   private:
-  uint32_t _internal_port() const;
-  void _internal_set_port(uint32_t value);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponseHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.ResponseHeader";
+  }
+  protected:
+  explicit ResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentFieldNumber = 2,
+    kMessageIdFieldNumber = 1,
+  };
+  // bytes content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // int32 message_id = 1;
+  void clear_message_id();
+  int32_t message_id() const;
+  void set_message_id(int32_t value);
+  private:
+  int32_t _internal_message_id() const;
+  void _internal_set_message_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.ResponseHeader)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    int32_t message_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServiceEndpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TheChat.ServiceEndpoint) */ {
+ public:
+  inline ServiceEndpoint() : ServiceEndpoint(nullptr) {}
+  ~ServiceEndpoint() override;
+  explicit PROTOBUF_CONSTEXPR ServiceEndpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServiceEndpoint(const ServiceEndpoint& from);
+  ServiceEndpoint(ServiceEndpoint&& from) noexcept
+    : ServiceEndpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline ServiceEndpoint& operator=(const ServiceEndpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServiceEndpoint& operator=(ServiceEndpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServiceEndpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServiceEndpoint* internal_default_instance() {
+    return reinterpret_cast<const ServiceEndpoint*>(
+               &_ServiceEndpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ServiceEndpoint& a, ServiceEndpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServiceEndpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServiceEndpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServiceEndpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServiceEndpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServiceEndpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServiceEndpoint& from) {
+    ServiceEndpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServiceEndpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TheChat.ServiceEndpoint";
+  }
+  protected:
+  explicit ServiceEndpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 1,
+    kVersionFieldNumber = 4,
+    kUnixPathFieldNumber = 6,
+    kShmPathFieldNumber = 7,
+    kPortFieldNumber = 2,
+    kWeightFieldNumber = 3,
+    kMethodIdFieldNumber = 5,
+    kInflightFieldNumber = 8,
+    kCpuPermilleFieldNumber = 9,
+    kQueueDelayUsFieldNumber = 10,
+  };
+  // string ip = 1;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
+
+  // string version = 4;
+  void clear_version();
+  const std::string& version() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_version(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_version();
+  PROTOBUF_NODISCARD std::string* release_version();
+  void set_allocated_version(std::string* version);
+  private:
+  const std::string& _internal_version() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_version(const std::string& value);
+  std::string* _internal_mutable_version();
+  public:
+
+  // string unix_path = 6;
+  void clear_unix_path();
+  const std::string& unix_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_unix_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_unix_path();
+  PROTOBUF_NODISCARD std::string* release_unix_path();
+  void set_allocated_unix_path(std::string* unix_path);
+  private:
+  const std::string& _internal_unix_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_unix_path(const std::string& value);
+  std::string* _internal_mutable_unix_path();
+  public:
+
+  // string shm_path = 7;
+  void clear_shm_path();
+  const std::string& shm_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_shm_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_shm_path();
+  PROTOBUF_NODISCARD std::string* release_shm_path();
+  void set_allocated_shm_path(std::string* shm_path);
+  private:
+  const std::string& _internal_shm_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shm_path(const std::string& value);
+  std::string* _internal_mutable_shm_path();
+  public:
+
+  // uint32 port = 2;
+  void clear_port();
+  uint32_t port() const;
+  void set_port(uint32_t value);
+  private:
+  uint32_t _internal_port() const;
+  void _internal_set_port(uint32_t value);
+  public:
+
+  // uint32 weight = 3;
+  void clear_weight();
+  uint32_t weight() const;
+  void set_weight(uint32_t value);
+  private:
+  uint32_t _internal_weight() const;
+  void _internal_set_weight(uint32_t value);
+  public:
+
+  // uint32 method_id = 5;
+  void clear_method_id();
+  uint32_t method_id() const;
+  void set_method_id(uint32_t value);
+  private:
+  uint32_t _internal_method_id() const;
+  void _internal_set_method_id(uint32_t value);
+  public:
+
+  // uint32 inflight = 8;
+  void clear_inflight();
+  uint32_t inflight() const;
+  void set_inflight(uint32_t value);
+  private:
+  uint32_t _internal_inflight() const;
+  void _internal_set_inflight(uint32_t value);
+  public:
+
+  // uint32 cpu_permille = 9;
+  void clear_cpu_permille();
+  uint32_t cpu_permille() const;
+  void set_cpu_permille(uint32_t value);
+  private:
+  uint32_t _internal_cpu_permille() const;
+  void _internal_set_cpu_permille(uint32_t value);
+  public:
+
+  // uint32 queue_delay_us = 10;
+  void clear_queue_delay_us();
+  uint32_t queue_delay_us() const;
+  void set_queue_delay_us(uint32_t value);
+  private:
+  uint32_t _internal_queue_delay_us() const;
+  void _internal_set_queue_delay_us(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TheChat.ServiceEndpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr unix_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shm_path_;
+    uint32_t port_;
+    uint32_t weight_;
+    uint32_t method_id_;
+    uint32_t inflight_;
+    uint32_t cpu_permille_;
+    uint32_t queue_delay_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RpcHeader
+
+// string service_name = 1;
+inline void RpcHeader::clear_service_name() {
+  _impl_.service_name_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::service_name() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.service_name)
+  return _internal_service_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.service_name)
+}
+inline std::string* RpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.service_name)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_service_name() const {
+  return _impl_.service_name_.Get();
+}
+inline void RpcHeader::_internal_set_service_name(const std::string& value) {
+  
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_service_name() {
+  
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_service_name() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.service_name)
+  return _impl_.service_name_.Release();
+}
+inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.service_name)
+}
+
+// string method_name = 2;
+inline void RpcHeader::clear_method_name() {
+  _impl_.method_name_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::method_name() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.method_name)
+  return _internal_method_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.method_name)
+}
+inline std::string* RpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.method_name)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_method_name() const {
+  return _impl_.method_name_.Get();
+}
+inline void RpcHeader::_internal_set_method_name(const std::string& value) {
+  
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_method_name() {
+  
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_method_name() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.method_name)
+  return _impl_.method_name_.Release();
+}
+inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
+  if (method_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.method_name)
+}
+
+// bytes params = 3;
+inline void RpcHeader::clear_params() {
+  _impl_.params_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::params() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.params)
+  return _internal_params();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_params(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.params_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.params)
+}
+inline std::string* RpcHeader::mutable_params() {
+  std::string* _s = _internal_mutable_params();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.params)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_params() const {
+  return _impl_.params_.Get();
+}
+inline void RpcHeader::_internal_set_params(const std::string& value) {
+  
+  _impl_.params_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_params() {
+  
+  return _impl_.params_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_params() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.params)
+  return _impl_.params_.Release();
+}
+inline void RpcHeader::set_allocated_params(std::string* params) {
+  if (params != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.params_.SetAllocated(params, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.params_.IsDefault()) {
+    _impl_.params_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.params)
+}
+
+// bool keep_alive = 4;
+inline void RpcHeader::clear_keep_alive() {
+  _impl_.keep_alive_ = false;
+}
+inline bool RpcHeader::_internal_keep_alive() const {
+  return _impl_.keep_alive_;
+}
+inline bool RpcHeader::keep_alive() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.keep_alive)
+  return _internal_keep_alive();
+}
+inline void RpcHeader::_internal_set_keep_alive(bool value) {
+  
+  _impl_.keep_alive_ = value;
+}
+inline void RpcHeader::set_keep_alive(bool value) {
+  _internal_set_keep_alive(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.keep_alive)
+}
+
+// uint64 request_id = 5;
+inline void RpcHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.request_id)
+}
+
+// uint32 max_protocol = 6;
+inline void RpcHeader::clear_max_protocol() {
+  _impl_.max_protocol_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_max_protocol() const {
+  return _impl_.max_protocol_;
+}
+inline uint32_t RpcHeader::max_protocol() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.max_protocol)
+  return _internal_max_protocol();
+}
+inline void RpcHeader::_internal_set_max_protocol(uint32_t value) {
+  
+  _impl_.max_protocol_ = value;
+}
+inline void RpcHeader::set_max_protocol(uint32_t value) {
+  _internal_set_max_protocol(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.max_protocol)
+}
+
+// uint32 timeout_ms = 7;
+inline void RpcHeader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t RpcHeader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void RpcHeader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void RpcHeader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.timeout_ms)
+}
+
+// uint32 priority = 8;
+inline void RpcHeader::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t RpcHeader::priority() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.priority)
+  return _internal_priority();
+}
+inline void RpcHeader::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void RpcHeader::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.priority)
+}
+
+// uint32 compression = 9;
+inline void RpcHeader::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t RpcHeader::compression() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.compression)
+  return _internal_compression();
+}
+inline void RpcHeader::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcHeader::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.compression)
+}
+
+// -------------------------------------------------------------------
+
+// RpcResponseHeader
+
+// uint64 request_id = 1;
+inline void RpcResponseHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcResponseHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcResponseHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcResponseHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcResponseHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.request_id)
+}
+
+// int32 error_code = 2;
+inline void RpcResponseHeader::clear_error_code() {
+  _impl_.error_code_ = 0;
+}
+inline int32_t RpcResponseHeader::_internal_error_code() const {
+  return _impl_.error_code_;
+}
+inline int32_t RpcResponseHeader::error_code() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.error_code)
+  return _internal_error_code();
+}
+inline void RpcResponseHeader::_internal_set_error_code(int32_t value) {
+  
+  _impl_.error_code_ = value;
+}
+inline void RpcResponseHeader::set_error_code(int32_t value) {
+  _internal_set_error_code(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.error_code)
+}
 
-  // uint32 weight = 3;
-  void clear_weight();
-  uint32_t weight() const;
-  void set_weight(uint32_t value);
-  private:
-  uint32_t _internal_weight() const;
-  void _internal_set_weight(uint32_t value);
-  public:
+// string error_text = 3;
+inline void RpcResponseHeader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::error_text() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.error_text)
+}
+inline std::string* RpcResponseHeader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcResponseHeader.error_text)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcResponseHeader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_error_text() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcResponseHeader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcResponseHeader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcResponseHeader.error_text)
+}
 
-  // @@protoc_insertion_point(class_scope:TheChat.ServiceEndpoint)
- private:
-  class _Internal;
+// bytes response = 4;
+inline void RpcResponseHeader::clear_response() {
+  _impl_.response_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::response() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.response)
+  return _internal_response();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_response(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.response_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.response)
+}
+inline std::string* RpcResponseHeader::mutable_response() {
+  std::string* _s = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcResponseHeader.response)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_response() const {
+  return _impl_.response_.Get();
+}
+inline void RpcResponseHeader::_internal_set_response(const std::string& value) {
+  
+  _impl_.response_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_response() {
+  
+  return _impl_.response_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_response() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcResponseHeader.response)
+  return _impl_.response_.Release();
+}
+inline void RpcResponseHeader::set_allocated_response(std::string* response) {
+  if (response != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.response_.SetAllocated(response, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.response_.IsDefault()) {
+    _impl_.response_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcResponseHeader.response)
+}
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_;
-    uint32_t port_;
-    uint32_t weight_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_rpcheader_2eproto;
-};
-// ===================================================================
+// uint32 protocol = 5;
+inline void RpcResponseHeader::clear_protocol() {
+  _impl_.protocol_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_protocol() const {
+  return _impl_.protocol_;
+}
+inline uint32_t RpcResponseHeader::protocol() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.protocol)
+  return _internal_protocol();
+}
+inline void RpcResponseHeader::_internal_set_protocol(uint32_t value) {
+  
+  _impl_.protocol_ = value;
+}
+inline void RpcResponseHeader::set_protocol(uint32_t value) {
+  _internal_set_protocol(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.protocol)
+}
 
+// uint32 compression = 6;
+inline void RpcResponseHeader::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t RpcResponseHeader::compression() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcResponseHeader.compression)
+  return _internal_compression();
+}
+inline void RpcResponseHeader::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcResponseHeader::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcResponseHeader.compression)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// RpcHeader
+// RpcMeta
 
 // string service_name = 1;
-inline void RpcHeader::clear_service_name() {
+inline void RpcMeta::clear_service_name() {
   _impl_.service_name_.ClearToEmpty();
 }
-inline const std::string& RpcHeader::service_name() const {
-  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.service_name)
+inline const std::string& RpcMeta::service_name() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.service_name)
   return _internal_service_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+void RpcMeta::set_service_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.service_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.service_name)
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.service_name)
 }
-inline std::string* RpcHeader::mutable_service_name() {
+inline std::string* RpcMeta::mutable_service_name() {
   std::string* _s = _internal_mutable_service_name();
-  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.service_name)
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcMeta.service_name)
   return _s;
 }
-inline const std::string& RpcHeader::_internal_service_name() const {
+inline const std::string& RpcMeta::_internal_service_name() const {
   return _impl_.service_name_.Get();
 }
-inline void RpcHeader::_internal_set_service_name(const std::string& value) {
+inline void RpcMeta::_internal_set_service_name(const std::string& value) {
   
   _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RpcHeader::_internal_mutable_service_name() {
+inline std::string* RpcMeta::_internal_mutable_service_name() {
   
   return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RpcHeader::release_service_name() {
-  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.service_name)
+inline std::string* RpcMeta::release_service_name() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcMeta.service_name)
   return _impl_.service_name_.Release();
 }
-inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
+inline void RpcMeta::set_allocated_service_name(std::string* service_name) {
   if (service_name != nullptr) {
     
   } else {
@@ -1007,45 +2068,45 @@ inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
     _impl_.service_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.service_name)
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcMeta.service_name)
 }
 
 // string method_name = 2;
-inline void RpcHeader::clear_method_name() {
+inline void RpcMeta::clear_method_name() {
   _impl_.method_name_.ClearToEmpty();
 }
-inline const std::string& RpcHeader::method_name() const {
-  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.method_name)
+inline const std::string& RpcMeta::method_name() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.method_name)
   return _internal_method_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+void RpcMeta::set_method_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.method_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.method_name)
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.method_name)
 }
-inline std::string* RpcHeader::mutable_method_name() {
+inline std::string* RpcMeta::mutable_method_name() {
   std::string* _s = _internal_mutable_method_name();
-  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.method_name)
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcMeta.method_name)
   return _s;
 }
-inline const std::string& RpcHeader::_internal_method_name() const {
+inline const std::string& RpcMeta::_internal_method_name() const {
   return _impl_.method_name_.Get();
 }
-inline void RpcHeader::_internal_set_method_name(const std::string& value) {
+inline void RpcMeta::_internal_set_method_name(const std::string& value) {
   
   _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RpcHeader::_internal_mutable_method_name() {
+inline std::string* RpcMeta::_internal_mutable_method_name() {
   
   return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RpcHeader::release_method_name() {
-  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.method_name)
+inline std::string* RpcMeta::release_method_name() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcMeta.method_name)
   return _impl_.method_name_.Release();
 }
-inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
+inline void RpcMeta::set_allocated_method_name(std::string* method_name) {
   if (method_name != nullptr) {
     
   } else {
@@ -1057,57 +2118,157 @@ inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
     _impl_.method_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.method_name)
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcMeta.method_name)
 }
 
-// bytes params = 3;
-inline void RpcHeader::clear_params() {
-  _impl_.params_.ClearToEmpty();
+// int32 error_code = 3;
+inline void RpcMeta::clear_error_code() {
+  _impl_.error_code_ = 0;
 }
-inline const std::string& RpcHeader::params() const {
-  // @@protoc_insertion_point(field_get:TheChat.RpcHeader.params)
-  return _internal_params();
+inline int32_t RpcMeta::_internal_error_code() const {
+  return _impl_.error_code_;
+}
+inline int32_t RpcMeta::error_code() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.error_code)
+  return _internal_error_code();
+}
+inline void RpcMeta::_internal_set_error_code(int32_t value) {
+  
+  _impl_.error_code_ = value;
+}
+inline void RpcMeta::set_error_code(int32_t value) {
+  _internal_set_error_code(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.error_code)
+}
+
+// string error_text = 4;
+inline void RpcMeta::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcMeta::error_text() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.error_text)
+  return _internal_error_text();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RpcHeader::set_params(ArgT0&& arg0, ArgT... args) {
+void RpcMeta::set_error_text(ArgT0&& arg0, ArgT... args) {
  
- _impl_.params_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:TheChat.RpcHeader.params)
+ _impl_.error_text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.error_text)
 }
-inline std::string* RpcHeader::mutable_params() {
-  std::string* _s = _internal_mutable_params();
-  // @@protoc_insertion_point(field_mutable:TheChat.RpcHeader.params)
+inline std::string* RpcMeta::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:TheChat.RpcMeta.error_text)
   return _s;
 }
-inline const std::string& RpcHeader::_internal_params() const {
-  return _impl_.params_.Get();
+inline const std::string& RpcMeta::_internal_error_text() const {
+  return _impl_.error_text_.Get();
 }
-inline void RpcHeader::_internal_set_params(const std::string& value) {
+inline void RpcMeta::_internal_set_error_text(const std::string& value) {
   
-  _impl_.params_.Set(value, GetArenaForAllocation());
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RpcHeader::_internal_mutable_params() {
+inline std::string* RpcMeta::_internal_mutable_error_text() {
   
-  return _impl_.params_.Mutable(GetArenaForAllocation());
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RpcHeader::release_params() {
-  // @@protoc_insertion_point(field_release:TheChat.RpcHeader.params)
-  return _impl_.params_.Release();
+inline std::string* RpcMeta::release_error_text() {
+  // @@protoc_insertion_point(field_release:TheChat.RpcMeta.error_text)
+  return _impl_.error_text_.Release();
 }
-inline void RpcHeader::set_allocated_params(std::string* params) {
-  if (params != nullptr) {
+inline void RpcMeta::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
     
   } else {
     
   }
-  _impl_.params_.SetAllocated(params, GetArenaForAllocation());
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.params_.IsDefault()) {
-    _impl_.params_.Set("", GetArenaForAllocation());
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcHeader.params)
+  // @@protoc_insertion_point(field_set_allocated:TheChat.RpcMeta.error_text)
+}
+
+// uint32 timeout_ms = 5;
+inline void RpcMeta::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t RpcMeta::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void RpcMeta::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void RpcMeta::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.timeout_ms)
+}
+
+// uint32 priority = 6;
+inline void RpcMeta::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t RpcMeta::priority() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.priority)
+  return _internal_priority();
+}
+inline void RpcMeta::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void RpcMeta::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.priority)
+}
+
+// uint32 window = 7;
+inline void RpcMeta::clear_window() {
+  _impl_.window_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_window() const {
+  return _impl_.window_;
+}
+inline uint32_t RpcMeta::window() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.window)
+  return _internal_window();
+}
+inline void RpcMeta::_internal_set_window(uint32_t value) {
+  
+  _impl_.window_ = value;
+}
+inline void RpcMeta::set_window(uint32_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.window)
+}
+
+// uint32 compression = 8;
+inline void RpcMeta::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t RpcMeta::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t RpcMeta::compression() const {
+  // @@protoc_insertion_point(field_get:TheChat.RpcMeta.compression)
+  return _internal_compression();
+}
+inline void RpcMeta::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcMeta::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:TheChat.RpcMeta.compression)
 }
 
 // -------------------------------------------------------------------
@@ -1496,6 +2657,186 @@ inline void ServiceEndpoint::set_allocated_version(std::string* version) {
   // @@protoc_insertion_point(field_set_allocated:TheChat.ServiceEndpoint.version)
 }
 
+// uint32 method_id = 5;
+inline void ServiceEndpoint::clear_method_id() {
+  _impl_.method_id_ = 0u;
+}
+inline uint32_t ServiceEndpoint::_internal_method_id() const {
+  return _impl_.method_id_;
+}
+inline uint32_t ServiceEndpoint::method_id() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.method_id)
+  return _internal_method_id();
+}
+inline void ServiceEndpoint::_internal_set_method_id(uint32_t value) {
+  
+  _impl_.method_id_ = value;
+}
+inline void ServiceEndpoint::set_method_id(uint32_t value) {
+  _internal_set_method_id(value);
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.method_id)
+}
+
+// string unix_path = 6;
+inline void ServiceEndpoint::clear_unix_path() {
+  _impl_.unix_path_.ClearToEmpty();
+}
+inline const std::string& ServiceEndpoint::unix_path() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.unix_path)
+  return _internal_unix_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServiceEndpoint::set_unix_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.unix_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.unix_path)
+}
+inline std::string* ServiceEndpoint::mutable_unix_path() {
+  std::string* _s = _internal_mutable_unix_path();
+  // @@protoc_insertion_point(field_mutable:TheChat.ServiceEndpoint.unix_path)
+  return _s;
+}
+inline const std::string& ServiceEndpoint::_internal_unix_path() const {
+  return _impl_.unix_path_.Get();
+}
+inline void ServiceEndpoint::_internal_set_unix_path(const std::string& value) {
+  
+  _impl_.unix_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServiceEndpoint::_internal_mutable_unix_path() {
+  
+  return _impl_.unix_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServiceEndpoint::release_unix_path() {
+  // @@protoc_insertion_point(field_release:TheChat.ServiceEndpoint.unix_path)
+  return _impl_.unix_path_.Release();
+}
+inline void ServiceEndpoint::set_allocated_unix_path(std::string* unix_path) {
+  if (unix_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.unix_path_.SetAllocated(unix_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.unix_path_.IsDefault()) {
+    _impl_.unix_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.ServiceEndpoint.unix_path)
+}
+
+// string shm_path = 7;
+inline void ServiceEndpoint::clear_shm_path() {
+  _impl_.shm_path_.ClearToEmpty();
+}
+inline const std::string& ServiceEndpoint::shm_path() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.shm_path)
+  return _internal_shm_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServiceEndpoint::set_shm_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.shm_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.shm_path)
+}
+inline std::string* ServiceEndpoint::mutable_shm_path() {
+  std::string* _s = _internal_mutable_shm_path();
+  // @@protoc_insertion_point(field_mutable:TheChat.ServiceEndpoint.shm_path)
+  return _s;
+}
+inline const std::string& ServiceEndpoint::_internal_shm_path() const {
+  return _impl_.shm_path_.Get();
+}
+inline void ServiceEndpoint::_internal_set_shm_path(const std::string& value) {
+  
+  _impl_.shm_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServiceEndpoint::_internal_mutable_shm_path() {
+  
+  return _impl_.shm_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServiceEndpoint::release_shm_path() {
+  // @@protoc_insertion_point(field_release:TheChat.ServiceEndpoint.shm_path)
+  return _impl_.shm_path_.Release();
+}
+inline void ServiceEndpoint::set_allocated_shm_path(std::string* shm_path) {
+  if (shm_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.shm_path_.SetAllocated(shm_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.shm_path_.IsDefault()) {
+    _impl_.shm_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TheChat.ServiceEndpoint.shm_path)
+}
+
+// uint32 inflight = 8;
+inline void ServiceEndpoint::clear_inflight() {
+  _impl_.inflight_ = 0u;
+}
+inline uint32_t ServiceEndpoint::_internal_inflight() const {
+  return _impl_.inflight_;
+}
+inline uint32_t ServiceEndpoint::inflight() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.inflight)
+  return _internal_inflight();
+}
+inline void ServiceEndpoint::_internal_set_inflight(uint32_t value) {
+  
+  _impl_.inflight_ = value;
+}
+inline void ServiceEndpoint::set_inflight(uint32_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.inflight)
+}
+
+// uint32 cpu_permille = 9;
+inline void ServiceEndpoint::clear_cpu_permille() {
+  _impl_.cpu_permille_ = 0u;
+}
+inline uint32_t ServiceEndpoint::_internal_cpu_permille() const {
+  return _impl_.cpu_permille_;
+}
+inline uint32_t ServiceEndpoint::cpu_permille() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.cpu_permille)
+  return _internal_cpu_permille();
+}
+inline void ServiceEndpoint::_internal_set_cpu_permille(uint32_t value) {
+  
+  _impl_.cpu_permille_ = value;
+}
+inline void ServiceEndpoint::set_cpu_permille(uint32_t value) {
+  _internal_set_cpu_permille(value);
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.cpu_permille)
+}
+
+// uint32 queue_delay_us = 10;
+inline void ServiceEndpoint::clear_queue_delay_us() {
+  _impl_.queue_delay_us_ = 0u;
+}
+inline uint32_t ServiceEndpoint::_internal_queue_delay_us() const {
+  return _impl_.queue_delay_us_;
+}
+inline uint32_t ServiceEndpoint::queue_delay_us() const {
+  // @@protoc_insertion_point(field_get:TheChat.ServiceEndpoint.queue_delay_us)
+  return _internal_queue_delay_us();
+}
+inline void ServiceEndpoint::_internal_set_queue_delay_us(uint32_t value) {
+  
+  _impl_.queue_delay_us_ = value;
+}
+inline void ServiceEndpoint::set_queue_delay_us(uint32_t value) {
+  _internal_set_queue_delay_us(value);
+  // @@protoc_insertion_point(field_set:TheChat.ServiceEndpoint.queue_delay_us)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1507,6 +2848,10 @@ inline void ServiceEndpoint::set_allocated_version(std::string* version) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -6,40 +6,372 @@
 #ifndef RPCPROVIDER_H
 #define RPCPROVIDER_H
 #include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <vector>
+#include <thread>
+#include <condition_variable>
 #include <muduo/net/TcpServer.h>
 #include <muduo/net/EventLoop.h>
+#include <muduo/net/Channel.h>
 #include <google/protobuf/service.h>
 #include "rpccontroller.h"
+#include "rpcexecption.h"
+#include "rpcheader.pb.h"
+#include "workerpool.h"
+#include "arenapool.h"
+#include "rpccodec.h"
+#include "admissioncontroller.h"
+#include "methodmetrics.h"
+#include "adminservice.h"
+#include "metricsserver.h"
+#include "responsecache.h"
+#include "rpcstream.h"
+#include "zookeeperutil.h"
+#include "listenserver.h"
+#include "uringserver.h"
+#include "shmtransport.h"
 #include "mutex"
 
 class RpcProvider
 {
 public:
-    // 远程服务注册
-    void NotifyService(std::unordered_map<std::string, google::protobuf::Service *>, std::unordered_set<std::string>);
-    // 启动服务节点
+    // 远程服务注册，可缓存和合并执行的方法列表中的方法名可写作"Method"或"Service.Method"，这些方法必须是幂等的
+    void NotifyService(std::unordered_map<std::string, google::protobuf::Service *>, std::unordered_set<std::string>,
+                       std::unordered_set<std::string> cacheable_method_set = {},
+                       std::unordered_set<std::string> single_flight_method_set = {});
+    // 启动服务节点，优雅退出完成后返回
     void Run();
+    // 开始优雅退出，可在任意线程调用：先从ZooKeeper摘除本节点并停止接收新连接，
+    // 等待未完成的调用结束(最多rpcdraintimeout毫秒)后Run返回；进程收到SIGTERM或SIGINT时同样处理
+    void Shutdown();
+    // 各方法("Service.Method")的调用统计快照，可在任意线程调用，NotifyService之后方法集合不再变化
+    std::vector<std::pair<std::string, MethodMetrics::Snapshot>> MetricsSnapshot() const;
 
 private:
     ::muduo::net::EventLoop event_loop_;
+    // SO_REUSEPORT模式下各自监听同一端口的事件循环线程
+    std::vector<std::thread> acceptor_threads_;
+    // SO_REUSEPORT模式下的监听循环及其服务端，摘流量时在各自的循环中停止接收，退出时逐个停止
+    std::mutex acceptor_mutex_;
+    std::condition_variable acceptor_cv_;
+    std::vector<std::pair<muduo::net::EventLoop *, ListenServer *>> acceptors_;
+    // 单监听循环模式下监听服务端口，使用io_uring或多个监听循环时为空
+    std::unique_ptr<ListenServer> tcp_server_;
+    // rpciouring=true且内核支持时代替tcp_server_监听服务端口，为空表示未启用
+    std::unique_ptr<UringServer> uring_server_;
+    // rpcunixpath非空时监听的Unix域套接字，为空表示未启用
+    std::unique_ptr<ListenServer> unix_server_;
+    // rpcshmpath非空时监听的共享内存传输的引导套接字，为空表示未启用
+    std::unique_ptr<ListenServer> shm_server_;
+    // 内置的自省服务，rpcadmin=true时随业务服务一起注册，默认不注册
+    std::unique_ptr<RpcAdminService> admin_service_;
+    // rpcmetricsport非0时以Prometheus文本格式输出统计的本地HTTP端点，为空表示未启用
+    std::unique_ptr<MetricsServer> metrics_server_;
+    // 当前的客户端连接数
+    std::atomic<size_t> connection_count_{0};
+    // 注册服务用的ZooKeeper客户端，退出时用它删除本节点注册的方法节点
+    ZooKeeperClient zk_client_;
+    // 本节点注册的方法节点及其值
+    std::vector<std::pair<std::string, std::string>> registered_nodes_;
+    // 本节点在各方法节点下注册的临时实例节点及其值，负载变化时在主循环中改写；
+    // 改写时和ZooKeeper会话重建后在后台线程中读取时持有instance_mutex_
+    std::vector<std::pair<std::string, TheChat::ServiceEndpoint>> instance_nodes_;
+    std::mutex instance_mutex_;
+    // 最近一次发布的负载和发布时间
+    TheChat::ServiceEndpoint published_load_;
+    std::chrono::steady_clock::time_point load_published_time_;
+    // 两次发布负载的最短间隔，避免频繁写ZooKeeper
+    std::chrono::milliseconds load_publish_interval_{5000};
+    // 上次采样时的进程CPU时间和采样时刻，用于计算CPU占用
+    std::chrono::nanoseconds cpu_time_sample_{0};
+    std::chrono::steady_clock::time_point cpu_sample_time_;
+    // 是否正在摘流量，只在主循环中修改，IO线程读取
+    std::atomic_bool draining_{false};
+    // 已安排停止事件循环
+    bool drain_finishing_ = false;
+    // 等待未完成调用的最长时间和截止时间
+    int drain_timeout_ms_ = 10000;
+    std::chrono::steady_clock::time_point drain_deadline_;
+    // 业务线程池，为空时RPC方法直接在IO线程中执行
+    std::unique_ptr<WorkerPool> worker_pool_;
+    // 暂存数据超过该字节数时立即写出，不等到事件循环末尾
+    size_t flush_threshold_ = 64 * 1024;
+    // 本节点支持的压缩算法，请求方提出相同算法时在连接上启用
+    CompressionType compression_ = CompressionType::NONE;
+    // 不小于该字节数的v2消息体才压缩
+    size_t compress_threshold_ = 4096;
+    // 服务方法结构体
+    struct MethodInfo
+    {
+        const google::protobuf::MethodDescriptor *method_;
+        // 方法级并发上限，未配置时为空
+        std::shared_ptr<AdmissionController> admission_;
+        // 方法独占的业务线程池(隔舱)，未配置时为空
+        std::shared_ptr<WorkerPool> worker_pool_;
+        // 响应缓存的有效期，0表示不缓存
+        uint32_t cache_ttl_ms_ = 0;
+        // 是否合并执行相同的并发请求
+        bool single_flight_ = false;
+        // 在方法分发表中的下标
+        size_t table_index_ = 0;
+        // 调用统计
+        std::shared_ptr<MethodMetrics> metrics_;
+        // 上次定期输出统计时的调用数，没有新调用的方法不再输出，只在主循环中访问
+        uint64_t reported_requests_ = 0;
+    };
     // 服务对象结构体
     struct ServiceInfo
     {
         // 服务对象
         google::protobuf::Service *service_;
         // 服务对象的方法
-        std::unordered_map<std::string, const google::protobuf::MethodDescriptor *> method_map_;
+        std::unordered_map<std::string, MethodInfo> method_map_;
+        // 服务的准入控制器
+        std::shared_ptr<AdmissionController> admission_;
+        // 服务独占的业务线程池(隔舱)，未配置时为空
+        std::shared_ptr<WorkerPool> worker_pool_;
+    };
+    // 方法分发表的一项，id为0表示空槽
+    struct MethodEntry
+    {
+        uint32_t id = 0;
+        google::protobuf::Service *service = nullptr;
+        const google::protobuf::MethodDescriptor *method = nullptr;
+        // 服务级准入控制
+        AdmissionController *admission = nullptr;
+        // 方法级并发上限，可为空
+        AdmissionController *method_admission = nullptr;
+        // 执行该方法的隔舱线程池，为空时使用共享的worker_pool_
+        WorkerPool *worker_pool = nullptr;
+        // 响应缓存的有效期，0表示不缓存
+        uint32_t cache_ttl_ms = 0;
+        // 是否合并执行相同的并发请求
+        bool single_flight = false;
+        // 调用统计
+        MethodMetrics *metrics = nullptr;
     };
+    // 连接上下文，保证同一连接上流水线请求的响应按序写回
+    struct ConnContext
+    {
+        // 下一个请求的序号
+        uint64_t next_seq = 0;
+        // 下一个待写回响应的序号
+        uint64_t send_seq = 0;
+        // 已完成但尚未轮到写回的响应，value为<响应数据, 写回后是否关闭连接>
+        std::map<uint64_t, std::pair<std::string, bool>> pending;
+        // 本轮事件循环中待写回的数据，循环末尾合并为一次写入
+        std::string output;
+        // 是否已安排在循环末尾写回
+        bool flush_queued = false;
+        // 连接上协商的压缩算法
+        CompressionType compression = CompressionType::NONE;
+        // 连接上未结束的流式调用，key为流id
+        std::unordered_map<uint64_t, std::shared_ptr<RpcStream>> streams;
+        // 共享内存传输，非空时帧经由共享内存字节环收发，连接本身只用于感知对端退出
+        std::shared_ptr<ShmTransport> shm;
+        // 等待对端写入、腾出空间的eventfd，在连接所属的IO线程中注册和注销
+        std::unique_ptr<muduo::net::Channel> shm_read_channel;
+        std::unique_ptr<muduo::net::Channel> shm_write_channel;
+        // 从字节环读出、尚未处理的数据
+        muduo::net::Buffer shm_input;
+        // 字节环已满时暂存的待写数据，对端腾出空间后继续写入
+        muduo::net::Buffer shm_output;
+    };
+    using ConnContextPtr = std::shared_ptr<ConnContext>;
+    // 单次调用的上下文，从请求解析一直存活到响应写回
+    struct CallContext
+    {
+        // 本次调用独占的Arena，声明在消息之前，保证最后析构
+        ArenaPool::ArenaPtr arena;
+        muduo::net::TcpConnectionPtr conn;
+        // 连接内请求序号，仅用于非多路复用请求的按序写回
+        uint64_t seq = 0;
+        // 非0表示多路复用请求，响应带RpcResponseHeader且可乱序写回
+        uint64_t request_id = 0;
+        // 响应是否带4字节长度头
+        bool framed = false;
+        // 写回响应后是否保持连接
+        bool keep_alive = false;
+        // 请求帧的协议版本，响应使用相同版本
+        uint8_t protocol = kProtocolV1;
+        // v1请求方支持v2时，在响应中告知服务端同意升级
+        bool offer_v2 = false;
+        // 响应使用的压缩算法，取自连接上协商的结果
+        CompressionType compression = CompressionType::NONE;
+        // 请求方提出了压缩且本节点同意，在响应中告知
+        bool ack_compression = false;
+        // 调用方的截止时间，请求未携带超时时间时不限制
+        TheRpcController::Clock::time_point deadline = TheRpcController::Clock::time_point::max();
+        // 请求优先级
+        RpcPriority priority = RpcPriority::NORMAL;
+        // 框架层的失败原因，非SUCCESS时以该错误类型代替BUSINESS_ERROR写回
+        RpcErrorType error = RpcErrorType::SUCCESS;
+        // 请求到达的时间，用于计算排队时延
+        TheRpcController::Clock::time_point receive_time;
+        // 接纳本次调用的服务级和方法级准入控制器，调用结束时归还并发名额
+        AdmissionController *admission = nullptr;
+        AdmissionController *method_admission = nullptr;
+        // 所调用方法的统计，调用开始执行后才设置，写回响应时记录一次完成
+        MethodMetrics *metrics = nullptr;
+        // 请求消息体字节数和开始执行的时间
+        size_t request_bytes = 0;
+        TheRpcController::Clock::time_point start_time;
+        // 请求键(方法id, 参数哈希, 参数)，仅可缓存和合并执行的方法记录
+        uint32_t key_method_id = 0;
+        uint64_t key_hash = 0;
+        std::string key_params;
+        // 响应成功后写入缓存的有效期，0表示不写入
+        uint32_t cache_ttl_ms = 0;
+        // 是否为合并执行中实际执行的调用，完成时把结果分发给等待的相同调用
+        bool flight_leader = false;
+        // 流式调用的流，普通调用为空
+        std::shared_ptr<RpcStream> stream;
+        TheRpcController controller;
+        // 请求和响应均分配在arena上，随arena整体释放
+        google::protobuf::Message *request = nullptr;
+        google::protobuf::Message *response = nullptr;
+
+        ~CallContext()
+        {
+            if (admission)
+            {
+                admission->OnFinish();
+            }
+            if (method_admission)
+            {
+                method_admission->OnFinish();
+            }
+        }
+    };
+    using CallContextPtr = std::shared_ptr<CallContext>;
     // 存储注册成功的服务对象和其服务方法的所有信息
     std::unordered_map<std::string, ServiceInfo> service_map_;
+    // 按方法id开放寻址的分发表，大小为2的幂，注册完成后只读
+    std::vector<MethodEntry> method_table_;
+    // 退出信号处理，只设置标志
+    static void OnStopSignal(int);
+    // 主循环定时检查：收到退出信号时开始摘流量，摘流量期间未完成的调用全部结束或超时后停止事件循环
+    void CheckDrain();
+    // 摘流量：先从ZooKeeper删除本节点，再停止接收新连接，之后到达的请求被拒绝，客户端据此重新做服务发现
+    void BeginDrain();
+    // 关闭本节点在服务端口上的监听socket，已建立的连接不受影响
+    void CloseListeners();
+    // 已接纳尚未完成的调用数
+    size_t InflightCalls() const;
+    // 创建并启动监听Unix域套接字的服务端，shm_capacity非0时用于引导共享内存传输，失败时返回空
+    std::unique_ptr<ListenServer> StartUnixServer(const std::string &path, const std::string &name, int threads,
+                                                const std::vector<int> &cpus, size_t shm_capacity);
+    // 创建并启动用io_uring接收和读取的TCP服务端，内核不支持或失败时返回空
+    std::unique_ptr<UringServer> StartUringServer(const muduo::net::InetAddress &address, bool reuse_port, int threads,
+                                                  const std::vector<int> &cpus);
+    // 启动num个SO_REUSEPORT监听循环，每个循环在自己的线程中创建、运行和销毁服务端
+    void StartAcceptors(const muduo::net::InetAddress &address, int num, const std::vector<int> &cpus);
+    // 解析逗号分隔的CPU编号列表，忽略非法项
+    static std::vector<int> ParseCpuList(const std::string &list);
+    // 把当前线程绑定到cpus中的第index个CPU(循环取)，cpus为空时不绑定
+    static void PinThread(const std::vector<int> &cpus, size_t index);
+    // 按"prefix.rpcworkerthreads"创建隔舱线程池，未配置时返回空
+    static std::shared_ptr<WorkerPool> CreateBulkhead(const std::string &prefix);
+    // 由service_map_重建方法分发表，方法id冲突时退出
+    void BuildMethodTable();
+    // 按方法id查找，不存在时返回nullptr
+    const MethodEntry *FindMethod(uint32_t method_id) const;
     // 连接回调
     void OnConnection(const muduo::net::TcpConnectionPtr &);
     // 读写事件回调
     void OnMessage(const muduo::net::TcpConnectionPtr &, muduo::net::Buffer *, muduo::Timestamp);
+    // 在连接所属的IO线程中注册共享内存传输的eventfd
+    void StartShm(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx);
+    // 对端向字节环写入了数据：读出并按帧处理，与socket上的数据走同一个OnMessage
+    void OnShmReadable(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx);
+    // 对端腾出了空间：继续写出暂存的数据
+    void OnShmWritable(const ConnContextPtr &ctx);
+    // 经由字节环写出数据，环满时暂存，保证顺序
+    void ShmSend(ConnContext &ctx, const char *data, size_t len);
+    // 处理一个完整的v1请求帧：4字节长度 + RpcHeader
+    bool HandleRequestV1(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx,
+                         const char *data, size_t len);
+    // 处理一个完整的v2请求帧：固定帧头 + RpcMeta + 请求体
+    bool HandleRequestV2(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx,
+                         const FrameHeader &header, const char *data);
+    // 请求方提出压缩且本节点支持相同算法时，在连接上启用并在响应中告知
+    void NegotiateCompression(const ConnContextPtr &ctx, const CallContextPtr &call, uint32_t compression);
+    // 流式调用的首帧：建立流并登记到连接上下文，流id为0或已被占用时返回false断开连接
+    bool OpenStream(const ConnContextPtr &ctx, const CallContextPtr &call, uint8_t flags);
+    // 按名字查找服务方法，找不到时拒绝调用
+    bool DispatchByName(const ConnContextPtr &ctx, const CallContextPtr &call,
+                        const std::string &service_name, const std::string &method_name,
+                        const char *params, size_t params_len);
+    // 准入检查后解析请求并交给业务线程执行，返回false表示需要断开连接
+    bool Dispatch(const ConnContextPtr &ctx, const CallContextPtr &call, const MethodEntry &entry,
+                  const char *params, size_t params_len);
+    // 定期输出响应缓存、合并执行、各服务的准入统计和业务线程池各优先级的队列深度
+    void ReportStats();
+    // 收集方法调用统计和节点的连接数、并发数、队列深度等指标，可在任意线程调用，不阻塞业务路径
+    void CollectStats(TheChat::StatsResponse *response) const;
+    // 定期采样负载，与上次发布的相比变化明显且距上次发布超过load_publish_interval_时改写实例节点
+    void RefreshLoad();
+    // 会话重新建立后按最近发布的值重新创建实例节点，在ZooKeeper客户端的后台线程中调用，摘流量时跳过
+    void RegisterInstances();
+    // 负载是否有明显变化：任一项相差超过20%且超过该项的绝对阈值
+    static bool LoadChanged(const TheChat::ServiceEndpoint &last, const TheChat::ServiceEndpoint &current);
+    // 本进程累计占用的CPU时间
+    static std::chrono::nanoseconds ProcessCpuTime();
+    // 由请求中的优先级取值换算业务线程池的队列级别
+    static size_t ToQueueLevel(RpcPriority priority);
+    // 由请求中的相对超时时间换算本地截止时间
+    static TheRpcController::Clock::time_point ToDeadline(uint32_t timeout_ms);
+    // 由请求中的优先级取值得到RpcPriority，未知取值按NORMAL处理
+    static RpcPriority ToPriority(uint32_t priority);
+    // 拒绝一次调用：多路复用请求写回错误响应，按序写回的请求无法跳过，返回false断开连接
+    bool RejectCall(const CallContextPtr &call, RpcErrorType type, const std::string &error_text);
 
     // Closure的回调操作，用于序列化响应和网络发送
-    void SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response);
+    void SendRpcResponse(const CallContextPtr &call);
+    // 写回已经序列化好的响应，用于缓存命中、写入缓存和合并执行的调用
+    void SendSerializedResponse(const CallContextPtr &call, const std::string &response);
+    // 向多路复用请求或v2请求写回错误响应
+    void SendErrorResponse(const CallContextPtr &call, RpcErrorType type, const std::string &error_text);
+    // 流式调用随最终响应结束，从连接上下文中移除，必须在连接所属的IO线程中调用
+    void EndStream(const CallContextPtr &call);
+    // 写回带4字节长度头的RpcResponseHeader
+    void SendResponseHeader(const CallContextPtr &call, TheChat::RpcResponseHeader *response_header);
+    // 暂存待写回的数据，在本轮事件循环末尾或超过阈值时合并写入，必须在连接所属的IO线程中调用
+    void QueueSend(const muduo::net::TcpConnectionPtr &conn, const std::string &data);
+    // 立即写出暂存的数据
+    void FlushOutput(const muduo::net::TcpConnectionPtr &conn, ConnContext &ctx);
+    // 按请求顺序写回响应，必须在连接所属的IO线程中调用
+    void WriteInOrder(const muduo::net::TcpConnectionPtr &conn, uint64_t seq, std::string &&data, bool keep_alive);
     // 长连接方法列表
     std::unordered_set<std::string> keep_alive_method_set_;
+    // 可缓存方法的响应缓存，没有可缓存方法时为空
+    std::unique_ptr<ResponseCache> response_cache_;
+    // 合并执行的请求键
+    struct FlightKey
+    {
+        uint32_t method_id;
+        uint64_t hash;
+        std::string params;
+        bool operator==(const FlightKey &other) const
+        {
+            return method_id == other.method_id && hash == other.hash && params == other.params;
+        }
+    };
+    struct FlightKeyHash
+    {
+        size_t operator()(const FlightKey &key) const
+        {
+            return static_cast<size_t>(key.hash ^ key.method_id);
+        }
+    };
+    // 正在执行的合并请求及等待其结果的调用，多个IO线程共享
+    std::mutex flight_mutex_;
+    std::unordered_map<FlightKey, std::vector<CallContextPtr>, FlightKeyHash> flights_;
+    // 被合并、没有实际执行的调用数
+    std::atomic<uint64_t> coalesced_count_{0};
+    // 合并执行完成，把结果分发给等待的调用，response为空时分发错误
+    void FinishFlight(const CallContextPtr &call, const std::shared_ptr<const std::string> &response,
+                      RpcErrorType type, const std::string &error_text);
 };
 #endif
@@ -0,0 +1,168 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 多路复用的客户端会话，一条长连接上同时承载多个未完成的调用，按request_id匹配响应
+ */
+#ifndef RPCSESSION_H
+#define RPCSESSION_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "connectionpool.h"
+#include "rpcexecption.h"
+#include "rpcheader.pb.h"
+#include "rpccodec.h"
+#include "rpcstream.h"
+#include "shmtransport.h"
+#include "iouring.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+// 一次调用的结果
+struct RpcResult
+{
+    RpcErrorType type = RpcErrorType::SUCCESS; // 错误类型，SUCCESS表示成功
+    std::string error_text;                    // 错误信息
+    std::string response;                      // 序列化后的响应
+};
+
+// 单次调用的选项
+struct CallOptions
+{
+    uint32_t method_id = 0;  // 服务端发布的方法id，非0且已升级到v2时按id调用，不再携带方法名
+    uint32_t timeout_ms = 0; // 剩余的超时时间，随请求发给服务端，0表示不限制
+    uint32_t priority = 0;   // 请求优先级，取值见RpcPriority
+};
+
+class RpcSession : public std::enable_shared_from_this<RpcSession>
+{
+public:
+    // 响应到达或调用失败时，在会话读线程中回调
+    using Callback = std::function<void(RpcResult &&)>;
+
+    /**
+     * @brief 构造函数，从连接池获取连接并启动读线程，连接失败则抛出异常
+     * @param ep 端点信息，包括host+port
+     * @param connect_timeout_ms 连接超时时间，单位毫秒
+     * @param max_protocol 允许协商的最高协议版本，会话先用v1，服务端同意后升级为v2
+     * @param compression 向服务端提出的压缩算法，服务端同意后压缩v2帧中不小于compress_threshold字节的消息体
+     * @param compress_threshold 压缩阈值，单位字节
+     * @param use_io_uring 读线程是否改用io_uring的multishot recv读取，内核不支持或共享内存传输时忽略
+     */
+    RpcSession(const Endpoint &ep, time_t connect_timeout_ms, uint8_t max_protocol = kProtocolV2,
+               CompressionType compression = CompressionType::NONE, size_t compress_threshold = 4096,
+               bool use_io_uring = false);
+
+    /**
+     * @brief 析构函数，失败所有未完成的调用，停止读线程并归还连接配额
+     */
+    ~RpcSession();
+
+    /**
+     * @brief 发送一次调用，按当前协商的协议版本编码请求
+     * @param method 要远程调用的方法
+     * @param request 请求参数
+     * @param cb 完成回调
+     * @param options 调用选项
+     * @return 本次调用的request_id
+     */
+    uint64_t AsyncCall(const google::protobuf::MethodDescriptor *method,
+                       const google::protobuf::Message &request, Callback &&cb,
+                       const CallOptions &options = CallOptions());
+
+    /**
+     * @brief 取消一个未完成的调用
+     * @param request_id 调用的request_id
+     * @return 取消成功返回true，此后回调不会再执行；回调已经或正在执行时返回false
+     */
+    bool Cancel(uint64_t request_id);
+
+    /**
+     * @brief 发起一次流式调用，总是使用v2帧，会话必须由std::make_shared创建
+     * @param method 要远程调用的方法
+     * @param request 第一个请求消息
+     * @param options 调用选项，timeout_ms非0时作为整个流的超时时间
+     * @return 已建立的流，发送失败时流处于失败状态
+     */
+    std::shared_ptr<RpcStream> OpenStream(const google::protobuf::MethodDescriptor *method,
+                                          const google::protobuf::Message &request,
+                                          const CallOptions &options = CallOptions());
+
+    // 会话是否已关闭，关闭后不能再发起调用
+    bool IsClosed() const;
+
+    // 未完成的调用数量
+    size_t PendingCount() const;
+
+    // 当前使用的协议版本
+    uint8_t Protocol() const;
+
+    // 与服务端协商的压缩算法，服务端同意之前为NONE
+    CompressionType NegotiatedCompression() const;
+
+private:
+    // 读线程，按request_id分发响应
+    void ReadLoop();
+    // 从共享内存字节环读取，没有数据时最多等待100毫秒；返回-1表示暂无数据，0表示服务端已关闭连接
+    ssize_t ReadShm(char *buf, size_t len);
+    // 从multishot recv的完成项读取，数据直接追加到out，没有数据时最多等待100毫秒；
+    // 返回读取的字节数，0表示服务端已关闭连接，-1时errno为EAGAIN表示暂无数据
+    ssize_t ReadUring(std::string *out);
+    // 在fd_上挂multishot recv
+    void ArmUringRecv();
+    // 经由共享内存字节环完整写出一帧，环满时等待服务端消费
+    bool SendFrameShm(const std::string &frame);
+    // 关闭会话并以指定错误完成所有未完成的调用
+    void FailAll(RpcErrorType type, const std::string &reason);
+    // 完整写出一帧，失败时关闭整个会话
+    bool SendFrame(const std::string &frame);
+    // 编码请求帧
+    bool EncodeRequest(uint64_t request_id, const google::protobuf::MethodDescriptor *method, const CallOptions &options,
+                       const google::protobuf::Message &request, std::string *out);
+    // 编码v2请求帧
+    bool EncodeFrameV2(uint64_t request_id, uint8_t flags, const google::protobuf::MethodDescriptor *method,
+                       const CallOptions &options, const google::protobuf::Message &request, std::string *out);
+    // 解析缓冲区开头的一个响应帧，数据不足时返回0，格式错误时返回-1，否则返回帧长度；
+    // 流帧直接交给对应的流，request_id置0表示没有需要完成的调用
+    ssize_t DecodeResponse(const char *data, size_t len, RpcResult &result, uint64_t &request_id);
+    // 服务端在响应中同意压缩时启用
+    void OnCompressionAck(uint32_t compression);
+    // 把流帧交给对应的流，流结束后不再跟踪
+    bool DispatchStream(const FrameHeader &header, const char *data);
+    // 完成一次调用
+    void Complete(uint64_t request_id, RpcResult &&result);
+
+    Endpoint endpoint_;
+    int fd_;
+    // 共享内存传输，非空时帧经由字节环收发，fd_只用于感知服务端退出
+    std::unique_ptr<ShmTransport> shm_;
+    // 非空时读线程经由io_uring读取fd_，只在读线程中使用
+    std::unique_ptr<IoUring> uring_;
+    // multishot recv已结束时的结果：0表示服务端已关闭连接，负数为-errno，1表示仍在接收
+    int uring_state_ = 1;
+    const uint8_t max_protocol_;
+    std::atomic<uint8_t> protocol_{kProtocolV1};
+    const CompressionType local_compression_;
+    const size_t compress_threshold_;
+    std::atomic<uint32_t> compression_{0};
+    std::atomic<uint64_t> next_request_id_{1};
+    std::atomic_bool closed_{false};
+    // 保证帧完整写入socket
+    std::mutex send_mutex_;
+    // 未完成的调用
+    mutable std::mutex pending_mutex_;
+    std::unordered_map<uint64_t, Callback> pending_;
+    // 未结束的流，与pending_共用锁
+    std::unordered_map<uint64_t, std::shared_ptr<RpcStream>> streams_;
+    std::thread reader_;
+
+    RpcSession(const RpcSession &) = delete;
+    RpcSession &operator=(const RpcSession &) = delete;
+};
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 流式调用的一端，在一条长连接上增量收发消息，按额度做流量控制，两端的内存占用都有上界
+ */
+#ifndef RPCSTREAM_H
+#define RPCSTREAM_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include "rpccodec.h"
+#include "rpcexecption.h"
+#include "rpcheader.pb.h"
+#include <google/protobuf/message.h>
+
+/*
+ * 流式调用建立在v2帧上，request_id即流id：
+ *   客户端首帧带kFlagStreamOpen，与普通调用一样携带方法和第一个请求消息，服务端以此调用RPC方法；
+ *   之后双方的消息帧只带kFlagStream，发送方每发一条消耗一个额度，额度用完时阻塞等待对端的流量控制帧；
+ *   客户端发完请求后发送结束帧，服务端RPC方法完成时发送带最终响应或错误的结束帧，流随之结束。
+ * 服务端流式方法通过TheRpcController::Stream()取得本对象，同一个流同时最多一个线程读、一个线程写。
+ */
+class RpcStream
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    // 向对端发送一帧，flags为kFlagStream之外的流帧标志，meta可为nullptr，连接已断开时返回false
+    using FrameSender = std::function<bool(uint8_t flags, const TheChat::RpcMeta *meta, const char *body, size_t body_len)>;
+
+    /**
+     * @brief 构造函数
+     * @param sender 发送帧的回调
+     * @param deadline 截止时间，读写等待超过该时间时流以DEADLINE_EXCEEDED失败
+     */
+    explicit RpcStream(FrameSender &&sender, Clock::time_point deadline = Clock::time_point::max());
+
+    /**
+     * @brief 发送一条消息，没有发送额度时阻塞等待
+     * @param message 消息
+     * @return 流已结束或失败时返回false
+     */
+    bool Write(const google::protobuf::Message &message);
+
+    /**
+     * @brief 接收一条消息，没有消息时阻塞等待
+     * @param message 输出
+     * @return 对端已结束发送且消息已读完、或流失败时返回false
+     */
+    bool Read(google::protobuf::Message *message);
+
+    // 客户端：请求消息发送完毕，之后不能再Write
+    bool CloseSend();
+
+    /**
+     * @brief 客户端：等待服务端结束流
+     * @param response 输出服务端的最终响应，可为nullptr
+     * @return 流正常结束返回true，失败时原因见Status()和ErrorText()
+     */
+    bool Finish(google::protobuf::Message *response);
+
+    // 放弃流并通知对端，阻塞在该流上的读写立即返回
+    void Cancel(const std::string &reason);
+
+    // 流的状态，SUCCESS表示未失败
+    RpcErrorType Status() const;
+    std::string ErrorText() const;
+
+    // 收到对端的流帧，由连接的IO线程或会话读线程调用，扩展头格式错误时返回false
+    bool OnFrame(uint8_t flags, const char *meta, size_t meta_len, const char *body, size_t body_len);
+    // 流因连接断开等原因失败，唤醒阻塞的读写
+    void Fail(RpcErrorType type, const std::string &error_text);
+    // 服务端：RPC方法已完成，流随最终响应结束，之后的读写立即返回false
+    void Close();
+
+private:
+    // 等待条件成立，超过截止时间时流失败并返回false，调用时持有mutex_
+    template <typename Predicate>
+    bool WaitLocked(std::unique_lock<std::mutex> &lock, Predicate predicate);
+
+    FrameSender sender_;
+    const Clock::time_point deadline_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    // 已收到尚未读取的消息，对端遵守额度时不超过kStreamWindow条
+    std::deque<std::string> inbound_;
+    // 服务端结束帧携带的最终响应
+    std::string final_body_;
+    // 剩余的发送额度
+    uint32_t send_credit_ = kStreamWindow;
+    // 已读取但尚未授予对端的额度
+    uint32_t consumed_ = 0;
+    // 本端已结束发送
+    bool send_closed_ = false;
+    // 对端已结束发送
+    bool recv_closed_ = false;
+    RpcErrorType status_ = RpcErrorType::SUCCESS;
+    std::string error_text_;
+
+    RpcStream(const RpcStream &) = delete;
+    RpcStream &operator=(const RpcStream &) = delete;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 用io_uring接收连接和读取数据的TCP服务端，写出和关闭仍由muduo的TcpConnection负责
+ */
+#ifndef URINGSERVER_H
+#define URINGSERVER_H
+
+#include "iouring.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <muduo/net/Callbacks.h>
+#include <muduo/net/Channel.h>
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThreadPool.h>
+#include <muduo/net/InetAddress.h>
+#include <muduo/net/TcpConnection.h>
+
+/*
+ * 每个事件循环一个io_uring实例，其fd注册到循环的epoll中。监听socket上挂一个multishot accept，
+ * 每个连接挂一个multishot recv，数据由内核直接写入注册的提供缓冲区，
+ * 稳定状态下接收连接和读取请求都不再需要accept/read系统调用，一次epoll_wait可以取回多个连接的数据。
+ * 连接建立后停止TcpConnection自己的读事件，收到的数据追加到inputBuffer()后调用消息回调，
+ * 因此与TcpServer使用同一套连接回调和消息回调。所有接口都必须在loop所在线程中调用。
+ */
+class UringServer
+{
+public:
+    /**
+     * @brief 构造函数
+     * @param loop 监听所在的事件循环
+     * @param address 监听地址
+     * @param name 名称，用作连接名前缀和IO线程名
+     * @param reuse_port 是否设置SO_REUSEPORT
+     */
+    UringServer(muduo::net::EventLoop *loop, const muduo::net::InetAddress &address, const std::string &name, bool reuse_port);
+    ~UringServer();
+
+    void SetConnectionCallback(const muduo::net::ConnectionCallback &cb) { connection_callback_ = cb; }
+    void SetMessageCallback(const muduo::net::MessageCallback &cb) { message_callback_ = cb; }
+    // IO线程数，0表示连接也在loop中处理，必须在Start之前设置
+    void SetThreadNum(int num) { thread_num_ = num; }
+    void SetThreadInitCallback(const muduo::net::EventLoopThreadPool::ThreadInitCallback &cb) { thread_init_callback_ = cb; }
+
+    /**
+     * @brief 创建各事件循环的io_uring，绑定并开始监听
+     * @return 内核不支持io_uring或监听失败时返回false，失败时已记录日志，调用方应改用epoll的ListenServer
+     */
+    bool Start();
+
+    // 停止接收新连接并关闭监听socket，已建立的连接不受影响
+    void StopAccepting();
+
+private:
+    // 一个事件循环的io_uring及其上挂的multishot recv
+    struct LoopRing
+    {
+        // 一个连接上的multishot recv
+        struct Receiver
+        {
+            std::weak_ptr<muduo::net::TcpConnection> conn;
+            int fd;
+        };
+
+        IoUring ring;
+        std::unique_ptr<muduo::net::Channel> channel;
+        // recv请求的user_data到连接的映射，请求结束(没有IORING_CQE_F_MORE)时删除
+        std::unordered_map<uint64_t, Receiver> receivers;
+        // 连接到其recv请求的user_data，连接断开时据此取消请求
+        std::unordered_map<const muduo::net::TcpConnection *, uint64_t> ids;
+        uint64_t next_id = kFirstRecvId;
+    };
+
+    // user_data的保留值：监听socket上的accept和取消请求本身，连接的recv从kFirstRecvId开始编号
+    static constexpr uint64_t kAcceptId = 0;
+    static constexpr uint64_t kCancelId = 1;
+    static constexpr uint64_t kFirstRecvId = 2;
+
+    // 在loop所在线程中创建其io_uring，失败返回false
+    bool CreateRing(muduo::net::EventLoop *loop);
+    LoopRing *FindRing(muduo::net::EventLoop *loop);
+    // io_uring的fd可读：处理所有完成项，再一次提交处理过程中产生的新请求
+    void HandleCompletions(LoopRing *ring);
+    // 在监听socket上挂multishot accept
+    void ArmAccept();
+    void HandleAccept(const io_uring_cqe &cqe);
+    // 为接收的连接创建TcpConnection并分配给IO线程
+    void NewConnection(int fd);
+    void ArmRecv(LoopRing *ring, int fd, uint64_t id);
+    void HandleRecv(LoopRing *ring, const io_uring_cqe &cqe);
+    // 包装用户的连接回调：连接建立后改由io_uring读取，断开时取消recv请求
+    void OnConnection(const muduo::net::TcpConnectionPtr &conn, int fd);
+    // 连接关闭，由连接所在的IO线程调用
+    void RemoveConnection(const muduo::net::TcpConnectionPtr &conn);
+    void RemoveConnectionInLoop(const muduo::net::TcpConnectionPtr &conn);
+
+    muduo::net::EventLoop *loop_;
+    const muduo::net::InetAddress address_;
+    const std::string name_;
+    const bool reuse_port_;
+    int listen_fd_ = -1;
+    // 预留的空闲fd，文件描述符耗尽时用它接收并立即关闭新连接
+    int idle_fd_ = -1;
+    int thread_num_ = 0;
+    muduo::net::ConnectionCallback connection_callback_;
+    muduo::net::MessageCallback message_callback_;
+    muduo::net::EventLoopThreadPool::ThreadInitCallback thread_init_callback_;
+    int next_conn_id_ = 1;
+    // 连接名到连接的映射，连接关闭前由本对象持有
+    std::map<std::string, muduo::net::TcpConnectionPtr> connections_;
+    // 事件循环到其io_uring，Start返回后不再修改，各IO线程只读
+    std::map<muduo::net::EventLoop *, std::unique_ptr<LoopRing>> rings_;
+    // 声明在rings_之后，先于rings_销毁，IO线程退出后才释放各循环的io_uring
+    std::unique_ptr<muduo::net::EventLoopThreadPool> thread_pool_;
+
+    UringServer(const UringServer &) = delete;
+    UringServer &operator=(const UringServer &) = delete;
+};
+
+#endif
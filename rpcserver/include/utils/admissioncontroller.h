@@ -0,0 +1,69 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 准入控制器，按排队时延(CoDel方式)和并发数判断过载，过载时在请求入口直接拒绝
+ */
+#ifndef ADMISSIONCONTROLLER_H
+#define ADMISSIONCONTROLLER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+class AdmissionController
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Config
+    {
+        std::chrono::milliseconds target{5};    // 可接受的排队时延，为0时不按时延拒绝
+        std::chrono::milliseconds interval{100}; // 排队时延持续超过target多久后开始拒绝
+        uint32_t max_concurrency = 0;            // 已接纳未完成的请求数上限，为0时不限制
+    };
+
+    explicit AdmissionController(const Config &config);
+
+    /**
+     * @brief 新请求到达时调用，决定是否接纳，不阻塞
+     * @return 接纳返回true，此后必须调用一次OnFinish；过载时返回false并计入拒绝数
+     */
+    bool TryAdmit();
+
+    /**
+     * @brief 已接纳的请求开始执行时调用，上报其排队时延
+     * @param queue_delay 从请求到达到开始执行的时间
+     */
+    void OnStart(Clock::duration queue_delay);
+
+    // 已接纳的请求完成时调用
+    void OnFinish();
+
+    // 是否处于过载拒绝状态
+    bool Dropping() const;
+    // 已接纳未完成的请求数
+    uint32_t Inflight() const;
+    // 累计接纳数
+    uint64_t AdmittedCount() const;
+    // 累计拒绝数
+    uint64_t ShedCount() const;
+    // 取出上次调用以来开始执行的请求的平均排队时延并重新计数，期间没有请求开始执行时返回0
+    Clock::duration TakeQueueDelay();
+
+private:
+    const Config config_;
+    std::atomic<uint32_t> inflight_{0};
+    // 过载拒绝状态
+    std::atomic_bool dropping_{false};
+    // 排队时延首次超过target后再经过interval的时间点，0表示当前未超过target
+    std::atomic<int64_t> first_above_time_{0};
+    // 拒绝状态下下一次放行探测请求的时间点，探测请求的排队时延决定是否退出拒绝状态
+    std::atomic<int64_t> next_probe_time_{0};
+    std::atomic<uint64_t> admitted_{0};
+    std::atomic<uint64_t> shed_{0};
+    // 上次TakeQueueDelay以来的排队时延之和(单位为Clock的计时单位)与请求数
+    std::atomic<int64_t> queue_delay_sum_{0};
+    std::atomic<int64_t> queue_delay_count_{0};
+};
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 线程本地的Protobuf Arena池，一次调用的请求头、请求和响应都分配在同一个Arena上，
+ *        响应写回后整体重置归还，避免逐字段malloc/free
+ */
+#ifndef ARENAPOOL_H
+#define ARENAPOOL_H
+
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <vector>
+
+// 带初始内存块的Arena，重置时保留初始块，复用时无需再次申请内存
+struct PooledArena
+{
+    explicit PooledArena(size_t initial_block_size);
+
+    std::unique_ptr<char[]> initial_block;
+    google::protobuf::Arena arena;
+};
+
+class ArenaPool
+{
+public:
+    // 归还器，Arena指针析构时重置并归还到当前线程的池中
+    struct Recycler
+    {
+        void operator()(PooledArena *pooled) const noexcept;
+    };
+    using ArenaPtr = std::unique_ptr<PooledArena, Recycler>;
+
+    // 获取当前线程的Arena池
+    static ArenaPool &ThreadLocal();
+
+    // 获取一个空的Arena，池为空时新建
+    ArenaPtr Acquire();
+
+    // 池中缓存的Arena数量
+    size_t CachedCount() const;
+
+private:
+    ArenaPool() = default;
+    ~ArenaPool();
+    // 重置并缓存Arena，超出上限时直接释放
+    void Release(PooledArena *pooled) noexcept;
+
+    // 初始块大小，覆盖绝大多数调用的请求和响应
+    static constexpr size_t kInitialBlockSize = 8 * 1024;
+    // 每个线程最多缓存的Arena数量
+    static constexpr size_t kMaxCached = 64;
+
+    std::vector<PooledArena *> free_list_;
+
+    friend struct Recycler;
+};
+
+#endif
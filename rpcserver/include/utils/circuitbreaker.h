@@ -4,8 +4,11 @@
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 class CircuitBreaker
 {
@@ -71,9 +74,13 @@ class CircuitBreakerManager
 public:
     static CircuitBreaker &GetInstance(const std::string &service_name);
 
+    // 已创建的各服务熔断器的当前状态
+    static std::vector<std::pair<std::string, CircuitBreaker::State>> GetStates();
+
 private:
     static CircuitBreaker::Config GetConfigForService(const std::string &service);
 
+    static inline std::mutex mutex_;
     static inline std::unordered_map<std::string, std::unique_ptr<CircuitBreaker>> breakers_;
 };
 
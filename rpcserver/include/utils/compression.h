@@ -0,0 +1,68 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 消息体压缩，内置LZ4块格式的压缩和解压，不依赖外部库
+ */
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 压缩算法，数值即线上取值
+enum class CompressionType : uint32_t
+{
+    NONE = 0, // 不压缩
+    LZ4 = 1   // LZ4块格式，压缩和解压都很快，适合CPU敏感的RPC
+};
+
+class Compression
+{
+public:
+    // 压缩统计，用于判断CPU和带宽的取舍
+    struct Stats
+    {
+        std::atomic<uint64_t> raw_bytes{0};          // 被压缩的消息体压缩前的字节数
+        std::atomic<uint64_t> compressed_bytes{0};   // 被压缩的消息体压缩后的字节数
+        std::atomic<uint64_t> uncompressed_bytes{0}; // 允许压缩但低于阈值或压缩无收益、按原样发送的字节数
+        std::atomic<uint64_t> decompressed_bytes{0}; // 收到的压缩消息体解压后的字节数
+    };
+
+    // 进程内所有连接共享的压缩统计
+    static Stats &GetStats();
+
+    // 由配置值("lz4"或"none")得到压缩算法，未知取值按NONE处理
+    static CompressionType Parse(const std::string &name);
+
+    /**
+     * @brief 压缩数据并追加到out，格式为：算法(1) | 原始长度(4，网络字节序) | 压缩数据
+     * @param type 压缩算法
+     * @param data 原始数据
+     * @param len 原始数据长度
+     * @param out 输出
+     * @return 算法为NONE或压缩后不比原始数据小时返回false，out不变
+     */
+    static bool Compress(CompressionType type, const char *data, size_t len, std::string *out);
+
+    /**
+     * @brief 解压Compress的输出
+     * @param data 压缩数据
+     * @param len 压缩数据长度
+     * @param max_len 允许的最大原始长度，防止恶意数据导致过量分配
+     * @param out 输出，原有内容被替换
+     * @return 算法未知、原始长度超限或数据损坏时返回false
+     */
+    static bool Decompress(const char *data, size_t len, size_t max_len, std::string *out);
+
+private:
+    // LZ4块压缩，dst至少有Lz4Bound(len)字节，返回压缩后的长度
+    static size_t Lz4Compress(const uint8_t *src, size_t len, uint8_t *dst);
+    // LZ4块解压，输出必须恰好填满dst_len字节
+    static bool Lz4Decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len);
+    // LZ4块压缩输出的最大长度
+    static size_t Lz4Bound(size_t len);
+};
+
+#endif
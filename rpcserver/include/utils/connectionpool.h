@@ -6,6 +6,7 @@
 #include <queue>
 #include <condition_variable>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <sys/epoll.h>
@@ -14,17 +15,28 @@
 #include <unistd.h>
 #include "scopedfd.h"
 
+// 传输方式
+enum class Transport
+{
+    TCP, // host:port
+    UNIX, // 同机部署时使用Unix域套接字path，省去TCP/IP协议栈的开销
+    SHM   // 同机部署时连接path上的引导套接字，之后经由服务端交来的共享内存字节环收发帧
+};
+
 // 节点信息
 struct Endpoint
 {
     // 地址和端口
     std::string host;
-    int port;
+    int port = 0;
+    // 传输方式，UNIX和SHM时连接path，host和port仅用于标识节点
+    Transport transport = Transport::TCP;
+    std::string path;
 
     // 支持比较
     bool operator==(const Endpoint &other) const
     {
-        return host == other.host && port == other.port;
+        return host == other.host && port == other.port && transport == other.transport && path == other.path;
     }
 };
 
@@ -36,7 +48,7 @@ namespace std
     {
         size_t operator()(const Endpoint &ep) const
         {
-            return hash<string>{}(ep.host) ^ (hash<int>{}(ep.port) << 1);
+            return hash<string>{}(ep.host) ^ (hash<int>{}(ep.port) << 1) ^ (hash<string>{}(ep.path) << 2);
         }
     };
 }
@@ -63,6 +75,14 @@ class ConnectionPool
     };
 
 public:
+    // 占用情况快照
+    struct Stats
+    {
+        size_t connections = 0;     // 已建立的连接数
+        size_t max_connections = 0; // 连接数上限
+        size_t waiters = 0;         // 等待空闲连接的调用数
+    };
+
     /**
      * @brief 构造函数，实现初始化epoll和启动清理线程
      * @param max_conn 最大连接数
@@ -81,6 +101,12 @@ public:
     // 获取单例
     static ConnectionPool &GetInstance();
 
+    // 单例已创建时返回它，否则返回nullptr，用于只查看状态而不创建连接池的场合
+    static ConnectionPool *ExistingInstance();
+
+    // 占用情况，只读原子计数，不加锁
+    Stats GetStats() const;
+
     /**
      * @brief 获取一个连接，如果超时则抛出异常
      * @param ep 端点信息，包括host+port
@@ -96,6 +122,13 @@ public:
      */
     void Release(int fd, const Endpoint &ep) noexcept;
 
+    /**
+     * @brief 丢弃一个已损坏的连接，关闭并归还连接配额
+     * @param fd 连接文件描述符
+     * @param ep 端点信息，包括host+port
+     */
+    void Discard(int fd, const Endpoint &ep) noexcept;
+
 private:
     // 获取分片
     PoolShard &GetShard(const Endpoint &ep);
@@ -127,8 +160,8 @@ private:
 
     static time_t Now() noexcept;
 
-    // 构建地址结构体
-    static sockaddr_in BuildAddress(const Endpoint &ep);
+    // 构建地址结构体，返回地址长度
+    static socklen_t BuildAddress(const Endpoint &ep, sockaddr_storage *addr);
 
     // 获取socket错误
     static int GetSocketError(int fd);
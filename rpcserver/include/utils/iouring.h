@@ -0,0 +1,138 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief io_uring的最小封装，直接使用系统调用，不依赖liburing，只提供multishot accept/recv和提供缓冲区环
+ */
+#ifndef IOURING_H
+#define IOURING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 内核头文件提供所需的multishot和缓冲区环定义时才编译io_uring后端，否则Supported()总是返回false
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// IORING_REGISTER_PBUF_RING是枚举值，与multishot recv同在5.19加入，无需单独检查
+#if defined(IORING_RECV_MULTISHOT) && defined(IORING_ACCEPT_MULTISHOT)
+#define RPC_WITH_IO_URING 1
+#endif
+#endif
+
+#ifndef RPC_WITH_IO_URING
+struct io_uring_sqe;
+struct io_uring_cqe;
+#endif
+
+/*
+ * 一个实例只能在一个线程中使用。提交项写入共享的提交队列，Submit时一次系统调用交给内核；
+ * 完成项直接从共享的完成队列读取，不需要系统调用。Fd()在有完成项时可读，可以注册到epoll中。
+ * multishot recv从提供缓冲区环中取缓冲区，数据处理完后用RecycleBuffer归还。
+ */
+class IoUring
+{
+public:
+    IoUring() = default;
+    ~IoUring();
+
+    // 内核是否支持本封装用到的全部特性(multishot recv需要6.0以上)，容器中io_uring可能被seccomp禁止
+    static bool Supported();
+
+    // 创建io_uring实例，entries为提交队列长度，失败返回false
+    bool Init(unsigned entries);
+
+    /**
+     * @brief 注册提供给multishot recv的缓冲区环
+     * @param group 缓冲区组id
+     * @param count 缓冲区数量，必须是2的幂
+     * @param size 每个缓冲区的字节数
+     * @return 内核不支持或内存不足时返回false
+     */
+    bool SetupBufferRing(uint16_t group, unsigned count, unsigned size);
+
+    int Fd() const { return fd_; }
+
+    // 取一个空闲的提交项，提交队列已满时先提交已有的提交项
+    io_uring_sqe *GetSqe();
+
+    // 把提交项交给内核，返回提交的数量，失败返回-errno
+    int Submit();
+
+    // 提交并等待至少一个完成项，timeout_ms<0表示一直等待，超时或被信号中断时返回-errno
+    int SubmitAndWait(int timeout_ms);
+
+    // 依次处理已有的完成项，返回处理的数量
+    template <typename F>
+    unsigned ForEachCqe(F &&f);
+
+    // 取得缓冲区id对应的缓冲区
+    char *Buffer(uint16_t id) { return buffers_.data() + static_cast<size_t>(id) * buffer_size_; }
+    // 归还缓冲区，内核可以再次用它接收数据
+    void RecycleBuffer(uint16_t id);
+
+    // 准备multishot accept，每接收一个连接产生一个完成项，res为新连接的fd
+    static void PrepMultishotAccept(io_uring_sqe *sqe, int fd, uint64_t user_data);
+    // 准备multishot recv，每次收到数据产生一个完成项，数据在flags指明的缓冲区中
+    static void PrepMultishotRecv(io_uring_sqe *sqe, int fd, uint16_t group, uint64_t user_data);
+    // 准备取消user_data对应的请求
+    static void PrepCancel(io_uring_sqe *sqe, uint64_t target, uint64_t user_data);
+
+    // 完成项的结果，accept为新连接的fd，recv为接收的字节数，失败时为-errno
+    static int32_t Result(const io_uring_cqe &cqe);
+    // 完成项对应提交项的user_data
+    static uint64_t UserData(const io_uring_cqe &cqe);
+    // 完成项是否还会有后续(multishot未结束)
+    static bool HasMore(const io_uring_cqe &cqe);
+    // 完成项使用了提供缓冲区时返回true并输出缓冲区id
+    static bool BufferId(const io_uring_cqe &cqe, uint16_t *id);
+
+private:
+    // 取得下一个完成项，没有时返回nullptr
+    io_uring_cqe *PeekCqe();
+    // 消费一个完成项
+    void AdvanceCq();
+    int Enter(unsigned to_submit, unsigned wait_nr, int timeout_ms);
+
+    int fd_ = -1;
+    // 映射的提交队列和完成队列
+    void *sq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned *sq_head_ = nullptr;
+    unsigned *sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe *cqes_ = nullptr;
+    // 已填写尚未交给内核的提交项的结束位置
+    unsigned sqe_tail_ = 0;
+    bool ext_arg_ = false;
+    // 提供缓冲区环及其缓冲区
+    void *buf_ring_ = nullptr;
+    size_t buf_ring_size_ = 0;
+    unsigned buf_count_ = 0;
+    unsigned buffer_size_ = 0;
+    std::vector<char> buffers_;
+
+    IoUring(const IoUring &) = delete;
+    IoUring &operator=(const IoUring &) = delete;
+};
+
+// 依次处理已有的完成项，返回处理的数量
+template <typename F>
+unsigned IoUring::ForEachCqe(F &&f)
+{
+    unsigned count = 0;
+    while (io_uring_cqe *cqe = PeekCqe())
+    {
+        f(*cqe);
+        AdvanceCq();
+        ++count;
+    }
+    return count;
+}
+
+#endif
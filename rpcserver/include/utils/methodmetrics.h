@@ -0,0 +1,99 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 单个RPC方法的调用统计：请求数、错误数、并发数、请求和响应字节数以及对数线性分桶的时延直方图
+ */
+#ifndef METHODMETRICS_H
+#define METHODMETRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * 记录只对当前线程所在分片做relaxed原子加，不加锁，不同线程多数落在不同缓存行上；
+ * 读取时把所有分片累加为一份快照，快照期间的并发记录可能只计入一部分，各字段之间不保证一致。
+ * 时延按微秒分桶，与HdrHistogram相同的对数线性分桶：每个2的幂区间等分为16个桶，相对误差不超过1/16。
+ */
+class MethodMetrics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // 每个2的幂区间的桶数为2^kSubBucketBits
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr unsigned kSubBucketCount = 1u << kSubBucketBits;
+    // 可区分的最大时延为2^kMaxValueBits-1微秒(约71分钟)，更大的值计入最后一个桶
+    static constexpr unsigned kMaxValueBits = 32;
+    static constexpr size_t kBucketCount = (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+    // 分片数，线程按编号取模落到分片上
+    static constexpr size_t kShardCount = 8;
+
+    // 合并所有分片后的统计快照
+    struct Snapshot
+    {
+        uint64_t requests = 0;       // 已完成的调用数
+        uint64_t errors = 0;         // 其中失败的调用数
+        uint64_t inflight = 0;       // 已开始尚未完成的调用数
+        uint64_t request_bytes = 0;  // 请求消息体累计字节数
+        uint64_t response_bytes = 0; // 响应消息体累计字节数
+        uint64_t latency_sum_us = 0; // 时延累计值，单位微秒
+        uint64_t latency_max_us = 0; // 最大时延，单位微秒
+        std::vector<uint64_t> buckets;
+
+        // 时延的q分位数(0<q<=1)，取所在桶的上界，单位微秒，没有调用时返回0
+        uint64_t Percentile(double q) const;
+        // 平均时延，单位微秒
+        double MeanLatencyUs() const;
+    };
+
+    MethodMetrics();
+
+    /**
+     * @brief 调用开始执行时调用
+     * @param request_bytes 请求消息体字节数
+     */
+    void OnStart(size_t request_bytes);
+
+    /**
+     * @brief 调用完成时调用，与OnStart可以在不同线程
+     * @param latency 从开始执行到完成的时间
+     * @param response_bytes 响应消息体字节数
+     * @param failed 调用是否失败
+     */
+    void OnFinish(Clock::duration latency, size_t response_bytes, bool failed);
+
+    // 合并所有分片得到快照
+    Snapshot Collect() const;
+
+    // 微秒值所在的桶
+    static size_t BucketIndex(uint64_t value_us);
+    // 桶中最大的微秒值
+    static uint64_t BucketUpperBound(size_t index);
+
+private:
+    // 一个分片，独占缓存行，避免不同线程的记录互相干扰
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> started{0};
+        std::atomic<uint64_t> finished{0};
+        std::atomic<uint64_t> errors{0};
+        std::atomic<uint64_t> request_bytes{0};
+        std::atomic<uint64_t> response_bytes{0};
+        std::atomic<uint64_t> latency_sum_us{0};
+        std::atomic<uint64_t> latency_max_us{0};
+        std::atomic<uint64_t> buckets[kBucketCount];
+    };
+
+    // 当前线程使用的分片
+    Shard &LocalShard();
+
+    Shard shards_[kShardCount];
+
+    MethodMetrics(const MethodMetrics &) = delete;
+    MethodMetrics &operator=(const MethodMetrics &) = delete;
+};
+
+#endif
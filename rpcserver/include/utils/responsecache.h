@@ -0,0 +1,110 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 分片LRU响应缓存，按(方法id, 请求参数)缓存序列化后的响应，带TTL和内存上限
+ */
+#ifndef RESPONSECACHE_H
+#define RESPONSECACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class ResponseCache
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using ResponsePtr = std::shared_ptr<const std::string>;
+
+    /**
+     * @brief 构造函数
+     * @param capacity_bytes 缓存占用内存上限，按请求参数和响应的字节数估算，平均分给各分片
+     * @param shard_num 分片数，分片之间互不加锁
+     */
+    explicit ResponseCache(size_t capacity_bytes, size_t shard_num = 16);
+
+    // 计算请求参数的哈希
+    static uint64_t Hash(std::string_view params);
+
+    /**
+     * @brief 查找缓存的响应
+     * @param method_id 方法id
+     * @param hash 请求参数的哈希，由Hash计算
+     * @param params 请求参数，用于排除哈希冲突
+     * @return 命中时返回响应，未命中或已过期时返回空
+     */
+    ResponsePtr Get(uint32_t method_id, uint64_t hash, std::string_view params);
+
+    /**
+     * @brief 写入响应，超过分片内存上限时淘汰最久未使用的项
+     * @param method_id 方法id
+     * @param hash 请求参数的哈希
+     * @param params 请求参数
+     * @param response 序列化后的响应
+     * @param ttl 有效期
+     */
+    void Put(uint32_t method_id, uint64_t hash, std::string params, ResponsePtr response,
+             std::chrono::milliseconds ttl);
+
+    // 缓存占用的字节数
+    size_t Bytes() const;
+    // 累计命中数
+    uint64_t HitCount() const;
+    // 累计未命中数
+    uint64_t MissCount() const;
+
+private:
+    struct Key
+    {
+        uint32_t method_id;
+        uint64_t hash;
+        bool operator==(const Key &other) const
+        {
+            return method_id == other.method_id && hash == other.hash;
+        }
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            return static_cast<size_t>(key.hash ^ (static_cast<uint64_t>(key.method_id) * 0x9e3779b97f4a7c15ULL));
+        }
+    };
+    struct Entry
+    {
+        Key key;
+        std::string params;
+        ResponsePtr response;
+        Clock::time_point expire_time;
+        size_t bytes;
+    };
+    struct Shard
+    {
+        std::mutex mutex;
+        // 头部为最近使用的项
+        std::list<Entry> lru;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+        size_t bytes = 0;
+    };
+
+    Shard &GetShard(uint64_t hash);
+    // 删除一项，调用方持有分片锁
+    static void Erase(Shard &shard, std::list<Entry>::iterator it);
+
+    const size_t shard_capacity_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+
+    ResponseCache(const ResponseCache &) = delete;
+    ResponseCache &operator=(const ResponseCache &) = delete;
+};
+
+#endif
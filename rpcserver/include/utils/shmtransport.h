@@ -0,0 +1,113 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 同机进程间的共享内存传输，一对单生产者单消费者的无锁字节环，对端空闲时才用eventfd唤醒
+ */
+#ifndef SHMTRANSPORT_H
+#define SHMTRANSPORT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*
+ * 服务端为每个连接创建一个memfd共享内存段，内含两个方向的字节环和四个eventfd，
+ * 通过Unix域套接字的SCM_RIGHTS交给客户端，之后帧直接写入字节环，不再经过内核的socket缓冲区。
+ * 套接字保持打开，只用于感知对端退出。
+ * 消费者读空字节环时登记等待，生产者写入后发现对端在等待才写eventfd，忙碌时收发不产生系统调用；
+ * 生产者遇到环满时同样登记等待，由消费者腾出空间后唤醒。
+ * 每个方向同一时刻只能有一个线程写、一个线程读。
+ */
+class ShmTransport
+{
+public:
+    // 服务端：创建共享内存段和eventfd，capacity为每个方向字节环的大小，向上取整为2的幂，失败返回nullptr
+    static std::unique_ptr<ShmTransport> Create(size_t capacity);
+
+    /**
+     * @brief 客户端：从Unix域套接字接收服务端创建的共享内存段和eventfd
+     * @param sock 已连接的Unix域套接字
+     * @param timeout_ms 等待超时时间，单位毫秒
+     * @return 超时、对端关闭或共享内存段格式不符时返回nullptr
+     */
+    static std::unique_ptr<ShmTransport> Receive(int sock, int timeout_ms);
+
+    ~ShmTransport();
+
+    // 服务端：把共享内存段和eventfd发给客户端，sock为刚接收的连接，发送缓冲区为空，不会阻塞
+    bool Send(int sock) const;
+
+    /**
+     * @brief 写入尽量多的数据，不阻塞
+     * @return 写入的字节数，小于len时已登记等待，对端腾出空间后WritableFd()可读
+     */
+    size_t Write(const char *data, size_t len);
+
+    /**
+     * @brief 读取尽量多的数据，不阻塞
+     * @return 读取的字节数，为0时已登记等待，对端写入后ReadableFd()可读
+     */
+    size_t Read(char *buf, size_t len);
+
+    // 可读的字节数，不登记等待，用于在阻塞等待前短暂自旋
+    size_t Readable() const;
+
+    // 对端写入数据后可读的eventfd
+    int ReadableFd() const { return rx_.data_fd; }
+    // 对端腾出空间后可读的eventfd
+    int WritableFd() const { return tx_.space_fd; }
+    // 清除eventfd上的通知，之后再调用Read或Write
+    static void ClearFd(int fd);
+
+private:
+    // 一个方向的字节环的控制字段，生产者和消费者各自修改的字段放在不同的缓存行
+    struct RingControl
+    {
+        alignas(64) std::atomic<uint64_t> head;             // 消费者的读位置
+        alignas(64) std::atomic<uint64_t> tail;             // 生产者的写位置
+        alignas(64) std::atomic<uint32_t> consumer_waiting; // 消费者读空后登记，生产者写入后清除并唤醒
+        alignas(64) std::atomic<uint32_t> producer_waiting; // 生产者写满后登记，消费者读取后清除并唤醒
+    };
+    // 共享内存段头部，之后依次是客户端到服务端、服务端到客户端两个字节环的数据区
+    struct SegmentHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t capacity;
+        RingControl rings[2];
+    };
+    // 本端视角的一个方向
+    struct Ring
+    {
+        RingControl *control = nullptr;
+        char *data = nullptr;
+        int data_fd = -1;  // 生产者写入后唤醒消费者
+        int space_fd = -1; // 消费者读取后唤醒生产者
+    };
+
+    ShmTransport() = default;
+    // 映射共享内存段并按本端角色设置收发方向，is_server决定哪个环用于发送
+    bool Map(int memfd, size_t size, bool is_server, const int *eventfds);
+    // 通知等待在fd上的对端
+    static void Notify(int fd);
+    // 数据区的起始偏移，按缓存行对齐
+    static size_t DataOffset();
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory ring requires lock-free 64-bit atomics");
+
+    int memfd_ = -1;
+    void *segment_ = nullptr;
+    size_t segment_size_ = 0;
+    // 以本端创建或校验时的值为准，不信任共享内存中可被对端修改的字段
+    size_t capacity_ = 0;
+    Ring tx_;
+    Ring rx_;
+    // 四个eventfd：客户端到服务端的data、space，服务端到客户端的data、space
+    int eventfds_[4] = {-1, -1, -1, -1};
+
+    ShmTransport(const ShmTransport &) = delete;
+    ShmTransport &operator=(const ShmTransport &) = delete;
+};
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * @author EkerSun
+ * @date 2026.10.17
+ * @brief 业务线程池，有界多优先级队列，可选工作窃取，用于把RPC方法的执行与muduo的IO线程解耦
+ */
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class WorkerPool
+{
+public:
+    using Task = std::function<void()>;
+
+    // 优先级数量，0最高
+    static constexpr size_t kPriorityLevels = 3;
+    // 默认优先级
+    static constexpr size_t kDefaultPriority = 1;
+    // 每取出这么多个任务，从较低优先级开始取一次，防止低优先级任务饿死
+    static constexpr size_t kStarvationInterval = 8;
+
+    /**
+     * @brief 构造函数，启动工作线程
+     * @param thread_num 工作线程数
+     * @param queue_capacity 队列容量，所有待执行任务的总数上限
+     * @param work_stealing 是否开启工作窃取，开启后每个线程有独立队列，空闲时从其他队列窃取
+     * @param name 线程池名称，用于日志
+     */
+    WorkerPool(size_t thread_num, size_t queue_capacity, bool work_stealing, const std::string &name = "WorkerPool");
+
+    /**
+     * @brief 析构函数，停止并等待所有工作线程退出，未执行的任务被丢弃
+     */
+    ~WorkerPool();
+
+    /**
+     * @brief 提交任务，不阻塞
+     * @param task 任务
+     * @param priority 优先级，0最高，超出范围时按最低优先级处理
+     * @return 队列已满或线程池已停止时返回false
+     */
+    bool Submit(Task &&task, size_t priority = kDefaultPriority);
+
+    // 停止线程池
+    void Stop();
+
+    // 待执行任务数
+    size_t QueueSize() const;
+
+    // 指定优先级的待执行任务数
+    size_t QueueSize(size_t priority) const;
+
+    // 工作线程数
+    size_t ThreadNum() const;
+
+    // 当前线程所属的线程池，不是工作线程时返回nullptr
+    static WorkerPool *Current();
+
+private:
+    // 任务队列，工作窃取模式下每个线程一个，否则所有线程共享一个，每个优先级一个双端队列
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks[kPriorityLevels];
+        // 从本队列取出的任务数，用于防饿死轮转
+        size_t pops = 0;
+    };
+
+    // 工作线程
+    void WorkerLoop(size_t index);
+    // 从本线程队列头部按优先级取任务，取不到时从其他队列尾部窃取
+    bool PopTask(size_t index, Task &task);
+
+    const size_t capacity_;
+    const bool work_stealing_;
+    const std::string name_;
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> threads_;
+    // 所有队列中的任务总数
+    std::atomic<size_t> size_{0};
+    // 各优先级的任务数
+    std::atomic<size_t> level_size_[kPriorityLevels] = {};
+    // 无工作窃取线程上下文时的轮询下标
+    std::atomic<size_t> next_queue_{0};
+    std::atomic_bool running_{true};
+    // 空闲线程在此等待
+    std::mutex wait_mutex_;
+    std::condition_variable cv_;
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+};
+
+#endif
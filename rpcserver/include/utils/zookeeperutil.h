@@ -5,7 +5,13 @@
  */
 #ifndef ZOOKEEPERUTIL_H
 #define ZOOKEEPERUTIL_H
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <vector>
 #include <zookeeper/zookeeper.h>
 #include "rpcheader.pb.h"
 
@@ -14,15 +20,45 @@ class ZooKeeperClient
 public:
     ZooKeeperClient();
     ~ZooKeeperClient();
-    // 启动ZooKeeper客户端，连接ZooKeeper服务端
+    // 启动ZooKeeper客户端，连接ZooKeeper服务端；会话过期后在后台线程中重新建立会话
     void Start();
+    // 会话过期并重新建立后在后台线程中调用，用于重新创建临时节点；传入空函数取消，返回时已没有正在执行的回调
+    void SetSessionCallback(std::function<void()> callback);
     // 在ZooKeeper服务端上根据指定的路径创建节点
     void Create(const std::string &path, std::string = "", int state = 0);
     // 根据参数指定的节点路径，获取节点的值
     bool GetData(const std::string &path, std::string &data);
+    // 删除节点，expected_data非空时只在节点的值与之相同时删除，避免删掉其他节点重新注册的值
+    bool Delete(const std::string &path, const std::string &expected_data = "");
+    // 创建临时节点，会话结束后自动删除；同路径的节点(如上次运行留下、会话尚未过期的节点)先删除再创建
+    bool CreateEphemeral(const std::string &path, const std::string &data);
+    // 只在临时节点属于本会话时删除，避免删掉重启后的新进程注册的同名节点
+    bool DeleteOwned(const std::string &path);
+    // 异步改写节点的值，不等待结果，失败时只记录日志
+    void SetDataAsync(const std::string &path, const std::string &data);
+    // 获取子节点名称列表
+    bool GetChildren(const std::string &path, std::vector<std::string> &children);
 
 private:
-    // ZooKeeper客户端句柄
+    friend void GlobalWatcher(zhandle_t *zh, int type, int state, const char *path, void *watcherCtx);
+
+    // 创建句柄并等待连接成功，stopping_时返回false
+    bool Connect();
+    // 后台线程：等待会话过期，关闭旧句柄后重新连接，再调用会话回调
+    void ReconnectLoop();
+
+    // ZooKeeper客户端句柄，重新连接时替换；使用句柄的操作持有共享锁，替换时持有独占锁
     zhandle_t *zhandle_;
+    std::shared_mutex handle_mutex_;
+    // 会话状态，由ZooKeeper的事件线程更新
+    std::mutex state_mutex_;
+    std::condition_variable state_cv_;
+    bool connected_ = false;
+    bool expired_ = false;
+    bool stopping_ = false;
+    std::thread reconnect_thread_;
+    // 会话重新建立后的回调，执行期间持有callback_mutex_
+    std::mutex callback_mutex_;
+    std::function<void()> session_callback_;
 };
 #endif
\ No newline at end of file
@@ -4,6 +4,12 @@
 #include "rpcheader.pb.h"
 #include "rpcapplication.h"
 
+ProxyServer::ProxyServer()
+    : admin_service_("gateway", [this](TheChat::StatsResponse *response)
+                     { CollectStats(response); })
+{
+}
+
 void ProxyServer::Start()
 {
     // 读取配置文件
@@ -18,6 +24,27 @@ void ProxyServer::Start()
     server.setMessageCallback(std::bind(&ProxyServer::onMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
     // 设置线程数量
     server.setThreadNum(4);
+    // 网关的客户端协议没有RPC服务分发，自省服务占用一个消息号，gateadminmsgid=0(默认)时不开放
+    int admin_message_id = RpcApplication::GetInstance().GetConfig().LoadInt("gateadminmsgid", 0);
+    if (admin_message_id != 0)
+    {
+        RegisterMessageHandler(admin_message_id, [this, admin_message_id](const std::string &content, const muduo::net::TcpConnectionPtr &conn)
+                               { onAdminMessage(admin_message_id, content, conn); });
+    }
+    // gatemetricsport非0时在gatemetricsip(默认127.0.0.1)上以Prometheus文本格式输出统计
+    int metrics_port = RpcApplication::GetInstance().GetConfig().LoadInt("gatemetricsport", 0);
+    if (metrics_port > 0)
+    {
+        std::string metrics_ip = RpcApplication::GetInstance().GetConfig().Load("gatemetricsip");
+        muduo::net::InetAddress metrics_address(metrics_ip.empty() ? "127.0.0.1" : metrics_ip,
+                                                static_cast<uint16_t>(metrics_port));
+        metrics_server_ = std::make_unique<MetricsServer>(metrics_address, [this]
+                                                          {
+                                                              TheChat::StatsResponse stats;
+                                                              admin_service_.Collect(true, &stats);
+                                                              return RpcAdminService::ToPrometheus(stats); });
+        metrics_server_->Start();
+    }
     server.start();
     loop_.loop();
 }
@@ -30,8 +57,13 @@ void ProxyServer::RegisterMessageHandler(int message_id, MessageHandler &&cb)
 // 上报链接相关信息的回调函数
 void ProxyServer::onConnection(const muduo::net::TcpConnectionPtr &conn)
 {
-    if (!conn->connected())
+    if (conn->connected())
+    {
+        connection_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
     {
+        connection_count_.fetch_sub(1, std::memory_order_relaxed);
         conn->shutdown();
     }
 }
@@ -45,3 +77,32 @@ void ProxyServer::onMessage(const muduo::net::TcpConnectionPtr &conn,
     LOG_INFO << "ProxyServer::onMessage";
     proxy_service_.RpcProcess(conn, buffer, time);
 }
+
+// 自省消息：请求内容为StatsRequest，回复带4字节长度头的ResponseHeader，content为StatsResponse
+void ProxyServer::onAdminMessage(int message_id, const std::string &content, const muduo::net::TcpConnectionPtr &conn)
+{
+    TheChat::StatsRequest request;
+    if (!request.ParseFromString(content))
+    {
+        LOG_WARN << "parse admin request failed";
+        return;
+    }
+    TheChat::StatsResponse stats;
+    // 与RPC节点一样，远程请求不返回配置
+    admin_service_.Collect(false, &stats);
+    TheChat::ResponseHeader response_header;
+    response_header.set_message_id(message_id);
+    stats.SerializeToString(response_header.mutable_content());
+    std::string frame = response_header.SerializeAsString();
+    muduo::net::Buffer buffer;
+    buffer.append(frame);
+    buffer.prependInt32(static_cast<int32_t>(frame.size()));
+    conn->send(&buffer);
+}
+
+// 收集网关自身的指标
+void ProxyServer::CollectStats(TheChat::StatsResponse *response) const
+{
+    RpcAdminService::AddMetric(response, "rpc_gateway_connections",
+                               static_cast<double>(connection_count_.load(std::memory_order_relaxed)), false);
+}
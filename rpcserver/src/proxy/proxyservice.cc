@@ -2,6 +2,7 @@
 #include "proxyservice.h"
 #include <muduo/base/Logging.h>
 #include <rpcheader.pb.h>
+#include "rpccodec.h"
 #include <redis.hpp>
 #include <functional>
 
@@ -60,37 +61,40 @@ void ProxyService::RpcProcess(const muduo::net::TcpConnectionPtr &conn,
                               muduo::Timestamp time)
 
 {
-    if (buffer->readableBytes() < sizeof(int))
+    // 循环处理缓冲区中所有完整的帧，直接在缓冲区上解析，只在交给业务回调时拷贝一次内容
+    while (buffer->readableBytes() >= sizeof(int))
     {
-        LOG_INFO << "recv data length is less than 4";
-        return;
-    }
-    const char *data = buffer->peek();
-    uint32_t network_length = *(reinterpret_cast<const uint32_t *>(data));
-    uint32_t length = ntohl(network_length);
-    if (buffer->readableBytes() < 4 + length)
-    {
-        LOG_INFO << "recv data length is less than " << length;
-        return;
-    }
-    buffer->retrieve(4);
-    std::string recv_buf = buffer->retrieveAllAsString();
+        uint32_t length = static_cast<uint32_t>(buffer->peekInt32());
+        if (buffer->readableBytes() < 4 + length)
+        {
+            LOG_INFO << "recv data length is less than " << length;
+            return;
+        }
 
-    TheChat::RequestHeader request_header;
-    if (!request_header.ParseFromString(recv_buf))
-    {
-        LOG_INFO << "parse request header failed";
-        return;
-    }
-    uint32_t message_id = request_header.message_id();
-    MessageHandler msg_handler;
-    if (!GetMessageHandler(message_id, msg_handler))
-    {
-        LOG_INFO << "message_id: " << message_id << " not found";
-        return;
+        TheChat::RequestHeader request_header;
+        const char *content = nullptr;
+        size_t content_len = 0;
+        if (!ParseInPlace(buffer->peek() + 4, length, TheChat::RequestHeader::kContentFieldNumber,
+                          &request_header, &content, &content_len))
+        {
+            LOG_INFO << "parse request header failed";
+            buffer->retrieve(4 + length);
+            continue;
+        }
+        uint32_t message_id = request_header.message_id();
+        MessageHandler msg_handler;
+        if (!GetMessageHandler(message_id, msg_handler))
+        {
+            LOG_INFO << "message_id: " << message_id << " not found";
+            buffer->retrieve(4 + length);
+            continue;
+        }
+        LOG_INFO << "message_id: " << message_id;
+        // 业务回调以std::string接收内容，这是唯一的一次拷贝
+        std::string content_str(content != nullptr ? content : "", content_len);
+        buffer->retrieve(4 + length);
+        msg_handler(content_str, conn);
     }
-    LOG_INFO << "message_id: " << message_id;
-    msg_handler(request_header.content(), conn);
 }
 
 // 注册消息回调，添加新方法，覆盖旧方法
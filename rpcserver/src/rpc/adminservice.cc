@@ -0,0 +1,301 @@
+#include "adminservice.h"
+#include <cstdio>
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <vector>
+#include "rpcapplication.h"
+#include "connectionpool.h"
+#include "circuitbreaker.h"
+
+// 输出的时延分位数
+static const std::pair<const char *, double> kQuantiles[] = {{"0.5", 0.5}, {"0.9", 0.9}, {"0.99", 0.99}, {"0.999", 0.999}};
+
+// 转义Prometheus标签值中的反斜杠、双引号和换行
+static std::string EscapeLabel(const std::string &value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value)
+    {
+        if (c == '\\' || c == '"')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (c == '\n')
+        {
+            escaped += "\\n";
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// 指标族的说明和类型行
+static void AppendFamily(std::string &out, const std::string &name, const char *type, const char *help)
+{
+    out += "# HELP " + name + " " + help + "\n";
+    out += "# TYPE " + name + " " + type + "\n";
+}
+
+// 一行样本，labels为已拼好的"a=\"x\",b=\"y\""，可为空
+static void AppendSample(std::string &out, const std::string &name, const std::string &labels, double value)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.15g", value);
+    out += name;
+    if (!labels.empty())
+    {
+        out += "{" + labels + "}";
+    }
+    out += " ";
+    out += buf;
+    out += "\n";
+}
+
+/**
+ * @brief 构造函数
+ * @param role 节点角色，provider或gateway
+ * @param collector 节点自身统计的收集函数
+ */
+RpcAdminService::RpcAdminService(std::string role, Collector collector)
+    : role_(std::move(role)),
+      collector_(std::move(collector))
+{
+}
+
+void RpcAdminService::GetStats(google::protobuf::RpcController * /*controller*/, const TheChat::StatsRequest * /*request*/,
+                               TheChat::StatsResponse *response, google::protobuf::Closure *done)
+{
+    // 服务端口可能对外可达，远程请求不返回配置，配置只从本机的HTTP指标端点输出
+    Collect(false, response);
+    done->Run();
+}
+
+/**
+ * @brief 收集本进程的统计：节点自身的统计、连接池占用、熔断器状态和配置
+ * @param include_config 是否附带配置项
+ * @param response 结果
+ */
+void RpcAdminService::Collect(bool include_config, TheChat::StatsResponse *response) const
+{
+    response->set_role(role_);
+    if (collector_)
+    {
+        collector_(response);
+    }
+    // 本进程没有发起过下游调用时连接池尚未创建，不为查看状态而创建它
+    if (ConnectionPool *pool = ConnectionPool::ExistingInstance())
+    {
+        ConnectionPool::Stats pool_stats = pool->GetStats();
+        TheChat::PoolStats *stats = response->add_pools();
+        stats->set_name("default");
+        stats->set_connections(pool_stats.connections);
+        stats->set_max_connections(pool_stats.max_connections);
+        stats->set_waiters(pool_stats.waiters);
+    }
+    for (const auto &item : CircuitBreakerManager::GetStates())
+    {
+        TheChat::BreakerStats *stats = response->add_breakers();
+        stats->set_service(item.first);
+        stats->set_state(static_cast<int32_t>(item.second));
+    }
+    if (include_config)
+    {
+        auto &config = *response->mutable_config();
+        for (const auto &item : RpcApplication::GetInstance().GetConfig().LoadAll())
+        {
+            config[item.first] = IsSensitiveKey(item.first) ? "******" : item.second;
+        }
+    }
+}
+
+// 转换为Prometheus文本格式(0.0.4)
+std::string RpcAdminService::ToPrometheus(const TheChat::StatsResponse &stats)
+{
+    std::string out;
+    AppendFamily(out, "rpc_info", "gauge", "Node role.");
+    AppendSample(out, "rpc_info", "role=\"" + EscapeLabel(stats.role()) + "\"", 1);
+
+    // 方法调用统计，同一指标族的样本必须连续输出
+    std::vector<std::string> method_labels;
+    method_labels.reserve(stats.methods_size());
+    for (const TheChat::MethodStats &method : stats.methods())
+    {
+        method_labels.push_back("method=\"" + EscapeLabel(method.name()) + "\"");
+    }
+    auto append_methods = [&](const char *name, const char *type, const char *help, auto field)
+    {
+        AppendFamily(out, name, type, help);
+        for (int i = 0; i < stats.methods_size(); ++i)
+        {
+            AppendSample(out, name, method_labels[i], static_cast<double>(field(stats.methods(i))));
+        }
+    };
+    if (stats.methods_size() != 0)
+    {
+        append_methods("rpc_method_requests_total", "counter", "Completed calls.",
+                       [](const TheChat::MethodStats &m) { return m.requests(); });
+        append_methods("rpc_method_errors_total", "counter", "Failed calls.",
+                       [](const TheChat::MethodStats &m) { return m.errors(); });
+        append_methods("rpc_method_inflight", "gauge", "Calls being executed.",
+                       [](const TheChat::MethodStats &m) { return m.inflight(); });
+        append_methods("rpc_method_request_bytes_total", "counter", "Request body bytes.",
+                       [](const TheChat::MethodStats &m) { return m.request_bytes(); });
+        append_methods("rpc_method_response_bytes_total", "counter", "Response body bytes.",
+                       [](const TheChat::MethodStats &m) { return m.response_bytes(); });
+        AppendFamily(out, "rpc_method_latency_seconds", "summary", "Call latency from execution start to response write.");
+        for (int i = 0; i < stats.methods_size(); ++i)
+        {
+            const TheChat::MethodStats &method = stats.methods(i);
+            const uint64_t quantile_us[] = {method.latency_p50_us(), method.latency_p90_us(), method.latency_p99_us(),
+                                            method.latency_p999_us()};
+            for (size_t q = 0; q < sizeof(quantile_us) / sizeof(quantile_us[0]); ++q)
+            {
+                AppendSample(out, "rpc_method_latency_seconds",
+                             method_labels[i] + ",quantile=\"" + kQuantiles[q].first + "\"", quantile_us[q] / 1e6);
+            }
+            AppendSample(out, "rpc_method_latency_seconds_sum", method_labels[i], method.latency_sum_us() / 1e6);
+            AppendSample(out, "rpc_method_latency_seconds_count", method_labels[i], static_cast<double>(method.requests()));
+        }
+        append_methods("rpc_method_latency_max_seconds", "gauge", "Maximum call latency.",
+                       [](const TheChat::MethodStats &m) { return m.latency_max_us() / 1e6; });
+    }
+
+    // 节点自身的数值指标，按名字归并为指标族，保持首次出现的顺序
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::vector<const TheChat::MetricValue *>> families;
+    for (const TheChat::MetricValue &metric : stats.metrics())
+    {
+        auto &family = families[metric.name()];
+        if (family.empty())
+        {
+            names.push_back(metric.name());
+        }
+        family.push_back(&metric);
+    }
+    for (const std::string &name : names)
+    {
+        const auto &family = families[name];
+        AppendFamily(out, name, family.front()->counter() ? "counter" : "gauge", "Node metric.");
+        for (const TheChat::MetricValue *metric : family)
+        {
+            // map的遍历顺序不固定，按标签名排序后输出
+            std::vector<std::pair<std::string, std::string>> labels(metric->labels().begin(), metric->labels().end());
+            std::sort(labels.begin(), labels.end());
+            std::string label_text;
+            for (const auto &label : labels)
+            {
+                label_text += (label_text.empty() ? "" : ",") + label.first + "=\"" + EscapeLabel(label.second) + "\"";
+            }
+            AppendSample(out, name, label_text, metric->value());
+        }
+    }
+
+    if (stats.pools_size() != 0)
+    {
+        AppendFamily(out, "rpc_connection_pool_connections", "gauge", "Established client connections.");
+        for (const TheChat::PoolStats &pool : stats.pools())
+        {
+            AppendSample(out, "rpc_connection_pool_connections", "pool=\"" + EscapeLabel(pool.name()) + "\"",
+                         static_cast<double>(pool.connections()));
+        }
+        AppendFamily(out, "rpc_connection_pool_max_connections", "gauge", "Client connection limit.");
+        for (const TheChat::PoolStats &pool : stats.pools())
+        {
+            AppendSample(out, "rpc_connection_pool_max_connections", "pool=\"" + EscapeLabel(pool.name()) + "\"",
+                         static_cast<double>(pool.max_connections()));
+        }
+        AppendFamily(out, "rpc_connection_pool_waiters", "gauge", "Calls waiting for a client connection.");
+        for (const TheChat::PoolStats &pool : stats.pools())
+        {
+            AppendSample(out, "rpc_connection_pool_waiters", "pool=\"" + EscapeLabel(pool.name()) + "\"",
+                         static_cast<double>(pool.waiters()));
+        }
+    }
+    if (stats.breakers_size() != 0)
+    {
+        AppendFamily(out, "rpc_circuit_breaker_state", "gauge", "Circuit breaker state: 0 closed, 1 open, 2 half open.");
+        for (const TheChat::BreakerStats &breaker : stats.breakers())
+        {
+            AppendSample(out, "rpc_circuit_breaker_state", "service=\"" + EscapeLabel(breaker.service()) + "\"",
+                         breaker.state());
+        }
+    }
+    if (!stats.config().empty())
+    {
+        std::vector<std::pair<std::string, std::string>> config(stats.config().begin(), stats.config().end());
+        std::sort(config.begin(), config.end());
+        AppendFamily(out, "rpc_config_info", "gauge", "Configuration entries.");
+        for (const auto &item : config)
+        {
+            AppendSample(out, "rpc_config_info",
+                         "key=\"" + EscapeLabel(item.first) + "\",value=\"" + EscapeLabel(item.second) + "\"", 1);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief 把方法调用统计快照写入MethodStats
+ * @param name 方法名Service.Method
+ * @param snapshot 统计快照
+ * @param stats 结果
+ */
+void RpcAdminService::FillMethodStats(const std::string &name, const MethodMetrics::Snapshot &snapshot,
+                                      TheChat::MethodStats *stats)
+{
+    stats->set_name(name);
+    stats->set_requests(snapshot.requests);
+    stats->set_errors(snapshot.errors);
+    stats->set_inflight(snapshot.inflight);
+    stats->set_request_bytes(snapshot.request_bytes);
+    stats->set_response_bytes(snapshot.response_bytes);
+    stats->set_latency_sum_us(snapshot.latency_sum_us);
+    stats->set_latency_max_us(snapshot.latency_max_us);
+    stats->set_latency_p50_us(snapshot.Percentile(kQuantiles[0].second));
+    stats->set_latency_p90_us(snapshot.Percentile(kQuantiles[1].second));
+    stats->set_latency_p99_us(snapshot.Percentile(kQuantiles[2].second));
+    stats->set_latency_p999_us(snapshot.Percentile(kQuantiles[3].second));
+}
+
+/**
+ * @brief 添加一个数值指标
+ * @param response 结果
+ * @param name 指标名
+ * @param value 取值
+ * @param counter 是否为只增不减的累计值
+ * @param labels 标签，可为空
+ */
+void RpcAdminService::AddMetric(TheChat::StatsResponse *response, const std::string &name, double value, bool counter,
+                                std::initializer_list<std::pair<const char *, std::string>> labels)
+{
+    TheChat::MetricValue *metric = response->add_metrics();
+    metric->set_name(name);
+    metric->set_value(value);
+    metric->set_counter(counter);
+    for (const auto &label : labels)
+    {
+        (*metric->mutable_labels())[label.first] = label.second;
+    }
+}
+
+// 配置项的值是否需要隐去(口令、密钥等)
+bool RpcAdminService::IsSensitiveKey(const std::string &key)
+{
+    std::string lower(key);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c)
+                   { return static_cast<char>(std::tolower(c)); });
+    for (const char *word : {"password", "passwd", "secret", "token", "auth"})
+    {
+        if (lower.find(word) != std::string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
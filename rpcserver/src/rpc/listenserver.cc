@@ -0,0 +1,238 @@
+#include "listenserver.h"
+#include "asynclogger.h"
+#include "shmtransport.h"
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @brief 构造函数，监听TCP地址
+ * @param loop 监听所在的事件循环
+ * @param address 监听地址
+ * @param name 名称，用作连接名前缀和IO线程名
+ * @param reuse_port 是否设置SO_REUSEPORT
+ */
+ListenServer::ListenServer(muduo::net::EventLoop *loop, const muduo::net::InetAddress &address, const std::string &name,
+                           bool reuse_port)
+    : loop_(loop),
+      address_(address),
+      name_(name),
+      reuse_port_(reuse_port),
+      idle_fd_(open("/dev/null", O_RDONLY | O_CLOEXEC))
+{
+}
+
+/**
+ * @brief 构造函数，监听Unix域套接字
+ * @param loop 监听所在的事件循环
+ * @param path 套接字文件路径
+ * @param name 名称，用作连接名前缀和IO线程名
+ */
+ListenServer::ListenServer(muduo::net::EventLoop *loop, const std::string &path, const std::string &name)
+    : loop_(loop),
+      path_(path),
+      name_(name),
+      idle_fd_(open("/dev/null", O_RDONLY | O_CLOEXEC))
+{
+}
+
+ListenServer::~ListenServer()
+{
+    StopAccepting();
+    // 与TcpServer一样，在各连接所在的IO线程中销毁连接
+    for (auto &item : connections_)
+    {
+        muduo::net::TcpConnectionPtr conn(item.second);
+        item.second.reset();
+        conn->getLoop()->runInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+    }
+    if (idle_fd_ >= 0)
+    {
+        close(idle_fd_);
+    }
+}
+
+/**
+ * @brief 绑定并开始监听，Unix域套接字先删除残留的套接字文件
+ * @return 成功返回true，失败时已记录日志
+ */
+bool ListenServer::Start()
+{
+    listen_fd_ = path_.empty() ? ListenTcp() : ListenUnix();
+    if (listen_fd_ < 0)
+    {
+        return false;
+    }
+
+    thread_pool_ = std::make_unique<muduo::net::EventLoopThreadPool>(loop_, name_);
+    thread_pool_->setThreadNum(thread_num_);
+    thread_pool_->start(thread_init_callback_);
+
+    accept_channel_ = std::make_unique<muduo::net::Channel>(loop_, listen_fd_);
+    accept_channel_->setReadCallback(std::bind(&ListenServer::HandleAccept, this, std::placeholders::_1));
+    accept_channel_->enableReading();
+    return true;
+}
+
+// 创建监听socket，失败时返回-1并记录日志
+int ListenServer::ListenTcp()
+{
+    const sockaddr *addr = address_.getSockAddr();
+    int fd = socket(addr->sa_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+    if (fd < 0)
+    {
+        LOG_ERROR << "socket() failed: " << strerror(errno);
+        return -1;
+    }
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (reuse_port_)
+    {
+        setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on));
+    }
+    const socklen_t addr_len = addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
+    if (bind(fd, addr, addr_len) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        LOG_ERROR << "listen on " << address_.toIpPort() << " failed: " << strerror(errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int ListenServer::ListenUnix()
+{
+    sockaddr_un addr{};
+    if (path_.size() >= sizeof(addr.sun_path))
+    {
+        LOG_ERROR << "invalid unix socket path: " << path_;
+        return -1;
+    }
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path_.c_str(), path_.size() + 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        LOG_ERROR << "unix socket() failed: " << strerror(errno);
+        return -1;
+    }
+    // 上次异常退出留下的套接字文件会让bind失败
+    unlink(path_.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr *>(&addr), static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path_.size() + 1)) < 0 ||
+        listen(fd, SOMAXCONN) < 0)
+    {
+        LOG_ERROR << "listen on " << path_ << " failed: " << strerror(errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 日志中的监听地址
+std::string ListenServer::Where() const
+{
+    return path_.empty() ? address_.toIpPort() : path_;
+}
+
+// 停止接收新连接并关闭监听socket，Unix域套接字同时删除套接字文件，已建立的连接不受影响
+void ListenServer::StopAccepting()
+{
+    if (listen_fd_ < 0)
+    {
+        return;
+    }
+    // 先从epoll中移除再关闭，fd编号不会被其他对象复用后误删
+    accept_channel_->disableAll();
+    accept_channel_->remove();
+    accept_channel_.reset();
+    close(listen_fd_);
+    listen_fd_ = -1;
+    if (!path_.empty())
+    {
+        unlink(path_.c_str());
+    }
+    LOG_INFO << "stopped accepting on " << Where();
+}
+
+// 监听socket可读：接收一个新连接并分配给IO线程
+void ListenServer::HandleAccept(muduo::Timestamp)
+{
+    int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+        if (errno == EMFILE && idle_fd_ >= 0)
+        {
+            // 让出预留的fd接收并关闭这个连接，对端会看到连接被关闭而不是一直等待
+            close(idle_fd_);
+            idle_fd_ = accept(listen_fd_, nullptr, nullptr);
+            close(idle_fd_);
+            idle_fd_ = open("/dev/null", O_RDONLY | O_CLOEXEC);
+        }
+        else if (errno != EAGAIN && errno != EINTR && errno != ECONNABORTED)
+        {
+            LOG_ERROR << "accept on " << Where() << " failed: " << strerror(errno);
+        }
+        return;
+    }
+    std::shared_ptr<ShmTransport> shm;
+    if (shm_capacity_ != 0)
+    {
+        // 新连接的发送缓冲区为空，发送共享内存段不会阻塞
+        shm = ShmTransport::Create(shm_capacity_);
+        if (!shm || !shm->Send(fd))
+        {
+            LOG_ERROR << "set up shared memory on " << path_ << " failed: " << strerror(errno);
+            close(fd);
+            return;
+        }
+    }
+    muduo::net::EventLoop *io_loop = thread_pool_->getNextLoop();
+    std::string conn_name;
+    muduo::net::InetAddress local_address;
+    muduo::net::InetAddress peer_address;
+    if (path_.empty())
+    {
+        // 与TcpServer的连接名和地址一致
+        sockaddr_in6 local{};
+        sockaddr_in6 peer{};
+        socklen_t len = sizeof(local);
+        getsockname(fd, reinterpret_cast<sockaddr *>(&local), &len);
+        len = sizeof(peer);
+        getpeername(fd, reinterpret_cast<sockaddr *>(&peer), &len);
+        local_address = muduo::net::InetAddress(local);
+        peer_address = muduo::net::InetAddress(peer);
+        conn_name = name_ + "-" + address_.toIpPort() + "#" + std::to_string(next_conn_id_++);
+    }
+    else
+    {
+        // Unix域套接字没有IP地址，本端和对端地址都留空
+        conn_name = name_ + "#" + std::to_string(next_conn_id_++);
+    }
+    auto conn = std::make_shared<muduo::net::TcpConnection>(io_loop, conn_name, fd, local_address, peer_address);
+    if (shm)
+    {
+        conn->setContext(shm);
+    }
+    connections_[conn_name] = conn;
+    conn->setConnectionCallback(connection_callback_);
+    conn->setMessageCallback(message_callback_);
+    conn->setCloseCallback(std::bind(&ListenServer::RemoveConnection, this, std::placeholders::_1));
+    io_loop->runInLoop(std::bind(&muduo::net::TcpConnection::connectEstablished, conn));
+}
+
+// 连接关闭，由连接所在的IO线程调用
+void ListenServer::RemoveConnection(const muduo::net::TcpConnectionPtr &conn)
+{
+    loop_->runInLoop(std::bind(&ListenServer::RemoveConnectionInLoop, this, conn));
+}
+
+void ListenServer::RemoveConnectionInLoop(const muduo::net::TcpConnectionPtr &conn)
+{
+    connections_.erase(conn->name());
+    conn->getLoop()->queueInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+}
@@ -0,0 +1,111 @@
+#include "metricsserver.h"
+#include <algorithm>
+#include <cstring>
+#include <muduo/net/TcpServer.h>
+#include "asynclogger.h"
+
+// 请求头的最大长度，超过时直接关闭连接
+static constexpr size_t kMaxRequestBytes = 8192;
+
+/**
+ * @brief 构造函数
+ * @param address 监听地址，通常为127.0.0.1
+ * @param renderer 生成Prometheus文本的函数，在监听线程中调用
+ */
+MetricsServer::MetricsServer(const muduo::net::InetAddress &address, Renderer renderer)
+    : address_(address),
+      renderer_(std::move(renderer))
+{
+}
+
+// 停止监听循环并等待线程退出
+MetricsServer::~MetricsServer()
+{
+    if (muduo::net::EventLoop *loop = loop_.load())
+    {
+        loop->quit();
+    }
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+// 启动监听线程，监听开始后返回
+void MetricsServer::Start()
+{
+    std::promise<void> started;
+    std::future<void> future = started.get_future();
+    thread_ = std::thread(&MetricsServer::ThreadFunc, this, &started);
+    future.wait();
+    LOG_INFO << "metrics endpoint listening at http://" << address_.toIpPort() << "/metrics";
+}
+
+// 监听线程：创建、运行和销毁TcpServer
+void MetricsServer::ThreadFunc(std::promise<void> *started)
+{
+    muduo::net::EventLoop loop;
+    muduo::net::TcpServer server(&loop, address_, "MetricsServer");
+    server.setMessageCallback(std::bind(&MetricsServer::OnMessage, this, std::placeholders::_1,
+                                        std::placeholders::_2, std::placeholders::_3));
+    server.start();
+    loop_.store(&loop);
+    started->set_value();
+    loop.loop();
+    loop_.store(nullptr);
+}
+
+void MetricsServer::OnMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp)
+{
+    // 等待完整的请求头，只看请求行，忽略其余请求头和请求体
+    static const char kHeaderEnd[] = "\r\n\r\n";
+    const char *begin = buffer->peek();
+    const char *end = begin + buffer->readableBytes();
+    const char *header_end = std::search(begin, end, kHeaderEnd, kHeaderEnd + 4);
+    if (header_end == end)
+    {
+        if (buffer->readableBytes() > kMaxRequestBytes)
+        {
+            buffer->retrieveAll();
+            conn->forceClose();
+        }
+        return;
+    }
+    std::string request_line(begin, std::search(begin, header_end + 2, kHeaderEnd, kHeaderEnd + 2));
+    buffer->retrieveAll();
+
+    // 请求行：方法 路径 版本
+    size_t method_end = request_line.find(' ');
+    size_t path_end = method_end == std::string::npos ? std::string::npos : request_line.find(' ', method_end + 1);
+    if (path_end == std::string::npos)
+    {
+        Reply(conn, "400 Bad Request", "bad request\n");
+        return;
+    }
+    std::string method = request_line.substr(0, method_end);
+    std::string path = request_line.substr(method_end + 1, path_end - method_end - 1);
+    path = path.substr(0, path.find('?'));
+    if (method != "GET")
+    {
+        Reply(conn, "405 Method Not Allowed", "only GET is supported\n");
+    }
+    else if (path == "/metrics")
+    {
+        Reply(conn, "200 OK", renderer_());
+    }
+    else
+    {
+        Reply(conn, "404 Not Found", "try /metrics\n");
+    }
+}
+
+// 写回响应并在写完后关闭连接
+void MetricsServer::Reply(const muduo::net::TcpConnectionPtr &conn, const char *status, const std::string &body)
+{
+    std::string response = std::string("HTTP/1.1 ") + status + "\r\n" +
+                           "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n" +
+                           "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+                           "Connection: close\r\n\r\n" + body;
+    conn->send(response);
+    conn->shutdown();
+}
@@ -0,0 +1,2383 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpcadmin.proto
+
+#include "rpcadmin.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace TheChat {
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.include_config_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR MethodStats::MethodStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.requests_)*/uint64_t{0u}
+  , /*decltype(_impl_.errors_)*/uint64_t{0u}
+  , /*decltype(_impl_.inflight_)*/uint64_t{0u}
+  , /*decltype(_impl_.request_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.response_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_sum_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_max_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_p50_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_p90_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_p99_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.latency_p999_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MethodStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MethodStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MethodStatsDefaultTypeInternal() {}
+  union {
+    MethodStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MethodStatsDefaultTypeInternal _MethodStats_default_instance_;
+PROTOBUF_CONSTEXPR MetricValue_LabelsEntry_DoNotUse::MetricValue_LabelsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MetricValue_LabelsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricValue_LabelsEntry_DoNotUseDefaultTypeInternal _MetricValue_LabelsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR MetricValue::MetricValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.labels_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.counter_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricValueDefaultTypeInternal() {}
+  union {
+    MetricValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+PROTOBUF_CONSTEXPR PoolStats::PoolStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.connections_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_connections_)*/uint64_t{0u}
+  , /*decltype(_impl_.waiters_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PoolStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PoolStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PoolStatsDefaultTypeInternal() {}
+  union {
+    PoolStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PoolStatsDefaultTypeInternal _PoolStats_default_instance_;
+PROTOBUF_CONSTEXPR BreakerStats::BreakerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BreakerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BreakerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BreakerStatsDefaultTypeInternal() {}
+  union {
+    BreakerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BreakerStatsDefaultTypeInternal _BreakerStats_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse_ConfigEntry_DoNotUse::StatsResponse_ConfigEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    StatsResponse_ConfigEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponse_ConfigEntry_DoNotUseDefaultTypeInternal _StatsResponse_ConfigEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse::StatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.methods_)*/{}
+  , /*decltype(_impl_.metrics_)*/{}
+  , /*decltype(_impl_.pools_)*/{}
+  , /*decltype(_impl_.breakers_)*/{}
+  , /*decltype(_impl_.config_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.role_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponseDefaultTypeInternal() {}
+  union {
+    StatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+}  // namespace TheChat
+static ::_pb::Metadata file_level_metadata_rpcadmin_2eproto[8];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpcadmin_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_rpcadmin_2eproto[1];
+
+const uint32_t TableStruct_rpcadmin_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsRequest, _impl_.include_config_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.requests_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.errors_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.inflight_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.request_bytes_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.response_bytes_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_sum_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_max_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_p50_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_p90_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_p99_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MethodStats, _impl_.latency_p999_us_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue_LabelsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue_LabelsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue_LabelsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue_LabelsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue, _impl_.counter_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::MetricValue, _impl_.labels_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::PoolStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::PoolStats, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::PoolStats, _impl_.connections_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::PoolStats, _impl_.max_connections_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::PoolStats, _impl_.waiters_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::BreakerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::BreakerStats, _impl_.service_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::BreakerStats, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse_ConfigEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse_ConfigEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse_ConfigEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse_ConfigEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.role_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.methods_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.metrics_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.pools_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.breakers_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::StatsResponse, _impl_.config_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::TheChat::StatsRequest)},
+  { 7, -1, -1, sizeof(::TheChat::MethodStats)},
+  { 25, 33, -1, sizeof(::TheChat::MetricValue_LabelsEntry_DoNotUse)},
+  { 35, -1, -1, sizeof(::TheChat::MetricValue)},
+  { 45, -1, -1, sizeof(::TheChat::PoolStats)},
+  { 55, -1, -1, sizeof(::TheChat::BreakerStats)},
+  { 63, 71, -1, sizeof(::TheChat::StatsResponse_ConfigEntry_DoNotUse)},
+  { 73, -1, -1, sizeof(::TheChat::StatsResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TheChat::_StatsRequest_default_instance_._instance,
+  &::TheChat::_MethodStats_default_instance_._instance,
+  &::TheChat::_MetricValue_LabelsEntry_DoNotUse_default_instance_._instance,
+  &::TheChat::_MetricValue_default_instance_._instance,
+  &::TheChat::_PoolStats_default_instance_._instance,
+  &::TheChat::_BreakerStats_default_instance_._instance,
+  &::TheChat::_StatsResponse_ConfigEntry_DoNotUse_default_instance_._instance,
+  &::TheChat::_StatsResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rpcadmin_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016rpcadmin.proto\022\007TheChat\"&\n\014StatsReques"
+  "t\022\026\n\016include_config\030\001 \001(\010\"\217\002\n\013MethodStat"
+  "s\022\014\n\004name\030\001 \001(\t\022\020\n\010requests\030\002 \001(\004\022\016\n\006err"
+  "ors\030\003 \001(\004\022\020\n\010inflight\030\004 \001(\004\022\025\n\rrequest_b"
+  "ytes\030\005 \001(\004\022\026\n\016response_bytes\030\006 \001(\004\022\026\n\016la"
+  "tency_sum_us\030\007 \001(\004\022\026\n\016latency_max_us\030\010 \001"
+  "(\004\022\026\n\016latency_p50_us\030\t \001(\004\022\026\n\016latency_p9"
+  "0_us\030\n \001(\004\022\026\n\016latency_p99_us\030\013 \001(\004\022\027\n\017la"
+  "tency_p999_us\030\014 \001(\004\"\234\001\n\013MetricValue\022\014\n\004n"
+  "ame\030\001 \001(\t\022\r\n\005value\030\002 \001(\001\022\017\n\007counter\030\003 \001("
+  "\010\0220\n\006labels\030\004 \003(\0132 .TheChat.MetricValue."
+  "LabelsEntry\032-\n\013LabelsEntry\022\013\n\003key\030\001 \001(\t\022"
+  "\r\n\005value\030\002 \001(\t:\0028\001\"X\n\tPoolStats\022\014\n\004name\030"
+  "\001 \001(\t\022\023\n\013connections\030\002 \001(\004\022\027\n\017max_connec"
+  "tions\030\003 \001(\004\022\017\n\007waiters\030\004 \001(\004\".\n\014BreakerS"
+  "tats\022\017\n\007service\030\001 \001(\t\022\r\n\005state\030\002 \001(\005\"\232\002\n"
+  "\rStatsResponse\022\014\n\004role\030\001 \001(\t\022%\n\007methods\030"
+  "\002 \003(\0132\024.TheChat.MethodStats\022%\n\007metrics\030\003"
+  " \003(\0132\024.TheChat.MetricValue\022!\n\005pools\030\004 \003("
+  "\0132\022.TheChat.PoolStats\022\'\n\010breakers\030\005 \003(\0132"
+  "\025.TheChat.BreakerStats\0222\n\006config\030\006 \003(\0132\""
+  ".TheChat.StatsResponse.ConfigEntry\032-\n\013Co"
+  "nfigEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028"
+  "\0012I\n\014AdminService\0229\n\010GetStats\022\025.TheChat."
+  "StatsRequest\032\026.TheChat.StatsResponseB\003\200\001"
+  "\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_rpcadmin_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpcadmin_2eproto = {
+    false, false, 1009, descriptor_table_protodef_rpcadmin_2eproto,
+    "rpcadmin.proto",
+    &descriptor_table_rpcadmin_2eproto_once, nullptr, 0, 8,
+    schemas, file_default_instances, TableStruct_rpcadmin_2eproto::offsets,
+    file_level_metadata_rpcadmin_2eproto, file_level_enum_descriptors_rpcadmin_2eproto,
+    file_level_service_descriptors_rpcadmin_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcadmin_2eproto_getter() {
+  return &descriptor_table_rpcadmin_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcadmin_2eproto(&descriptor_table_rpcadmin_2eproto);
+namespace TheChat {
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.include_config_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.include_config_ = from._impl_.include_config_;
+  // @@protoc_insertion_point(copy_constructor:TheChat.StatsRequest)
+}
+
+inline void StatsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.include_config_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatsRequest::~StatsRequest() {
+  // @@protoc_insertion_point(destructor:TheChat.StatsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StatsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.StatsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.include_config_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool include_config = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.include_config_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.StatsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool include_config = 1;
+  if (this->_internal_include_config() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_include_config(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.StatsRequest)
+  return target;
+}
+
+size_t StatsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.StatsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool include_config = 1;
+  if (this->_internal_include_config() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+void StatsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsRequest*>(&to_msg);
+  auto& from = static_cast<const StatsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.StatsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_include_config() != 0) {
+    _this->_internal_set_include_config(from._internal_include_config());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsRequest::CopyFrom(const StatsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.StatsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsRequest::IsInitialized() const {
+  return true;
+}
+
+void StatsRequest::InternalSwap(StatsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.include_config_, other->_impl_.include_config_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[0]);
+}
+
+// ===================================================================
+
+class MethodStats::_Internal {
+ public:
+};
+
+MethodStats::MethodStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.MethodStats)
+}
+MethodStats::MethodStats(const MethodStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MethodStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.requests_){}
+    , decltype(_impl_.errors_){}
+    , decltype(_impl_.inflight_){}
+    , decltype(_impl_.request_bytes_){}
+    , decltype(_impl_.response_bytes_){}
+    , decltype(_impl_.latency_sum_us_){}
+    , decltype(_impl_.latency_max_us_){}
+    , decltype(_impl_.latency_p50_us_){}
+    , decltype(_impl_.latency_p90_us_){}
+    , decltype(_impl_.latency_p99_us_){}
+    , decltype(_impl_.latency_p999_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.requests_, &from._impl_.requests_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.latency_p999_us_) -
+    reinterpret_cast<char*>(&_impl_.requests_)) + sizeof(_impl_.latency_p999_us_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.MethodStats)
+}
+
+inline void MethodStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.requests_){uint64_t{0u}}
+    , decltype(_impl_.errors_){uint64_t{0u}}
+    , decltype(_impl_.inflight_){uint64_t{0u}}
+    , decltype(_impl_.request_bytes_){uint64_t{0u}}
+    , decltype(_impl_.response_bytes_){uint64_t{0u}}
+    , decltype(_impl_.latency_sum_us_){uint64_t{0u}}
+    , decltype(_impl_.latency_max_us_){uint64_t{0u}}
+    , decltype(_impl_.latency_p50_us_){uint64_t{0u}}
+    , decltype(_impl_.latency_p90_us_){uint64_t{0u}}
+    , decltype(_impl_.latency_p99_us_){uint64_t{0u}}
+    , decltype(_impl_.latency_p999_us_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MethodStats::~MethodStats() {
+  // @@protoc_insertion_point(destructor:TheChat.MethodStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MethodStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void MethodStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MethodStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.MethodStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.requests_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.latency_p999_us_) -
+      reinterpret_cast<char*>(&_impl_.requests_)) + sizeof(_impl_.latency_p999_us_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MethodStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.MethodStats.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 requests = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.requests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 errors = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.errors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 inflight = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.request_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 response_bytes = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.response_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_sum_us = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.latency_sum_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_max_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.latency_max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_p50_us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.latency_p50_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_p90_us = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.latency_p90_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_p99_us = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.latency_p99_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_p999_us = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.latency_p999_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MethodStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.MethodStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.MethodStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 requests = 2;
+  if (this->_internal_requests() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_requests(), target);
+  }
+
+  // uint64 errors = 3;
+  if (this->_internal_errors() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_errors(), target);
+  }
+
+  // uint64 inflight = 4;
+  if (this->_internal_inflight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_inflight(), target);
+  }
+
+  // uint64 request_bytes = 5;
+  if (this->_internal_request_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_request_bytes(), target);
+  }
+
+  // uint64 response_bytes = 6;
+  if (this->_internal_response_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_response_bytes(), target);
+  }
+
+  // uint64 latency_sum_us = 7;
+  if (this->_internal_latency_sum_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_latency_sum_us(), target);
+  }
+
+  // uint64 latency_max_us = 8;
+  if (this->_internal_latency_max_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_latency_max_us(), target);
+  }
+
+  // uint64 latency_p50_us = 9;
+  if (this->_internal_latency_p50_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_latency_p50_us(), target);
+  }
+
+  // uint64 latency_p90_us = 10;
+  if (this->_internal_latency_p90_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_latency_p90_us(), target);
+  }
+
+  // uint64 latency_p99_us = 11;
+  if (this->_internal_latency_p99_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_latency_p99_us(), target);
+  }
+
+  // uint64 latency_p999_us = 12;
+  if (this->_internal_latency_p999_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_latency_p999_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.MethodStats)
+  return target;
+}
+
+size_t MethodStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.MethodStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 requests = 2;
+  if (this->_internal_requests() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_requests());
+  }
+
+  // uint64 errors = 3;
+  if (this->_internal_errors() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_errors());
+  }
+
+  // uint64 inflight = 4;
+  if (this->_internal_inflight() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_inflight());
+  }
+
+  // uint64 request_bytes = 5;
+  if (this->_internal_request_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_bytes());
+  }
+
+  // uint64 response_bytes = 6;
+  if (this->_internal_response_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_response_bytes());
+  }
+
+  // uint64 latency_sum_us = 7;
+  if (this->_internal_latency_sum_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_sum_us());
+  }
+
+  // uint64 latency_max_us = 8;
+  if (this->_internal_latency_max_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_max_us());
+  }
+
+  // uint64 latency_p50_us = 9;
+  if (this->_internal_latency_p50_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_p50_us());
+  }
+
+  // uint64 latency_p90_us = 10;
+  if (this->_internal_latency_p90_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_p90_us());
+  }
+
+  // uint64 latency_p99_us = 11;
+  if (this->_internal_latency_p99_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_p99_us());
+  }
+
+  // uint64 latency_p999_us = 12;
+  if (this->_internal_latency_p999_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_p999_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MethodStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MethodStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MethodStats::GetClassData() const { return &_class_data_; }
+
+
+void MethodStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MethodStats*>(&to_msg);
+  auto& from = static_cast<const MethodStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.MethodStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_requests() != 0) {
+    _this->_internal_set_requests(from._internal_requests());
+  }
+  if (from._internal_errors() != 0) {
+    _this->_internal_set_errors(from._internal_errors());
+  }
+  if (from._internal_inflight() != 0) {
+    _this->_internal_set_inflight(from._internal_inflight());
+  }
+  if (from._internal_request_bytes() != 0) {
+    _this->_internal_set_request_bytes(from._internal_request_bytes());
+  }
+  if (from._internal_response_bytes() != 0) {
+    _this->_internal_set_response_bytes(from._internal_response_bytes());
+  }
+  if (from._internal_latency_sum_us() != 0) {
+    _this->_internal_set_latency_sum_us(from._internal_latency_sum_us());
+  }
+  if (from._internal_latency_max_us() != 0) {
+    _this->_internal_set_latency_max_us(from._internal_latency_max_us());
+  }
+  if (from._internal_latency_p50_us() != 0) {
+    _this->_internal_set_latency_p50_us(from._internal_latency_p50_us());
+  }
+  if (from._internal_latency_p90_us() != 0) {
+    _this->_internal_set_latency_p90_us(from._internal_latency_p90_us());
+  }
+  if (from._internal_latency_p99_us() != 0) {
+    _this->_internal_set_latency_p99_us(from._internal_latency_p99_us());
+  }
+  if (from._internal_latency_p999_us() != 0) {
+    _this->_internal_set_latency_p999_us(from._internal_latency_p999_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MethodStats::CopyFrom(const MethodStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.MethodStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MethodStats::IsInitialized() const {
+  return true;
+}
+
+void MethodStats::InternalSwap(MethodStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MethodStats, _impl_.latency_p999_us_)
+      + sizeof(MethodStats::_impl_.latency_p999_us_)
+      - PROTOBUF_FIELD_OFFSET(MethodStats, _impl_.requests_)>(
+          reinterpret_cast<char*>(&_impl_.requests_),
+          reinterpret_cast<char*>(&other->_impl_.requests_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MethodStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[1]);
+}
+
+// ===================================================================
+
+MetricValue_LabelsEntry_DoNotUse::MetricValue_LabelsEntry_DoNotUse() {}
+MetricValue_LabelsEntry_DoNotUse::MetricValue_LabelsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MetricValue_LabelsEntry_DoNotUse::MergeFrom(const MetricValue_LabelsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MetricValue_LabelsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[2]);
+}
+
+// ===================================================================
+
+class MetricValue::_Internal {
+ public:
+};
+
+MetricValue::MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &MetricValue::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:TheChat.MetricValue)
+}
+MetricValue::MetricValue(const MetricValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.labels_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.counter_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.counter_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.counter_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.MetricValue)
+}
+
+inline void MetricValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.labels_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.counter_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetricValue::~MetricValue() {
+  // @@protoc_insertion_point(destructor:TheChat.MetricValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.labels_.Destruct();
+  _impl_.labels_.~MapField();
+  _impl_.name_.Destroy();
+}
+
+void MetricValue::ArenaDtor(void* object) {
+  MetricValue* _this = reinterpret_cast< MetricValue* >(object);
+  _this->_impl_.labels_.Destruct();
+}
+void MetricValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.MetricValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.labels_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.counter_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.counter_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.MetricValue.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool counter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.counter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> labels = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.labels_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.MetricValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.MetricValue.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
+  }
+
+  // bool counter = 3;
+  if (this->_internal_counter() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_counter(), target);
+  }
+
+  // map<string, string> labels = 4;
+  if (!this->_internal_labels().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = MetricValue_LabelsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_labels();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "TheChat.MetricValue.LabelsEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "TheChat.MetricValue.LabelsEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.MetricValue)
+  return target;
+}
+
+size_t MetricValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.MetricValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> labels = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_labels_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_labels().begin();
+      it != this->_internal_labels().end(); ++it) {
+    total_size += MetricValue_LabelsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool counter = 3;
+  if (this->_internal_counter() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricValue::GetClassData() const { return &_class_data_; }
+
+
+void MetricValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricValue*>(&to_msg);
+  auto& from = static_cast<const MetricValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.MetricValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_counter() != 0) {
+    _this->_internal_set_counter(from._internal_counter());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricValue::CopyFrom(const MetricValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.MetricValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricValue::IsInitialized() const {
+  return true;
+}
+
+void MetricValue::InternalSwap(MetricValue* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetricValue, _impl_.counter_)
+      + sizeof(MetricValue::_impl_.counter_)
+      - PROTOBUF_FIELD_OFFSET(MetricValue, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[3]);
+}
+
+// ===================================================================
+
+class PoolStats::_Internal {
+ public:
+};
+
+PoolStats::PoolStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.PoolStats)
+}
+PoolStats::PoolStats(const PoolStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PoolStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.connections_){}
+    , decltype(_impl_.max_connections_){}
+    , decltype(_impl_.waiters_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.connections_, &from._impl_.connections_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.waiters_) -
+    reinterpret_cast<char*>(&_impl_.connections_)) + sizeof(_impl_.waiters_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.PoolStats)
+}
+
+inline void PoolStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.connections_){uint64_t{0u}}
+    , decltype(_impl_.max_connections_){uint64_t{0u}}
+    , decltype(_impl_.waiters_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PoolStats::~PoolStats() {
+  // @@protoc_insertion_point(destructor:TheChat.PoolStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PoolStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void PoolStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PoolStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.PoolStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.connections_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.waiters_) -
+      reinterpret_cast<char*>(&_impl_.connections_)) + sizeof(_impl_.waiters_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PoolStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.PoolStats.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 connections = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.connections_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_connections = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_connections_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 waiters = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.waiters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PoolStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.PoolStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.PoolStats.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint64 connections = 2;
+  if (this->_internal_connections() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_connections(), target);
+  }
+
+  // uint64 max_connections = 3;
+  if (this->_internal_max_connections() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_max_connections(), target);
+  }
+
+  // uint64 waiters = 4;
+  if (this->_internal_waiters() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_waiters(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.PoolStats)
+  return target;
+}
+
+size_t PoolStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.PoolStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 connections = 2;
+  if (this->_internal_connections() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_connections());
+  }
+
+  // uint64 max_connections = 3;
+  if (this->_internal_max_connections() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_connections());
+  }
+
+  // uint64 waiters = 4;
+  if (this->_internal_waiters() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_waiters());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PoolStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PoolStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PoolStats::GetClassData() const { return &_class_data_; }
+
+
+void PoolStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PoolStats*>(&to_msg);
+  auto& from = static_cast<const PoolStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.PoolStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_connections() != 0) {
+    _this->_internal_set_connections(from._internal_connections());
+  }
+  if (from._internal_max_connections() != 0) {
+    _this->_internal_set_max_connections(from._internal_max_connections());
+  }
+  if (from._internal_waiters() != 0) {
+    _this->_internal_set_waiters(from._internal_waiters());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PoolStats::CopyFrom(const PoolStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.PoolStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PoolStats::IsInitialized() const {
+  return true;
+}
+
+void PoolStats::InternalSwap(PoolStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PoolStats, _impl_.waiters_)
+      + sizeof(PoolStats::_impl_.waiters_)
+      - PROTOBUF_FIELD_OFFSET(PoolStats, _impl_.connections_)>(
+          reinterpret_cast<char*>(&_impl_.connections_),
+          reinterpret_cast<char*>(&other->_impl_.connections_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PoolStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[4]);
+}
+
+// ===================================================================
+
+class BreakerStats::_Internal {
+ public:
+};
+
+BreakerStats::BreakerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.BreakerStats)
+}
+BreakerStats::BreakerStats(const BreakerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BreakerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_){}
+    , decltype(_impl_.state_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service().empty()) {
+    _this->_impl_.service_.Set(from._internal_service(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.state_ = from._impl_.state_;
+  // @@protoc_insertion_point(copy_constructor:TheChat.BreakerStats)
+}
+
+inline void BreakerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_){}
+    , decltype(_impl_.state_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BreakerStats::~BreakerStats() {
+  // @@protoc_insertion_point(destructor:TheChat.BreakerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BreakerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_.Destroy();
+}
+
+void BreakerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BreakerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.BreakerStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_.ClearToEmpty();
+  _impl_.state_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BreakerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string service = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.BreakerStats.service"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.state_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BreakerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.BreakerStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string service = 1;
+  if (!this->_internal_service().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_service().data(), static_cast<int>(this->_internal_service().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.BreakerStats.service");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_service(), target);
+  }
+
+  // int32 state = 2;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.BreakerStats)
+  return target;
+}
+
+size_t BreakerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.BreakerStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string service = 1;
+  if (!this->_internal_service().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service());
+  }
+
+  // int32 state = 2;
+  if (this->_internal_state() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_state());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BreakerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BreakerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BreakerStats::GetClassData() const { return &_class_data_; }
+
+
+void BreakerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BreakerStats*>(&to_msg);
+  auto& from = static_cast<const BreakerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.BreakerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service().empty()) {
+    _this->_internal_set_service(from._internal_service());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BreakerStats::CopyFrom(const BreakerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.BreakerStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BreakerStats::IsInitialized() const {
+  return true;
+}
+
+void BreakerStats::InternalSwap(BreakerStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_, lhs_arena,
+      &other->_impl_.service_, rhs_arena
+  );
+  swap(_impl_.state_, other->_impl_.state_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BreakerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[5]);
+}
+
+// ===================================================================
+
+StatsResponse_ConfigEntry_DoNotUse::StatsResponse_ConfigEntry_DoNotUse() {}
+StatsResponse_ConfigEntry_DoNotUse::StatsResponse_ConfigEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void StatsResponse_ConfigEntry_DoNotUse::MergeFrom(const StatsResponse_ConfigEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse_ConfigEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[6]);
+}
+
+// ===================================================================
+
+class StatsResponse::_Internal {
+ public:
+};
+
+StatsResponse::StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &StatsResponse::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:TheChat.StatsResponse)
+}
+StatsResponse::StatsResponse(const StatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.methods_){from._impl_.methods_}
+    , decltype(_impl_.metrics_){from._impl_.metrics_}
+    , decltype(_impl_.pools_){from._impl_.pools_}
+    , decltype(_impl_.breakers_){from._impl_.breakers_}
+    , /*decltype(_impl_.config_)*/{}
+    , decltype(_impl_.role_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.config_.MergeFrom(from._impl_.config_);
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_role().empty()) {
+    _this->_impl_.role_.Set(from._internal_role(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:TheChat.StatsResponse)
+}
+
+inline void StatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.methods_){arena}
+    , decltype(_impl_.metrics_){arena}
+    , decltype(_impl_.pools_){arena}
+    , decltype(_impl_.breakers_){arena}
+    , /*decltype(_impl_.config_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.role_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+StatsResponse::~StatsResponse() {
+  // @@protoc_insertion_point(destructor:TheChat.StatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.methods_.~RepeatedPtrField();
+  _impl_.metrics_.~RepeatedPtrField();
+  _impl_.pools_.~RepeatedPtrField();
+  _impl_.breakers_.~RepeatedPtrField();
+  _impl_.config_.Destruct();
+  _impl_.config_.~MapField();
+  _impl_.role_.Destroy();
+}
+
+void StatsResponse::ArenaDtor(void* object) {
+  StatsResponse* _this = reinterpret_cast< StatsResponse* >(object);
+  _this->_impl_.config_.Destruct();
+}
+void StatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.methods_.Clear();
+  _impl_.metrics_.Clear();
+  _impl_.pools_.Clear();
+  _impl_.breakers_.Clear();
+  _impl_.config_.Clear();
+  _impl_.role_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string role = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_role();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.StatsResponse.role"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .TheChat.MethodStats methods = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_methods(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .TheChat.MetricValue metrics = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metrics(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .TheChat.PoolStats pools = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pools(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .TheChat.BreakerStats breakers = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_breakers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> config = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.config_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.StatsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string role = 1;
+  if (!this->_internal_role().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_role().data(), static_cast<int>(this->_internal_role().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.StatsResponse.role");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_role(), target);
+  }
+
+  // repeated .TheChat.MethodStats methods = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_methods_size()); i < n; i++) {
+    const auto& repfield = this->_internal_methods(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .TheChat.MetricValue metrics = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metrics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .TheChat.PoolStats pools = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pools_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pools(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .TheChat.BreakerStats breakers = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_breakers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_breakers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // map<string, string> config = 6;
+  if (!this->_internal_config().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = StatsResponse_ConfigEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_config();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "TheChat.StatsResponse.ConfigEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "TheChat.StatsResponse.ConfigEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.StatsResponse)
+  return target;
+}
+
+size_t StatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.StatsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .TheChat.MethodStats methods = 2;
+  total_size += 1UL * this->_internal_methods_size();
+  for (const auto& msg : this->_impl_.methods_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .TheChat.MetricValue metrics = 3;
+  total_size += 1UL * this->_internal_metrics_size();
+  for (const auto& msg : this->_impl_.metrics_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .TheChat.PoolStats pools = 4;
+  total_size += 1UL * this->_internal_pools_size();
+  for (const auto& msg : this->_impl_.pools_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .TheChat.BreakerStats breakers = 5;
+  total_size += 1UL * this->_internal_breakers_size();
+  for (const auto& msg : this->_impl_.breakers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // map<string, string> config = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_config_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_config().begin();
+      it != this->_internal_config().end(); ++it) {
+    total_size += StatsResponse_ConfigEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string role = 1;
+  if (!this->_internal_role().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_role());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsResponse::GetClassData() const { return &_class_data_; }
+
+
+void StatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsResponse*>(&to_msg);
+  auto& from = static_cast<const StatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.StatsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.methods_.MergeFrom(from._impl_.methods_);
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_impl_.pools_.MergeFrom(from._impl_.pools_);
+  _this->_impl_.breakers_.MergeFrom(from._impl_.breakers_);
+  _this->_impl_.config_.MergeFrom(from._impl_.config_);
+  if (!from._internal_role().empty()) {
+    _this->_internal_set_role(from._internal_role());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsResponse::CopyFrom(const StatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.StatsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsResponse::IsInitialized() const {
+  return true;
+}
+
+void StatsResponse::InternalSwap(StatsResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.methods_.InternalSwap(&other->_impl_.methods_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
+  _impl_.pools_.InternalSwap(&other->_impl_.pools_);
+  _impl_.breakers_.InternalSwap(&other->_impl_.breakers_);
+  _impl_.config_.InternalSwap(&other->_impl_.config_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.role_, lhs_arena,
+      &other->_impl_.role_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcadmin_2eproto_getter, &descriptor_table_rpcadmin_2eproto_once,
+      file_level_metadata_rpcadmin_2eproto[7]);
+}
+
+// ===================================================================
+
+AdminService::~AdminService() {}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* AdminService::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rpcadmin_2eproto);
+  return file_level_service_descriptors_rpcadmin_2eproto[0];
+}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* AdminService::GetDescriptor() {
+  return descriptor();
+}
+
+void AdminService::GetStats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::TheChat::StatsRequest*,
+                         ::TheChat::StatsResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method GetStats() not implemented.");
+  done->Run();
+}
+
+void AdminService::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
+                             ::google::protobuf::Closure* done) {
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_rpcadmin_2eproto[0]);
+  switch(method->index()) {
+    case 0:
+      GetStats(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::TheChat::StatsRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::TheChat::StatsResponse*>(
+                 response),
+             done);
+      break;
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& AdminService::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::TheChat::StatsRequest::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& AdminService::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::TheChat::StatsResponse::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
+  }
+}
+
+AdminService_Stub::AdminService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
+  : channel_(channel), owns_channel_(false) {}
+AdminService_Stub::AdminService_Stub(
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
+  : channel_(channel),
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
+AdminService_Stub::~AdminService_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void AdminService_Stub::GetStats(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::TheChat::StatsRequest* request,
+                              ::TheChat::StatsResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0),
+                       controller, request, response, done);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace TheChat
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::TheChat::StatsRequest*
+Arena::CreateMaybeMessage< ::TheChat::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::MethodStats*
+Arena::CreateMaybeMessage< ::TheChat::MethodStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::MethodStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::MetricValue_LabelsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::TheChat::MetricValue_LabelsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::MetricValue_LabelsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::MetricValue*
+Arena::CreateMaybeMessage< ::TheChat::MetricValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::MetricValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::PoolStats*
+Arena::CreateMaybeMessage< ::TheChat::PoolStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::PoolStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::BreakerStats*
+Arena::CreateMaybeMessage< ::TheChat::BreakerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::BreakerStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::StatsResponse_ConfigEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::TheChat::StatsResponse_ConfigEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::StatsResponse_ConfigEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::StatsResponse*
+Arena::CreateMaybeMessage< ::TheChat::StatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::StatsResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
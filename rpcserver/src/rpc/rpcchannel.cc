@@ -15,11 +15,32 @@
 #include "rpcexecption.h"
 #include <netinet/tcp.h>
 #include <sys/epoll.h>
+#include <ifaddrs.h>
+#include <cstring>
+#include <future>
+#include <algorithm>
+#include <chrono>
 #include <mutex>
+#include <random>
 #include "asynclogger.h"
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThread.h>
 
 TheRpcChannel::TheRpcChannel()
 {
+    RpcConfig &config = RpcApplication::GetInstance().GetConfig();
+    int sessions = config.LoadInt("rpcsessions", 2);
+    sessions_per_endpoint_ = sessions > 0 ? sessions : 1;
+    // rpcprotocol=1时始终使用v1帧格式
+    max_protocol_ = config.LoadInt("rpcprotocol", kProtocolV2) >= kProtocolV2 ? kProtocolV2 : kProtocolV1;
+    // rpccompression=lz4时与服务端协商压缩，不小于rpccompressthreshold字节的v2消息体压缩后发送
+    compression_ = Compression::Parse(config.Load("rpccompression"));
+    compress_threshold_ = static_cast<size_t>(std::max(config.LoadInt("rpccompressthreshold", 4096), 0));
+    prefer_unix_ = config.LoadBool("rpcpreferunix", true);
+    prefer_shm_ = config.LoadBool("rpcprefershm", true);
+    load_cache_ttl_ = std::chrono::milliseconds(std::max(config.LoadInt("rpcloadcachettl", 5000), 0));
+    // rpciouring=true时会话的读线程改用io_uring读取响应，内核不支持时退回poll+recv
+    use_io_uring_ = config.LoadBool("rpciouring", false);
     zk_client_.Start();
 }
 TheRpcChannel::~TheRpcChannel()
@@ -66,58 +87,44 @@ void TheRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
         return;
     }
 
-    // 描述错误原因
-    std::string error_reason;
     // 成功标志
     bool rpc_success = false;
 
     LOG_INFO << "try";
     try
     {
-        // 准备请求头
-        TheChat::RpcHeader rpc_header;
-        rpc_header.set_service_name(service_name);
-        rpc_header.set_method_name(method->name());
-        LOG_INFO << "将请求参数序列化到请求头中";
-        // 将请求参数序列化到请求头中
-        if (!request->SerializeToString(rpc_header.mutable_params()))
+        // 本次调用的截止时间：取控制器设置的超时时间和所在RPC方法剩余时间中较早的一个
+        TheRpcController::Clock::time_point deadline;
+        const bool inherited = ResolveDeadline(controller, TheRpcController::CurrentDeadline(), &deadline);
+        if (deadline <= std::chrono::steady_clock::now())
         {
-            throw RpcException("Serialize request failed");
+            // 上游调用方已经放弃，不再发出请求
+            throw RpcException(RpcErrorType::DEADLINE_EXCEEDED, "Deadline exceeded before calling " + method_full_name);
         }
+
         LOG_INFO << "服务发现";
         // 服务发现
-        Endpoint endpoint = GetServiceEndpoint(service_name, method->name());
-        LOG_INFO << "建立连接";
-        // 建立连接
-        ScopedFd clientfd(ConnectionPool::GetInstance().Get(endpoint));
-        LOG_INFO << "发送请求";
-        // 发送请求
-        SendRequest(clientfd, rpc_header);
-        LOG_INFO << "接收响应（带熔断状态感知）";
-        // 接收响应（带熔断状态感知）
-        ReceiveResponse(clientfd, response, breaker);
+        CallOptions options;
+        options.priority = static_cast<uint32_t>(controller->Priority());
+        Endpoint endpoint = GetServiceEndpoint(service_name, method->name(), options.method_id);
+        LOG_INFO << "发送请求并等待响应";
+        // 在多路复用会话上发送请求并等待响应
+        RpcResult result = Invoke(endpoint, method, *request, options, deadline, inherited);
+        if (result.type != RpcErrorType::SUCCESS)
+        {
+            throw RpcException(std::move(result.error_text), result.type);
+        }
+        if (!response->ParseFromString(result.response))
+        {
+            throw RpcException("Failed to parse response", RpcErrorType::INVALID_RESPONSE);
+        }
 
         rpc_success = true;
         LOG_INFO << "rpc_success";
     }
     catch (const RpcException &e)
     {
-        const RpcErrorType errorType = e.type();
-        error_reason = e.what();
-
-        if (errorType == RpcErrorType::UNAUTHORIZED)
-        {
-            controller->SetFailed("Unauthorized: " + method_full_name);
-        }
-        else
-        {
-            controller->SetFailed(error_reason.empty() ? "RPC failed: " + method_full_name : error_reason);
-        }
-
-        if (ShouldTriggerCircuitBreak(e.type()))
-        {
-            breaker.RecordFailure();
-        }
+        OnCallFailed(method, controller, breaker, e.type(), e.what());
     }
     catch (const std::exception &e)
     {
@@ -153,104 +160,521 @@ void TheRpcChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
     LOG_INFO << "CallMethod end";
 }
 
-// 服务发现
-Endpoint TheRpcChannel::GetServiceEndpoint(const std::string &service,
-                                           const std::string &method)
+// 一次未完成的异步调用，由会话的完成回调和超时定时器共同持有
+struct TheRpcChannel::AsyncCall
 {
-    // 带TTL的本地缓存
-    static std::mutex cache_mutex;
-    static std::unordered_map<std::string, CachedEndpoint> endpoint_cache;
+    const google::protobuf::MethodDescriptor *method;
+    TheRpcController *controller;
+    google::protobuf::Message *response;
+    std::function<void()> done;
+    // 截止时间取自所在RPC方法时超时不计入熔断
+    bool inherited = false;
+    // 超时定时器，调用先完成时取消
+    std::mutex mutex;
+    muduo::net::TimerId timer;
+    bool timer_armed = false;
+    bool finished = false;
+};
 
-    const std::string cache_key = service + ":" + method;
+// 异步调用的超时定时器线程，第一次使用时启动
+static muduo::net::EventLoop *TimerLoop()
+{
+    static muduo::net::EventLoopThread thread(muduo::net::EventLoopThread::ThreadInitCallback(), "RpcTimer");
+    static muduo::net::EventLoop *loop = thread.startLoop();
+    return loop;
+}
 
-    // 首先在缓存中查找
+/**
+ * @brief 异步调用，请求发出后立即返回，不占用调用线程等待响应
+ * @param method 要远程调用的方法
+ * @param controller rpc控制对象，失败原因写入其中，调用完成前必须保持有效
+ * @param request 请求参数，只在本函数内使用
+ * @param response 响应，成功时填入，调用完成前必须保持有效
+ * @param done 调用成功、失败或超时后执行一次，在会话读线程或超时定时器线程中执行，不能阻塞；
+ *             服务发现或建立连接失败时在本线程中执行
+ * @param inherited_deadline 所在RPC方法的截止时间，调用的截止时间取它与控制器超时时间中较早的一个
+ */
+void TheRpcChannel::AsyncCallMethod(const google::protobuf::MethodDescriptor *method,
+                                    TheRpcController *controller,
+                                    const google::protobuf::Message *request,
+                                    google::protobuf::Message *response,
+                                    std::function<void()> &&done,
+                                    TheRpcController::Clock::time_point inherited_deadline)
+{
+    auto call = std::make_shared<AsyncCall>();
+    call->method = method;
+    call->controller = controller;
+    call->response = response;
+    call->done = std::move(done);
+
+    auto &breaker = CircuitBreakerManager::GetInstance(method->service()->name());
+    if (!breaker.AllowRequest())
     {
-        std::lock_guard<std::mutex> lock(cache_mutex);
-        auto it = endpoint_cache.find(cache_key);
-        if (it != endpoint_cache.end() && !it->second.IsExpired())
+        controller->SetFailed("Service Unavailable: " + method->service()->name());
+        call->done();
+        return;
+    }
+
+    std::shared_ptr<RpcSession> session;
+    uint64_t request_id = 0;
+    TheRpcController::Clock::time_point deadline;
+    try
+    {
+        call->inherited = ResolveDeadline(controller, inherited_deadline, &deadline);
+        if (deadline <= std::chrono::steady_clock::now())
         {
-            return it->second.endpoint;
+            throw RpcException(RpcErrorType::DEADLINE_EXCEEDED, "Deadline exceeded before calling " + method->full_name());
         }
+        // 服务发现通常命中本地缓存，建立会话只发生在第一次调用或连接断开后
+        CallOptions options;
+        options.priority = static_cast<uint32_t>(controller->Priority());
+        Endpoint endpoint = GetServiceEndpoint(method->service()->name(), method->name(), options.method_id);
+        session = GetSession(endpoint);
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        options.timeout_ms = static_cast<uint32_t>(std::max<int64_t>(remaining.count(), 1));
+        // 发送失败时会话在本线程中以失败完成回调，之后不会再抛出异常
+        request_id = session->AsyncCall(method, *request, [this, call](RpcResult &&result)
+                                        { FinishAsyncCall(call, std::move(result)); },
+                                        options);
     }
-    // 在ZooKeeper中查找
-    std::string path = "/" + service + "/" + method;
-    std::string node_data;
-    // 获取数据
-    if (!zk_client_.GetData(path, node_data))
+    catch (const RpcException &e)
     {
-        throw RpcException("Service unavailable: " + path, RpcErrorType::SERVICE_UNAVAILABLE);
+        OnCallFailed(method, controller, breaker, e.type(), e.what());
+        call->done();
+        return;
     }
-    if (node_data.empty())
+    catch (const std::exception &e)
     {
-        throw RpcException("Service unavailable: " + path, RpcErrorType::SERVICE_UNAVAILABLE);
+        breaker.RecordFailure();
+        controller->SetFailed("System error: " + std::string(e.what()));
+        call->done();
+        return;
     }
-    Endpoint endpoint;
-    // 解析数据 node_data = ip:port
-    int idx = node_data.find(":");
+
+    // 到截止时间仍未完成时取消调用，取消成功说明响应没有在途，由定时器完成调用
+    std::weak_ptr<RpcSession> weak_session = session;
+    const double delay = std::chrono::duration<double>(deadline - std::chrono::steady_clock::now()).count();
+    muduo::net::TimerId timer = TimerLoop()->runAfter(std::max(delay, 0.0), [this, call, weak_session, request_id]
+                                                      {
+        std::shared_ptr<RpcSession> session = weak_session.lock();
+        if (!session || !session->Cancel(request_id))
+        {
+            return;
+        }
+        RpcResult result;
+        if (call->inherited)
+        {
+            result.type = RpcErrorType::DEADLINE_EXCEEDED;
+            result.error_text = "Deadline exceeded calling " + call->method->full_name();
+        }
+        else
+        {
+            result.type = RpcErrorType::TIMEOUT;
+            result.error_text = RpcException::Timeout(call->method->full_name()).what();
+        }
+        FinishAsyncCall(call, std::move(result)); });
+    std::lock_guard<std::mutex> lock(call->mutex);
+    if (call->finished)
+    {
+        TimerLoop()->cancel(timer);
+        return;
+    }
+    call->timer = timer;
+    call->timer_armed = true;
+}
+
+// 异步调用完成：写入响应或失败原因，记录熔断，再执行完成回调
+void TheRpcChannel::FinishAsyncCall(const std::shared_ptr<AsyncCall> &call, RpcResult &&result)
+{
+    {
+        std::lock_guard<std::mutex> lock(call->mutex);
+        call->finished = true;
+        if (call->timer_armed)
+        {
+            TimerLoop()->cancel(call->timer);
+        }
+    }
+    auto &breaker = CircuitBreakerManager::GetInstance(call->method->service()->name());
+    if (result.type != RpcErrorType::SUCCESS)
+    {
+        // 继承的时间预算耗尽不是下游的问题，与同步调用一样不计入熔断
+        OnCallFailed(call->method, call->controller, breaker, result.type, result.error_text);
+    }
+    else if (!call->response->ParseFromString(result.response))
+    {
+        OnCallFailed(call->method, call->controller, breaker, RpcErrorType::INVALID_RESPONSE, "Failed to parse response");
+    }
+    else
+    {
+        breaker.RecordSuccess();
+    }
+    call->done();
+}
+
+// 调用失败：写入控制器，按错误类型记录熔断，服务端不可用时删除缓存的端点
+void TheRpcChannel::OnCallFailed(const google::protobuf::MethodDescriptor *method, TheRpcController *controller,
+                                 CircuitBreaker &breaker, RpcErrorType type, const std::string &reason)
+{
+    if (type == RpcErrorType::UNAUTHORIZED)
+    {
+        controller->SetFailed("Unauthorized: " + method->full_name());
+    }
+    else
+    {
+        controller->SetFailed(reason.empty() ? "RPC failed: " + method->full_name() : reason);
+    }
+
+    if (ShouldTriggerCircuitBreak(type))
+    {
+        breaker.RecordFailure();
+    }
+    if (type == RpcErrorType::SERVICE_UNAVAILABLE || type == RpcErrorType::NETWORK_ERROR)
+    {
+        InvalidateEndpoint(method->service()->name(), method->name());
+    }
+}
+
+// 本次调用的截止时间：取控制器设置的超时时间和所在RPC方法剩余时间中较早的一个，返回是否取了后者
+bool TheRpcChannel::ResolveDeadline(TheRpcController *controller, TheRpcController::Clock::time_point inherited_deadline,
+                                    TheRpcController::Clock::time_point *deadline)
+{
+    const int64_t timeout_ms = controller->Timeout() > 0 ? controller->Timeout() : SOCKET_RW_TIMEOUT_MS;
+    *deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    if (inherited_deadline < *deadline)
+    {
+        *deadline = inherited_deadline;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief 发起一次流式调用，服务端必须支持v2帧
+ * @param method 要远程调用的方法
+ * @param controller rpc控制对象，Timeout()非0时作为整个流的超时时间，失败原因写入其中
+ * @param request 第一个请求消息
+ * @return 已建立的流，失败时返回nullptr
+ */
+std::shared_ptr<RpcStream> TheRpcChannel::OpenStream(const google::protobuf::MethodDescriptor *method,
+                                                     TheRpcController *controller,
+                                                     const google::protobuf::Message &request)
+{
+    const auto &service_name = method->service()->name();
+    auto &breaker = CircuitBreakerManager::GetInstance(service_name);
+    if (!breaker.AllowRequest())
+    {
+        controller->SetFailed("Service Unavailable: " + service_name);
+        return nullptr;
+    }
+    try
+    {
+        // 流的持续时间由调用方决定，未设置超时时间时不限制
+        CallOptions options;
+        options.priority = static_cast<uint32_t>(controller->Priority());
+        options.timeout_ms = static_cast<uint32_t>(std::max<int64_t>(controller->Timeout(), 0));
+        Endpoint endpoint = GetServiceEndpoint(service_name, method->name(), options.method_id);
+        auto session = GetSession(endpoint);
+        // 发布了方法id的服务端支持v2帧，否则只有协商升级过的会话才能确认
+        if (options.method_id == 0 && session->Protocol() < kProtocolV2)
+        {
+            throw RpcException("Streaming is not supported by " + endpoint.host + ":" + std::to_string(endpoint.port),
+                               RpcErrorType::PROTOCOL_ERROR);
+        }
+        return session->OpenStream(method, request, options);
+    }
+    catch (const RpcException &e)
+    {
+        if (ShouldTriggerCircuitBreak(e.type()))
+        {
+            breaker.RecordFailure();
+        }
+        if (e.type() == RpcErrorType::SERVICE_UNAVAILABLE || e.type() == RpcErrorType::NETWORK_ERROR)
+        {
+            InvalidateEndpoint(service_name, method->name());
+        }
+        controller->SetFailed(e.what());
+    }
+    catch (const std::exception &e)
+    {
+        breaker.RecordFailure();
+        controller->SetFailed("System error: " + std::string(e.what()));
+    }
+    return nullptr;
+}
+
+std::mutex TheRpcChannel::cache_mutex_;
+std::unordered_map<std::string, TheRpcChannel::CachedEndpoint> TheRpcChannel::endpoint_cache_;
+
+// 服务端不可用或正在摘流量时删除缓存的端点，下次调用重新做服务发现，不必等TTL过期
+void TheRpcChannel::InvalidateEndpoint(const std::string &service, const std::string &method)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    endpoint_cache_.erase(service + ":" + method);
+}
+
+// 节点中发布的套接字路径非空且本进程可以访问时改用该传输方式，
+// 套接字文件不可访问(如不在同一个挂载命名空间)时返回false，仍走TCP
+static bool UseLocalTransport(const std::string &path, Transport transport, Endpoint &endpoint)
+{
+    if (path.empty() || access(path.c_str(), R_OK | W_OK) != 0)
+    {
+        return false;
+    }
+    endpoint.transport = transport;
+    endpoint.path = path;
+    return true;
+}
+
+// 旧格式方法节点的值中key(如";uds=")之后到下一个';'之前的内容，不存在时返回空串
+static std::string NodeField(const std::string &node_data, const std::string &key)
+{
+    size_t idx = node_data.find(key);
     if (idx == std::string::npos)
     {
-        throw RpcException("Invalid node data: " + node_data, RpcErrorType::SERVICE_UNAVAILABLE);
+        return "";
     }
-    std::string ip = node_data.substr(0, idx);
-    uint16_t port = atoi(node_data.substr(idx + 1, node_data.size() - idx).c_str());
-    endpoint = Endpoint{ip, port};
-    // 设置5分钟的TTL缓存
+    std::string value = node_data.substr(idx + key.size());
+    return value.substr(0, value.find(';'));
+}
+
+// 实例节点中发布的负载按权重归一化：并发数越高、CPU越忙、排队越久、权重越低，值越大
+static double NormalizedLoad(const TheChat::ServiceEndpoint &endpoint)
+{
+    return (endpoint.inflight() + 1.0) * (1.0 + endpoint.cpu_permille() / 1000.0) *
+           (1.0 + endpoint.queue_delay_us() / 10000.0) / endpoint.weight();
+}
+
+// 由节点中发布的地址和套接字路径得到端点，服务端同机时按配置改走共享内存或Unix域套接字
+Endpoint TheRpcChannel::MakeEndpoint(const std::string &ip, uint16_t port, const std::string &unix_path,
+                                     const std::string &shm_path) const
+{
+    Endpoint endpoint;
+    endpoint.host = ip;
+    endpoint.port = port;
+    // 共享内存优先
+    if ((prefer_shm_ || prefer_unix_) && IsLocalHost(ip))
     {
-        std::lock_guard<std::mutex> lock(cache_mutex);
-        endpoint_cache[cache_key] = CachedEndpoint{
-            endpoint,
-            std::chrono::steady_clock::now() + std::chrono::minutes(5)};
+        if (!(prefer_shm_ && UseLocalTransport(shm_path, Transport::SHM, endpoint)) && prefer_unix_)
+        {
+            UseLocalTransport(unix_path, Transport::UNIX, endpoint);
+        }
     }
     return endpoint;
 }
 
-constexpr bool TheRpcChannel::ShouldTriggerCircuitBreak(RpcErrorType type)
+// 读取方法节点下各实例节点发布的端点和负载，没有实例节点时返回false，实例都在摘流量(权重为0)时抛出SERVICE_UNAVAILABLE
+bool TheRpcChannel::LoadInstances(const std::string &path, CachedEndpoint &entry)
 {
-    return type == RpcErrorType::NETWORK_ERROR ||
-           type == RpcErrorType::TIMEOUT ||
-           type == RpcErrorType::SERVICE_UNAVAILABLE;
+    std::vector<std::string> children;
+    if (!zk_client_.GetChildren(path, children))
+    {
+        return false;
+    }
+    bool draining = false;
+    for (const std::string &child : children)
+    {
+        std::string node_data;
+        TheChat::ServiceEndpoint instance;
+        // 读取期间实例可能已经下线，跳过无法读取或解析的节点
+        if (!zk_client_.GetData(path + "/" + child, node_data) || !instance.ParseFromString(node_data))
+        {
+            continue;
+        }
+        // 权重为0的实例不接收新请求
+        if (instance.weight() == 0)
+        {
+            draining = true;
+            continue;
+        }
+        entry.candidates.push_back(CachedEndpoint::Candidate{
+            MakeEndpoint(instance.ip(), static_cast<uint16_t>(instance.port()), instance.unix_path(), instance.shm_path()),
+            instance.method_id(),
+            NormalizedLoad(instance)});
+    }
+    // 方法节点中的地址可能正是摘流量的实例，不能退回使用
+    if (entry.candidates.empty() && draining)
+    {
+        throw RpcException("Service unavailable: " + path + " is draining", RpcErrorType::SERVICE_UNAVAILABLE);
+    }
+    return !entry.candidates.empty();
 }
 
-// 发送请求（带超时重试机制）
-void TheRpcChannel::SendRequest(const ScopedFd &clientfd, const TheChat::RpcHeader &rpc_header)
+// 随机取两个候选实例，选负载较低的一个，避免所有请求方同时涌向同一个负载最低的实例
+const TheRpcChannel::CachedEndpoint::Candidate &TheRpcChannel::PickCandidate(const CachedEndpoint &entry)
 {
+    const size_t count = entry.candidates.size();
+    if (count == 1)
+    {
+        return entry.candidates.front();
+    }
+    static thread_local std::minstd_rand random(std::random_device{}());
+    const size_t first = random() % count;
+    const size_t second = (first + 1 + random() % (count - 1)) % count;
+    const auto &a = entry.candidates[first];
+    const auto &b = entry.candidates[second];
+    return b.load < a.load ? b : a;
+}
 
-    std::string send_str;
-    if (!rpc_header.SerializeToString(&send_str))
+// 服务发现：服务端注册了实例节点时按各实例发布的负载选择，否则使用方法节点中的地址
+Endpoint TheRpcChannel::GetServiceEndpoint(const std::string &service,
+                                           const std::string &method,
+                                           uint32_t &method_id)
+{
+    const std::string cache_key = service + ":" + method;
+
+    // 首先在缓存中查找
     {
-        throw RpcException("Failed to serialize request header", RpcErrorType::PROTOCOL_ERROR);
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto it = endpoint_cache_.find(cache_key);
+        if (it != endpoint_cache_.end() && !it->second.IsExpired())
+        {
+            const CachedEndpoint::Candidate &candidate = PickCandidate(it->second);
+            method_id = candidate.method_id;
+            return candidate.endpoint;
+        }
+    }
+    // 在ZooKeeper中查找
+    std::string path = "/" + service + "/" + method;
+    CachedEndpoint entry;
+    // 负载会变化，实例列表只缓存rpcloadcachettl毫秒
+    if (LoadInstances(path, entry))
+    {
+        entry.expire_time = std::chrono::steady_clock::now() + load_cache_ttl_;
+    }
+    else
+    {
+        std::string node_data;
+        // 获取数据
+        if (!zk_client_.GetData(path, node_data))
+        {
+            throw RpcException("Service unavailable: " + path, RpcErrorType::SERVICE_UNAVAILABLE);
+        }
+        if (node_data.empty())
+        {
+            throw RpcException("Service unavailable: " + path, RpcErrorType::SERVICE_UNAVAILABLE);
+        }
+        // 解析数据 node_data = ip:port[;mid=方法id][;uds=Unix域套接字路径][;shm=共享内存引导套接字路径]
+        size_t idx = node_data.find(":");
+        if (idx == std::string::npos)
+        {
+            throw RpcException("Invalid node data: " + node_data, RpcErrorType::SERVICE_UNAVAILABLE);
+        }
+        std::string ip = node_data.substr(0, idx);
+        uint16_t port = atoi(node_data.substr(idx + 1, node_data.size() - idx).c_str());
+        // 旧服务端不发布方法id，此时按名字调用
+        std::string mid = NodeField(node_data, ";mid=");
+        entry.candidates.push_back(CachedEndpoint::Candidate{
+            MakeEndpoint(ip, port, NodeField(node_data, ";uds="), NodeField(node_data, ";shm=")),
+            mid.empty() ? 0 : static_cast<uint32_t>(strtoul(mid.c_str(), nullptr, 10)),
+            0});
+        // 设置5分钟的TTL缓存
+        entry.expire_time = std::chrono::steady_clock::now() + std::chrono::minutes(5);
     }
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    CachedEndpoint &cached = endpoint_cache_[cache_key];
+    cached = std::move(entry);
+    const CachedEndpoint::Candidate &candidate = PickCandidate(cached);
+    method_id = candidate.method_id;
+    return candidate.endpoint;
+}
+
+// host是否为本机的地址，本机的服务端发布了Unix域套接字时改用它连接
+bool TheRpcChannel::IsLocalHost(const std::string &host)
+{
+    // 网卡地址在进程生命周期内基本不变，只枚举一次
+    static const std::vector<std::string> local_addresses = []
+    {
+        std::vector<std::string> addresses{"127.0.0.1", "localhost"};
+        ifaddrs *list = nullptr;
+        if (getifaddrs(&list) != 0)
+        {
+            return addresses;
+        }
+        for (ifaddrs *ifa = list; ifa != nullptr; ifa = ifa->ifa_next)
+        {
+            if (ifa->ifa_addr == nullptr || ifa->ifa_addr->sa_family != AF_INET)
+            {
+                continue;
+            }
+            char buf[INET_ADDRSTRLEN];
+            const sockaddr_in *addr = reinterpret_cast<const sockaddr_in *>(ifa->ifa_addr);
+            if (inet_ntop(AF_INET, &addr->sin_addr, buf, sizeof(buf)) != nullptr)
+            {
+                addresses.emplace_back(buf);
+            }
+        }
+        freeifaddrs(list);
+        return addresses;
+    }();
+    return std::find(local_addresses.begin(), local_addresses.end(), host) != local_addresses.end();
+}
 
-    // 在发送前添加长度头
-    int data_length = send_str.size();
-    uint32_t network_length = htonl(data_length);
-    std::string header(reinterpret_cast<char *>(&network_length), 4);
-    std::string total_send_data = header + send_str;
+constexpr bool TheRpcChannel::ShouldTriggerCircuitBreak(RpcErrorType type)
+{
+    return type == RpcErrorType::NETWORK_ERROR ||
+           type == RpcErrorType::TIMEOUT ||
+           type == RpcErrorType::SERVICE_UNAVAILABLE;
+}
 
-    if (-1 == send(clientfd, total_send_data.c_str(), total_send_data.size(), 0))
+// 同步调用：通过多路复用会话发送请求，等待按request_id匹配的响应
+RpcResult TheRpcChannel::Invoke(const Endpoint &endpoint, const google::protobuf::MethodDescriptor *method,
+                                const google::protobuf::Message &request, CallOptions &options,
+                                std::chrono::steady_clock::time_point deadline, bool inherited)
+{
+    auto session = GetSession(endpoint);
+    // 建立会话可能耗时，发送前重新计算剩余时间
+    auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    options.timeout_ms = static_cast<uint32_t>(std::max<int64_t>(remaining.count(), 1));
+    auto promise = std::make_shared<std::promise<RpcResult>>();
+    std::future<RpcResult> future = promise->get_future();
+    uint64_t request_id = session->AsyncCall(method, request, [promise](RpcResult &&result)
+                                             { promise->set_value(std::move(result)); },
+                                             options);
+    if (future.wait_until(deadline) == std::future_status::timeout &&
+        session->Cancel(request_id))
     {
-        close(clientfd);
-        throw RpcException("send() error: " + std::string(strerror(errno)), RpcErrorType::NETWORK_ERROR);
+        // 继承的时间预算耗尽不是下游的问题，不计入熔断
+        if (inherited)
+        {
+            throw RpcException(RpcErrorType::DEADLINE_EXCEEDED, "Deadline exceeded calling " + method->full_name());
+        }
+        throw RpcException::Timeout(method->full_name());
     }
+    // 取消失败说明响应已在途，等待回调完成
+    return future.get();
 }
 
-// 接收响应（带熔断感知）
-void TheRpcChannel::ReceiveResponse(const ScopedFd &clientfd,
-                                    google::protobuf::Message *response,
-                                    CircuitBreaker &breaker)
+// 获取端点的会话，同一端点上的少量长连接轮流承载所有调用
+std::shared_ptr<RpcSession> TheRpcChannel::GetSession(const Endpoint &endpoint)
 {
-    LOG_INFO << "接收响应（带熔断感知）";
-    char recv_buf[1024] = {0};
-    int recv_size = 0;
-    if (-1 == (recv_size = recv(clientfd, recv_buf, 1024, 0)))
+    size_t slot;
     {
-        close(clientfd);
-        throw RpcException("recv() error: " + std::string(strerror(errno)), RpcErrorType::NETWORK_ERROR);
+        std::lock_guard<std::mutex> lock(session_mutex_);
+        auto &group = session_map_[endpoint];
+        if (group.sessions.size() < sessions_per_endpoint_)
+        {
+            group.sessions.resize(sessions_per_endpoint_);
+        }
+        slot = group.next++ % group.sessions.size();
+        auto &session = group.sessions[slot];
+        if (session && !session->IsClosed())
+        {
+            return session;
+        }
     }
-    if (!response->ParseFromArray(recv_buf, recv_size))
+
+    // 会话不存在或已断开，在锁外建立新连接，避免阻塞其他调用
+    auto session = std::make_shared<RpcSession>(endpoint, CONNECT_TIMEOUT_MS, max_protocol_,
+                                                compression_, compress_threshold_, use_io_uring_);
+    std::shared_ptr<RpcSession> stale;
+    std::lock_guard<std::mutex> lock(session_mutex_);
+    auto &current = session_map_[endpoint].sessions[slot];
+    if (current && !current->IsClosed())
     {
-        close(clientfd);
-        throw RpcException("Failed to parse response", RpcErrorType::INVALID_RESPONSE);
+        return current; // 其他线程已经重建
     }
-    LOG_INFO << "接收响应（带熔断感知）";
+    // 旧会话在锁外析构
+    stale = std::move(current);
+    current = session;
+    return session;
 }
@@ -0,0 +1,304 @@
+#include "rpccodec.h"
+#include <string>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <arpa/inet.h>
+#include <endian.h>
+#include <cstring>
+
+using google::protobuf::internal::WireFormatLite;
+
+/**
+ * @brief 就地解析带载荷字段的头部消息，载荷字段不拷贝，只返回其在data中的位置
+ * @param data 头部消息的序列化数据，通常直接指向muduo::net::Buffer::peek()
+ * @param len 数据长度
+ * @param payload_field 载荷字段的字段号，必须是bytes/string类型
+ * @param header 输出，除载荷字段外的其余字段
+ * @param payload 输出，载荷在data中的起始位置，不存在时为nullptr
+ * @param payload_len 输出，载荷长度
+ * @return 解析成功返回true
+ */
+bool ParseInPlace(const char *data, size_t len, int payload_field,
+                  google::protobuf::Message *header, const char **payload, size_t *payload_len)
+{
+    *payload = nullptr;
+    *payload_len = 0;
+
+    // 输入流以帧长度为界，不会越过当前帧读取缓冲区中后续的数据
+    google::protobuf::io::ArrayInputStream raw_input(data, static_cast<int>(len));
+    google::protobuf::io::CodedInputStream input(&raw_input);
+    input.PushLimit(static_cast<int>(len));
+
+    // 除载荷外的字段原样转存，体积很小，最后统一交给header解析
+    std::string rest;
+    {
+        google::protobuf::io::StringOutputStream raw_output(&rest);
+        google::protobuf::io::CodedOutputStream output(&raw_output);
+        uint32_t tag;
+        while ((tag = input.ReadTag()) != 0)
+        {
+            if (WireFormatLite::GetTagFieldNumber(tag) == payload_field &&
+                WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+            {
+                uint32_t size;
+                if (!input.ReadVarint32(&size))
+                {
+                    return false;
+                }
+                // 载荷只记录位置，重复出现时与protobuf语义一致取最后一次
+                const int offset = input.CurrentPosition();
+                if (!input.Skip(static_cast<int>(size)))
+                {
+                    return false;
+                }
+                *payload = data + offset;
+                *payload_len = size;
+                continue;
+            }
+            if (!WireFormatLite::SkipField(&input, tag, &output))
+            {
+                return false;
+            }
+        }
+        if (!input.ConsumedEntireMessage())
+        {
+            return false;
+        }
+    }
+    return header->ParseFromString(rest);
+}
+
+/**
+ * @brief 计算方法id，对方法全名(Service.Method)做FNV-1a哈希，服务端和客户端无需协调即可得到相同结果
+ * @param full_name 方法全名
+ * @return 非0的方法id，0保留给按名字分发的请求
+ */
+uint32_t MethodId(const std::string &full_name)
+{
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : full_name)
+    {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash != 0 ? hash : 1;
+}
+
+// 缓冲区开头是否为v2帧，至少需要2个字节才能判断
+bool IsFrameV2(const char *data, size_t len)
+{
+    return len >= 2 &&
+           static_cast<uint8_t>(data[0]) == (kFrameMagic >> 8) &&
+           static_cast<uint8_t>(data[1]) == (kFrameMagic & 0xff);
+}
+
+// 解码固定帧头，data至少有kFrameHeaderSize字节，magic或版本不符时返回false
+bool DecodeFrameHeader(const char *data, FrameHeader *header)
+{
+    if (!IsFrameV2(data, kFrameHeaderSize))
+    {
+        return false;
+    }
+    uint64_t request_id;
+    uint32_t method_id, meta_len, body_len;
+    header->version = static_cast<uint8_t>(data[2]);
+    header->flags = static_cast<uint8_t>(data[3]);
+    memcpy(&request_id, data + 4, 8);
+    memcpy(&method_id, data + 12, 4);
+    memcpy(&meta_len, data + 16, 4);
+    memcpy(&body_len, data + 20, 4);
+    header->request_id = be64toh(request_id);
+    header->method_id = ntohl(method_id);
+    header->meta_len = ntohl(meta_len);
+    header->body_len = ntohl(body_len);
+    return header->version == kProtocolV2 &&
+           static_cast<uint64_t>(header->meta_len) + header->body_len <= kMaxFrameBodySize;
+}
+
+// 写入固定帧头，p至少有kFrameHeaderSize字节
+static void EncodeFrameHeader(const FrameHeader &header, char *p)
+{
+    uint16_t magic = htons(kFrameMagic);
+    uint64_t request_id = htobe64(header.request_id);
+    uint32_t method_id = htonl(header.method_id);
+    uint32_t meta_len = htonl(header.meta_len);
+    uint32_t body_len = htonl(header.body_len);
+    memcpy(p, &magic, 2);
+    p[2] = static_cast<char>(header.version);
+    p[3] = static_cast<char>(header.flags);
+    memcpy(p + 4, &request_id, 8);
+    memcpy(p + 12, &method_id, 4);
+    memcpy(p + 16, &meta_len, 4);
+    memcpy(p + 20, &body_len, 4);
+}
+
+/**
+ * @brief 编码一个完整的v2帧并追加到out，扩展头和消息体直接序列化到输出中，不经过中间拷贝
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 消息体，为nullptr时不带消息体
+ * @param out 输出
+ * @return 序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const google::protobuf::MessageLite *body, std::string *out)
+{
+    const size_t meta_len = meta != nullptr ? meta->ByteSizeLong() : 0;
+    const size_t body_len = body != nullptr ? body->ByteSizeLong() : 0;
+    if (meta_len + body_len > kMaxFrameBodySize)
+    {
+        return false;
+    }
+    header.meta_len = static_cast<uint32_t>(meta_len);
+    header.body_len = static_cast<uint32_t>(body_len);
+
+    const size_t offset = out->size();
+    out->resize(offset + kFrameHeaderSize + meta_len + body_len);
+    char *p = &(*out)[offset];
+    EncodeFrameHeader(header, p);
+    p += kFrameHeaderSize;
+
+    // ByteSizeLong已缓存各字段大小，此处直接写入，不再重复计算
+    if (meta_len > 0)
+    {
+        meta->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(p));
+        p += meta_len;
+    }
+    if (body_len > 0)
+    {
+        body->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(p));
+    }
+    return true;
+}
+
+/**
+ * @brief 编码一个消息体已经序列化好的v2帧并追加到out
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 序列化好的消息体
+ * @param body_len 消息体长度
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const char *body, size_t body_len, std::string *out)
+{
+    const size_t meta_len = meta != nullptr ? meta->ByteSizeLong() : 0;
+    if (meta_len + body_len > kMaxFrameBodySize)
+    {
+        return false;
+    }
+    header.meta_len = static_cast<uint32_t>(meta_len);
+    header.body_len = static_cast<uint32_t>(body_len);
+
+    const size_t offset = out->size();
+    out->resize(offset + kFrameHeaderSize + meta_len + body_len);
+    char *p = &(*out)[offset];
+    EncodeFrameHeader(header, p);
+    p += kFrameHeaderSize;
+    if (meta_len > 0)
+    {
+        meta->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(p));
+        p += meta_len;
+    }
+    if (body_len > 0)
+    {
+        memcpy(p, body, body_len);
+    }
+    return true;
+}
+
+/**
+ * @brief 编码v2帧，连接上协商了压缩且消息体不小于阈值时压缩消息体并置kFlagCompressed
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 消息体，为nullptr时不带消息体
+ * @param compression 连接上协商的压缩算法，NONE时与不带压缩参数的版本相同
+ * @param threshold 压缩阈值，单位字节
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const google::protobuf::MessageLite *body, CompressionType compression, size_t threshold,
+                 std::string *out)
+{
+    if (compression == CompressionType::NONE || body == nullptr)
+    {
+        return AppendFrame(header, meta, body, out);
+    }
+    // 低于阈值的消息体直接序列化到输出中，只有需要压缩时才多一次中间序列化
+    const size_t body_len = body->ByteSizeLong();
+    if (body_len < threshold)
+    {
+        Compression::GetStats().uncompressed_bytes.fetch_add(body_len, std::memory_order_relaxed);
+        return AppendFrame(header, meta, body, out);
+    }
+    std::string raw;
+    if (!body->SerializeToString(&raw))
+    {
+        return false;
+    }
+    return AppendFrame(header, meta, raw.data(), raw.size(), compression, threshold, out);
+}
+
+/**
+ * @brief 编码消息体已经序列化好的v2帧，连接上协商了压缩且消息体不小于阈值时压缩消息体并置kFlagCompressed
+ * @param header 固定帧头，meta_len和body_len由本函数填写
+ * @param meta 扩展头，为nullptr时不带扩展头
+ * @param body 序列化好的消息体
+ * @param body_len 消息体长度
+ * @param compression 连接上协商的压缩算法，NONE时与不带压缩参数的版本相同
+ * @param threshold 压缩阈值，单位字节
+ * @param out 输出
+ * @return 帧过长或序列化失败返回false
+ */
+bool AppendFrame(FrameHeader header, const google::protobuf::MessageLite *meta,
+                 const char *body, size_t body_len, CompressionType compression, size_t threshold,
+                 std::string *out)
+{
+    if (compression == CompressionType::NONE)
+    {
+        return AppendFrame(header, meta, body, body_len, out);
+    }
+    Compression::Stats &stats = Compression::GetStats();
+    std::string compressed;
+    // 压缩无收益(如已压缩的图片)时按原样发送
+    if (body_len < threshold || !Compression::Compress(compression, body, body_len, &compressed))
+    {
+        stats.uncompressed_bytes.fetch_add(body_len, std::memory_order_relaxed);
+        return AppendFrame(header, meta, body, body_len, out);
+    }
+    stats.raw_bytes.fetch_add(body_len, std::memory_order_relaxed);
+    stats.compressed_bytes.fetch_add(compressed.size(), std::memory_order_relaxed);
+    header.flags |= kFlagCompressed;
+    return AppendFrame(header, meta, compressed.data(), compressed.size(), out);
+}
+
+/**
+ * @brief 取得帧的消息体，压缩的消息体解压到storage中
+ * @param header 固定帧头
+ * @param body 帧中的消息体
+ * @param storage 解压缓冲区，消息体未压缩时不使用
+ * @param data 输出，消息体的起始位置
+ * @param len 输出，消息体长度
+ * @return 解压失败返回false
+ */
+bool DecodeFrameBody(const FrameHeader &header, const char *body, std::string *storage,
+                     const char **data, size_t *len)
+{
+    if (!(header.flags & kFlagCompressed))
+    {
+        *data = body;
+        *len = header.body_len;
+        return true;
+    }
+    if (!Compression::Decompress(body, header.body_len, kMaxFrameBodySize, storage))
+    {
+        return false;
+    }
+    Compression::GetStats().decompressed_bytes.fetch_add(storage->size(), std::memory_order_relaxed);
+    *data = storage->data();
+    *len = storage->size();
+    return true;
+}
@@ -55,6 +55,12 @@ void RpcConfig::LoadConfigFile(std::string &config_file)
     ifs.close();
 }
 
+// 全部配置项，加载完成后只读
+const std::unordered_map<std::string, std::string> &RpcConfig::LoadAll() const
+{
+    return config_map_;
+}
+
 // 查询配置项信息
 std::string RpcConfig::Load(const std::string &key)
 {
@@ -66,6 +72,42 @@ std::string RpcConfig::Load(const std::string &key)
     return it->second;
 }
 
+// 查询整数配置项，不存在或非法时返回默认值
+int RpcConfig::LoadInt(const std::string &key, int default_value)
+{
+    auto it = config_map_.find(key);
+    if (it == config_map_.end() || it->second.empty())
+    {
+        return default_value;
+    }
+    try
+    {
+        return std::stoi(it->second);
+    }
+    catch (const std::exception &)
+    {
+        LOG_WARN << "Invalid integer config " << key << "=" << it->second;
+        return default_value;
+    }
+}
+
+// 查询布尔配置项(true/false/1/0)，不存在时返回默认值
+bool RpcConfig::LoadBool(const std::string &key, bool default_value)
+{
+    auto it = config_map_.find(key);
+    if (it == config_map_.end() || it->second.empty())
+    {
+        return default_value;
+    }
+    return it->second == "true" || it->second == "1";
+}
+
+// 查询服务级整数配置项，依次查找"服务名.key"和"key"，都不存在时返回默认值
+int RpcConfig::LoadServiceInt(const std::string &service, const std::string &key, int default_value)
+{
+    return LoadInt(service + "." + key, LoadInt(key, default_value));
+}
+
 std::unordered_set<std::string> RpcConfig::LoadService()
 {
     // auto it = config_map_.find(key);
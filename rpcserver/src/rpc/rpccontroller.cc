@@ -1,8 +1,37 @@
 #include "rpccontroller.h"
+#include "rpcstream.h"
 #include "muduo/net/EventLoop.h"
 #include <mutex>
+
+// 当前线程正在执行的RPC方法的截止时间
+static thread_local TheRpcController::Clock::time_point tls_deadline = TheRpcController::Clock::time_point::max();
+
+TheRpcController::DeadlineScope::DeadlineScope(Clock::time_point deadline)
+    : saved_(tls_deadline)
+{
+    tls_deadline = deadline;
+}
+TheRpcController::DeadlineScope::~DeadlineScope()
+{
+    tls_deadline = saved_;
+}
+
+// 当前线程正在执行的RPC方法所属连接的IO线程
+static thread_local muduo::net::EventLoop *tls_loop = nullptr;
+
+TheRpcController::LoopScope::LoopScope(muduo::net::EventLoop *loop)
+    : saved_(tls_loop)
+{
+    tls_loop = loop;
+}
+TheRpcController::LoopScope::~LoopScope()
+{
+    tls_loop = saved_;
+}
+
 TheRpcController::TheRpcController()
-    : failed_(false), canceled_(false), cancel_callback_(nullptr) {}
+    : failed_(false), canceled_(false), cancel_callback_(nullptr),
+      timeout_ms_(0), deadline_(Clock::time_point::max()), priority_(RpcPriority::NORMAL) {}
 
 void TheRpcController::Reset()
 {
@@ -11,6 +40,10 @@ void TheRpcController::Reset()
     canceled_ = false;
     cancel_callback_ = nullptr;
     connection_.reset();
+    timeout_ms_ = 0;
+    deadline_ = Clock::time_point::max();
+    priority_ = RpcPriority::NORMAL;
+    stream_.reset();
 }
 
 bool TheRpcController::Failed() const
@@ -67,4 +100,48 @@ void TheRpcController::NotifyOnCancel(google::protobuf::Closure *callback)
 {
     std::lock_guard<std::mutex> lock(mutex_);
     cancel_callback_ = callback;
-}
\ No newline at end of file
+}
+
+void TheRpcController::SetTimeout(int64_t timeout_ms)
+{
+    timeout_ms_ = timeout_ms;
+}
+int64_t TheRpcController::Timeout() const
+{
+    return timeout_ms_;
+}
+
+void TheRpcController::SetDeadline(Clock::time_point deadline)
+{
+    deadline_ = deadline;
+}
+TheRpcController::Clock::time_point TheRpcController::Deadline() const
+{
+    return deadline_;
+}
+
+TheRpcController::Clock::time_point TheRpcController::CurrentDeadline()
+{
+    return tls_deadline;
+}
+muduo::net::EventLoop *TheRpcController::CurrentLoop()
+{
+    return tls_loop;
+}
+
+void TheRpcController::SetPriority(RpcPriority priority)
+{
+    priority_ = priority;
+}
+RpcPriority TheRpcController::Priority() const
+{
+    return priority_;
+}
+void TheRpcController::SetStream(std::shared_ptr<RpcStream> stream)
+{
+    stream_ = std::move(stream);
+}
+RpcStream *TheRpcController::Stream() const
+{
+    return stream_.get();
+}
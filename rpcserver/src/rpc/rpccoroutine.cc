@@ -0,0 +1,71 @@
+#include "rpccoroutine.h"
+
+/**
+ * @brief 构造函数
+ * @param channel 用于调用的channel
+ * @param method 要远程调用的方法
+ * @param controller rpc控制对象，失败原因写入其中
+ * @param request 请求参数
+ * @param response 响应，成功时填入
+ */
+RpcCall::RpcCall(TheRpcChannel &channel, const google::protobuf::MethodDescriptor *method, TheRpcController *controller,
+                 const google::protobuf::Message *request, google::protobuf::Message *response)
+    : channel_(channel),
+      method_(method),
+      controller_(controller),
+      request_(request),
+      response_(response)
+{
+}
+
+// 发出请求，调用已在本线程中完成(如熔断或服务发现失败)时返回false，不挂起
+bool RpcCall::await_suspend(std::coroutine_handle<> handle)
+{
+    handle_ = handle;
+    deadline_ = TheRpcController::CurrentDeadline();
+    pool_ = WorkerPool::Current();
+    // 业务线程中记录所属连接的IO线程，线程池队列已满或已停止时退回到那里恢复，不在会话读线程中执行业务代码
+    loop_ = muduo::net::EventLoop::getEventLoopOfCurrentThread();
+    if (!loop_)
+    {
+        loop_ = TheRpcController::CurrentLoop();
+    }
+    channel_.AsyncCallMethod(method_, controller_, request_, response_, [this]
+                             { OnComplete(); }, deadline_);
+    // 完成回调先执行时由本线程继续执行协程，否则由完成回调恢复
+    return state_.exchange(kSuspended, std::memory_order_acq_rel) != kCompleted;
+}
+
+// 调用完成，在会话读线程或超时定时器线程中执行
+void RpcCall::OnComplete()
+{
+    // 协程尚未挂起时由await_suspend返回false继续执行，此后不能再访问本对象
+    if (state_.exchange(kCompleted, std::memory_order_acq_rel) == kSuspended)
+    {
+        Resume();
+    }
+}
+
+// 回到发起调用的业务线程池或IO线程恢复协程
+void RpcCall::Resume()
+{
+    // 协程恢复后本对象随即销毁，先取出需要的字段
+    auto resume = [handle = handle_, deadline = deadline_, loop = loop_]
+    {
+        // 恢复后的代码中发起的调用同样继承所在RPC方法的截止时间和IO线程
+        TheRpcController::DeadlineScope deadline_scope(deadline);
+        TheRpcController::LoopScope loop_scope(loop);
+        handle.resume();
+    };
+    // 不在会话读线程中执行业务代码，避免阻塞同一会话上其他调用的响应
+    if (pool_ && pool_->Submit(resume))
+    {
+        return;
+    }
+    if (loop_)
+    {
+        loop_->queueInLoop(resume);
+        return;
+    }
+    resume();
+}
@@ -26,6 +26,12 @@ PROTOBUF_CONSTEXPR RpcHeader::RpcHeader(
     /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.params_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.keep_alive_)*/false
+  , /*decltype(_impl_.max_protocol_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.priority_)*/0u
+  , /*decltype(_impl_.compression_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RpcHeaderDefaultTypeInternal {
   PROTOBUF_CONSTEXPR RpcHeaderDefaultTypeInternal()
@@ -36,6 +42,44 @@ struct RpcHeaderDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcResponseHeader::RpcResponseHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.error_code_)*/0
+  , /*decltype(_impl_.protocol_)*/0u
+  , /*decltype(_impl_.compression_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcResponseHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcResponseHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcResponseHeaderDefaultTypeInternal() {}
+  union {
+    RpcResponseHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
+PROTOBUF_CONSTEXPR RpcMeta::RpcMeta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.service_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.method_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_code_)*/0
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_.priority_)*/0u
+  , /*decltype(_impl_.window_)*/0u
+  , /*decltype(_impl_.compression_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RpcMetaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RpcMetaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RpcMetaDefaultTypeInternal() {}
+  union {
+    RpcMeta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RpcMetaDefaultTypeInternal _RpcMeta_default_instance_;
 PROTOBUF_CONSTEXPR ServiceMeta::ServiceMeta(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -83,8 +127,14 @@ PROTOBUF_CONSTEXPR ServiceEndpoint::ServiceEndpoint(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.version_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.unix_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shm_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.port_)*/0u
   , /*decltype(_impl_.weight_)*/0u
+  , /*decltype(_impl_.method_id_)*/0u
+  , /*decltype(_impl_.inflight_)*/0u
+  , /*decltype(_impl_.cpu_permille_)*/0u
+  , /*decltype(_impl_.queue_delay_us_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ServiceEndpointDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ServiceEndpointDefaultTypeInternal()
@@ -96,7 +146,7 @@ struct ServiceEndpointDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServiceEndpointDefaultTypeInternal _ServiceEndpoint_default_instance_;
 }  // namespace TheChat
-static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[5];
+static ::_pb::Metadata file_level_metadata_rpcheader_2eproto[7];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rpcheader_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rpcheader_2eproto = nullptr;
 
@@ -110,6 +160,38 @@ const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABL
   PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.service_name_),
   PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.method_name_),
   PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.params_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.keep_alive_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.max_protocol_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcHeader, _impl_.compression_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.error_code_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.protocol_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcResponseHeader, _impl_.compression_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.service_name_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.method_name_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.error_code_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.error_text_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.window_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::RpcMeta, _impl_.compression_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TheChat::ServiceMeta, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -145,70 +227,909 @@ const uint32_t TableStruct_rpcheader_2eproto::offsets[] PROTOBUF_SECTION_VARIABL
   PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.port_),
   PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.weight_),
   PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.method_id_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.unix_path_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.shm_path_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.inflight_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.cpu_permille_),
+  PROTOBUF_FIELD_OFFSET(::TheChat::ServiceEndpoint, _impl_.queue_delay_us_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::TheChat::RpcHeader)},
-  { 9, -1, -1, sizeof(::TheChat::ServiceMeta)},
-  { 18, -1, -1, sizeof(::TheChat::RequestHeader)},
-  { 26, -1, -1, sizeof(::TheChat::ResponseHeader)},
-  { 34, -1, -1, sizeof(::TheChat::ServiceEndpoint)},
+  { 15, -1, -1, sizeof(::TheChat::RpcResponseHeader)},
+  { 27, -1, -1, sizeof(::TheChat::RpcMeta)},
+  { 41, -1, -1, sizeof(::TheChat::ServiceMeta)},
+  { 50, -1, -1, sizeof(::TheChat::RequestHeader)},
+  { 58, -1, -1, sizeof(::TheChat::ResponseHeader)},
+  { 66, -1, -1, sizeof(::TheChat::ServiceEndpoint)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TheChat::_RpcHeader_default_instance_._instance,
+  &::TheChat::_RpcResponseHeader_default_instance_._instance,
+  &::TheChat::_RpcMeta_default_instance_._instance,
+  &::TheChat::_ServiceMeta_default_instance_._instance,
+  &::TheChat::_RequestHeader_default_instance_._instance,
+  &::TheChat::_ResponseHeader_default_instance_._instance,
+  &::TheChat::_ServiceEndpoint_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017rpcheader.proto\022\007TheChat\"\277\001\n\tRpcHeader"
+  "\022\024\n\014service_name\030\001 \001(\t\022\023\n\013method_name\030\002 "
+  "\001(\t\022\016\n\006params\030\003 \001(\014\022\022\n\nkeep_alive\030\004 \001(\010\022"
+  "\022\n\nrequest_id\030\005 \001(\004\022\024\n\014max_protocol\030\006 \001("
+  "\r\022\022\n\ntimeout_ms\030\007 \001(\r\022\020\n\010priority\030\010 \001(\r\022"
+  "\023\n\013compression\030\t \001(\r\"\210\001\n\021RpcResponseHead"
+  "er\022\022\n\nrequest_id\030\001 \001(\004\022\022\n\nerror_code\030\002 \001"
+  "(\005\022\022\n\nerror_text\030\003 \001(\t\022\020\n\010response\030\004 \001(\014"
+  "\022\020\n\010protocol\030\005 \001(\r\022\023\n\013compression\030\006 \001(\r\""
+  "\247\001\n\007RpcMeta\022\024\n\014service_name\030\001 \001(\t\022\023\n\013met"
+  "hod_name\030\002 \001(\t\022\022\n\nerror_code\030\003 \001(\005\022\022\n\ner"
+  "ror_text\030\004 \001(\t\022\022\n\ntimeout_ms\030\005 \001(\r\022\020\n\010pr"
+  "iority\030\006 \001(\r\022\016\n\006window\030\007 \001(\r\022\023\n\013compress"
+  "ion\030\010 \001(\r\";\n\013ServiceMeta\022\n\n\002ip\030\001 \001(\t\022\014\n\004"
+  "port\030\002 \001(\005\022\022\n\nkeep_alive\030\003 \001(\010\"4\n\rReques"
+  "tHeader\022\022\n\nmessage_id\030\001 \001(\005\022\017\n\007content\030\002"
+  " \001(\014\"5\n\016ResponseHeader\022\022\n\nmessage_id\030\001 \001"
+  "(\005\022\017\n\007content\030\002 \001(\014\"\304\001\n\017ServiceEndpoint\022"
+  "\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\r\022\016\n\006weight\030\003 \001("
+  "\r\022\017\n\007version\030\004 \001(\t\022\021\n\tmethod_id\030\005 \001(\r\022\021\n"
+  "\tunix_path\030\006 \001(\t\022\020\n\010shm_path\030\007 \001(\t\022\020\n\010in"
+  "flight\030\010 \001(\r\022\024\n\014cpu_permille\030\t \001(\r\022\026\n\016qu"
+  "eue_delay_us\030\n \001(\rb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_rpcheader_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rpcheader_2eproto = {
+    false, false, 906, descriptor_table_protodef_rpcheader_2eproto,
+    "rpcheader.proto",
+    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 7,
+    schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
+    file_level_metadata_rpcheader_2eproto, file_level_enum_descriptors_rpcheader_2eproto,
+    file_level_service_descriptors_rpcheader_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcheader_2eproto_getter() {
+  return &descriptor_table_rpcheader_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcheader_2eproto(&descriptor_table_rpcheader_2eproto);
+namespace TheChat {
+
+// ===================================================================
+
+class RpcHeader::_Internal {
+ public:
 };
 
-static const ::_pb::Message* const file_default_instances[] = {
-  &::TheChat::_RpcHeader_default_instance_._instance,
-  &::TheChat::_ServiceMeta_default_instance_._instance,
-  &::TheChat::_RequestHeader_default_instance_._instance,
-  &::TheChat::_ResponseHeader_default_instance_._instance,
-  &::TheChat::_ServiceEndpoint_default_instance_._instance,
-};
+RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.RpcHeader)
+}
+RpcHeader::RpcHeader(const RpcHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.params_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.keep_alive_){}
+    , decltype(_impl_.max_protocol_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_service_name().empty()) {
+    _this->_impl_.service_name_.Set(from._internal_service_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_method_name().empty()) {
+    _this->_impl_.method_name_.Set(from._internal_method_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.params_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.params_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_params().empty()) {
+    _this->_impl_.params_.Set(from._internal_params(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.compression_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.RpcHeader)
+}
+
+inline void RpcHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.service_name_){}
+    , decltype(_impl_.method_name_){}
+    , decltype(_impl_.params_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.keep_alive_){false}
+    , decltype(_impl_.max_protocol_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.priority_){0u}
+    , decltype(_impl_.compression_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.service_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.method_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.params_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.params_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcHeader::~RpcHeader() {
+  // @@protoc_insertion_point(destructor:TheChat.RpcHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.service_name_.Destroy();
+  _impl_.method_name_.Destroy();
+  _impl_.params_.Destroy();
+}
+
+void RpcHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.RpcHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.service_name_.ClearToEmpty();
+  _impl_.method_name_.ClearToEmpty();
+  _impl_.params_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.compression_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string service_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_service_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcHeader.service_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string method_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_method_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcHeader.method_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes params = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_params();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool keep_alive = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.keep_alive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_protocol = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_protocol_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 priority = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.RpcHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string service_name = 1;
+  if (!this->_internal_service_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.RpcHeader.service_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_service_name(), target);
+  }
+
+  // string method_name = 2;
+  if (!this->_internal_method_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_method_name().data(), static_cast<int>(this->_internal_method_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.RpcHeader.method_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_method_name(), target);
+  }
+
+  // bytes params = 3;
+  if (!this->_internal_params().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_params(), target);
+  }
+
+  // bool keep_alive = 4;
+  if (this->_internal_keep_alive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_keep_alive(), target);
+  }
+
+  // uint64 request_id = 5;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_request_id(), target);
+  }
+
+  // uint32 max_protocol = 6;
+  if (this->_internal_max_protocol() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_max_protocol(), target);
+  }
+
+  // uint32 timeout_ms = 7;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_timeout_ms(), target);
+  }
+
+  // uint32 priority = 8;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_priority(), target);
+  }
+
+  // uint32 compression = 9;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.RpcHeader)
+  return target;
+}
+
+size_t RpcHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.RpcHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string service_name = 1;
+  if (!this->_internal_service_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_service_name());
+  }
+
+  // string method_name = 2;
+  if (!this->_internal_method_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_method_name());
+  }
+
+  // bytes params = 3;
+  if (!this->_internal_params().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_params());
+  }
+
+  // uint64 request_id = 5;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // bool keep_alive = 4;
+  if (this->_internal_keep_alive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 max_protocol = 6;
+  if (this->_internal_max_protocol() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_protocol());
+  }
+
+  // uint32 timeout_ms = 7;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // uint32 priority = 8;
+  if (this->_internal_priority() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
+  }
+
+  // uint32 compression = 9;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcHeader*>(&to_msg);
+  auto& from = static_cast<const RpcHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.RpcHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_service_name().empty()) {
+    _this->_internal_set_service_name(from._internal_service_name());
+  }
+  if (!from._internal_method_name().empty()) {
+    _this->_internal_set_method_name(from._internal_method_name());
+  }
+  if (!from._internal_params().empty()) {
+    _this->_internal_set_params(from._internal_params());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_keep_alive() != 0) {
+    _this->_internal_set_keep_alive(from._internal_keep_alive());
+  }
+  if (from._internal_max_protocol() != 0) {
+    _this->_internal_set_max_protocol(from._internal_max_protocol());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcHeader::CopyFrom(const RpcHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.RpcHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RpcHeader::IsInitialized() const {
+  return true;
+}
+
+void RpcHeader::InternalSwap(RpcHeader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.service_name_, lhs_arena,
+      &other->_impl_.service_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.method_name_, lhs_arena,
+      &other->_impl_.method_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.params_, lhs_arena,
+      &other->_impl_.params_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.compression_)
+      + sizeof(RpcHeader::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(RpcHeader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[0]);
+}
+
+// ===================================================================
+
+class RpcResponseHeader::_Internal {
+ public:
+};
+
+RpcResponseHeader::RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TheChat.RpcResponseHeader)
+}
+RpcResponseHeader::RpcResponseHeader(const RpcResponseHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RpcResponseHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.response_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.error_code_){}
+    , decltype(_impl_.protocol_){}
+    , decltype(_impl_.compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.response_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.response_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_response().empty()) {
+    _this->_impl_.response_.Set(from._internal_response(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.compression_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.RpcResponseHeader)
+}
+
+inline void RpcResponseHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_text_){}
+    , decltype(_impl_.response_){}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.error_code_){0}
+    , decltype(_impl_.protocol_){0u}
+    , decltype(_impl_.compression_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.response_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.response_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RpcResponseHeader::~RpcResponseHeader() {
+  // @@protoc_insertion_point(destructor:TheChat.RpcResponseHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RpcResponseHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_text_.Destroy();
+  _impl_.response_.Destroy();
+}
+
+void RpcResponseHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RpcResponseHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_text_.ClearToEmpty();
+  _impl_.response_.ClearToEmpty();
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.compression_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RpcResponseHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 request_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 error_code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_text = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcResponseHeader.error_text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes response = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_response();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 protocol = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.protocol_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RpcResponseHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.RpcResponseHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_request_id(), target);
+  }
+
+  // int32 error_code = 2;
+  if (this->_internal_error_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_error_code(), target);
+  }
+
+  // string error_text = 3;
+  if (!this->_internal_error_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_text().data(), static_cast<int>(this->_internal_error_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.RpcResponseHeader.error_text");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_text(), target);
+  }
+
+  // bytes response = 4;
+  if (!this->_internal_response().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_response(), target);
+  }
+
+  // uint32 protocol = 5;
+  if (this->_internal_protocol() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_protocol(), target);
+  }
+
+  // uint32 compression = 6;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.RpcResponseHeader)
+  return target;
+}
+
+size_t RpcResponseHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.RpcResponseHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error_text = 3;
+  if (!this->_internal_error_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_text());
+  }
+
+  // bytes response = 4;
+  if (!this->_internal_response().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_response());
+  }
+
+  // uint64 request_id = 1;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // int32 error_code = 2;
+  if (this->_internal_error_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
+  }
+
+  // uint32 protocol = 5;
+  if (this->_internal_protocol() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol());
+  }
+
+  // uint32 compression = 6;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcResponseHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RpcResponseHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcResponseHeader::GetClassData() const { return &_class_data_; }
+
+
+void RpcResponseHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcResponseHeader*>(&to_msg);
+  auto& from = static_cast<const RpcResponseHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.RpcResponseHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (!from._internal_response().empty()) {
+    _this->_internal_set_response(from._internal_response());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_error_code() != 0) {
+    _this->_internal_set_error_code(from._internal_error_code());
+  }
+  if (from._internal_protocol() != 0) {
+    _this->_internal_set_protocol(from._internal_protocol());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RpcResponseHeader::CopyFrom(const RpcResponseHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.RpcResponseHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-const char descriptor_table_protodef_rpcheader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\017rpcheader.proto\022\007TheChat\"F\n\tRpcHeader\022"
-  "\024\n\014service_name\030\001 \001(\t\022\023\n\013method_name\030\002 \001"
-  "(\t\022\016\n\006params\030\003 \001(\014\";\n\013ServiceMeta\022\n\n\002ip\030"
-  "\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\022\n\nkeep_alive\030\003 \001(\010\""
-  "4\n\rRequestHeader\022\022\n\nmessage_id\030\001 \001(\005\022\017\n\007"
-  "content\030\002 \001(\014\"5\n\016ResponseHeader\022\022\n\nmessa"
-  "ge_id\030\001 \001(\005\022\017\n\007content\030\002 \001(\014\"L\n\017ServiceE"
-  "ndpoint\022\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\r\022\016\n\006wei"
-  "ght\030\003 \001(\r\022\017\n\007version\030\004 \001(\tb\006proto3"
-  ;
-static ::_pbi::once_flag descriptor_table_rpcheader_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_rpcheader_2eproto = {
-    false, false, 354, descriptor_table_protodef_rpcheader_2eproto,
-    "rpcheader.proto",
-    &descriptor_table_rpcheader_2eproto_once, nullptr, 0, 5,
-    schemas, file_default_instances, TableStruct_rpcheader_2eproto::offsets,
-    file_level_metadata_rpcheader_2eproto, file_level_enum_descriptors_rpcheader_2eproto,
-    file_level_service_descriptors_rpcheader_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rpcheader_2eproto_getter() {
-  return &descriptor_table_rpcheader_2eproto;
+bool RpcResponseHeader::IsInitialized() const {
+  return true;
 }
 
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rpcheader_2eproto(&descriptor_table_rpcheader_2eproto);
-namespace TheChat {
+void RpcResponseHeader::InternalSwap(RpcResponseHeader* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.response_, lhs_arena,
+      &other->_impl_.response_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.compression_)
+      + sizeof(RpcResponseHeader::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(RpcResponseHeader, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RpcResponseHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
+      file_level_metadata_rpcheader_2eproto[1]);
+}
 
 // ===================================================================
 
-class RpcHeader::_Internal {
+class RpcMeta::_Internal {
  public:
 };
 
-RpcHeader::RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+RpcMeta::RpcMeta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:TheChat.RpcHeader)
+  // @@protoc_insertion_point(arena_constructor:TheChat.RpcMeta)
 }
-RpcHeader::RpcHeader(const RpcHeader& from)
+RpcMeta::RpcMeta(const RpcMeta& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  RpcHeader* const _this = this; (void)_this;
+  RpcMeta* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.service_name_){}
     , decltype(_impl_.method_name_){}
-    , decltype(_impl_.params_){}
+    , decltype(_impl_.error_text_){}
+    , decltype(_impl_.error_code_){}
+    , decltype(_impl_.timeout_ms_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.window_){}
+    , decltype(_impl_.compression_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -228,25 +1149,33 @@ RpcHeader::RpcHeader(const RpcHeader& from)
     _this->_impl_.method_name_.Set(from._internal_method_name(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.params_.InitDefault();
+  _impl_.error_text_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.params_.Set("", GetArenaForAllocation());
+    _impl_.error_text_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_params().empty()) {
-    _this->_impl_.params_.Set(from._internal_params(), 
+  if (!from._internal_error_text().empty()) {
+    _this->_impl_.error_text_.Set(from._internal_error_text(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:TheChat.RpcHeader)
+  ::memcpy(&_impl_.error_code_, &from._impl_.error_code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.error_code_)) + sizeof(_impl_.compression_));
+  // @@protoc_insertion_point(copy_constructor:TheChat.RpcMeta)
 }
 
-inline void RpcHeader::SharedCtor(
+inline void RpcMeta::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.service_name_){}
     , decltype(_impl_.method_name_){}
-    , decltype(_impl_.params_){}
+    , decltype(_impl_.error_text_){}
+    , decltype(_impl_.error_code_){0}
+    , decltype(_impl_.timeout_ms_){0u}
+    , decltype(_impl_.priority_){0u}
+    , decltype(_impl_.window_){0u}
+    , decltype(_impl_.compression_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.service_name_.InitDefault();
@@ -257,14 +1186,14 @@ inline void RpcHeader::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.method_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.params_.InitDefault();
+  _impl_.error_text_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.params_.Set("", GetArenaForAllocation());
+    _impl_.error_text_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-RpcHeader::~RpcHeader() {
-  // @@protoc_insertion_point(destructor:TheChat.RpcHeader)
+RpcMeta::~RpcMeta() {
+  // @@protoc_insertion_point(destructor:TheChat.RpcMeta)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -272,30 +1201,33 @@ RpcHeader::~RpcHeader() {
   SharedDtor();
 }
 
-inline void RpcHeader::SharedDtor() {
+inline void RpcMeta::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.service_name_.Destroy();
   _impl_.method_name_.Destroy();
-  _impl_.params_.Destroy();
+  _impl_.error_text_.Destroy();
 }
 
-void RpcHeader::SetCachedSize(int size) const {
+void RpcMeta::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void RpcHeader::Clear() {
-// @@protoc_insertion_point(message_clear_start:TheChat.RpcHeader)
+void RpcMeta::Clear() {
+// @@protoc_insertion_point(message_clear_start:TheChat.RpcMeta)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.service_name_.ClearToEmpty();
   _impl_.method_name_.ClearToEmpty();
-  _impl_.params_.ClearToEmpty();
+  _impl_.error_text_.ClearToEmpty();
+  ::memset(&_impl_.error_code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.error_code_)) + sizeof(_impl_.compression_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* RpcMeta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -307,7 +1239,7 @@ const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
           auto str = _internal_mutable_service_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcHeader.service_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcMeta.service_name"));
         } else
           goto handle_unusual;
         continue;
@@ -317,16 +1249,57 @@ const char* RpcHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
           auto str = _internal_mutable_method_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcHeader.method_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcMeta.method_name"));
         } else
           goto handle_unusual;
         continue;
-      // bytes params = 3;
+      // int32 error_code = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_params();
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_text = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_text();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.RpcMeta.error_text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 priority = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 window = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -353,9 +1326,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* RpcHeader::_InternalSerialize(
+uint8_t* RpcMeta::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:TheChat.RpcHeader)
+  // @@protoc_insertion_point(serialize_to_array_start:TheChat.RpcMeta)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -364,7 +1337,7 @@ uint8_t* RpcHeader::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_service_name().data(), static_cast<int>(this->_internal_service_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "TheChat.RpcHeader.service_name");
+      "TheChat.RpcMeta.service_name");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_service_name(), target);
   }
@@ -374,27 +1347,61 @@ uint8_t* RpcHeader::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_method_name().data(), static_cast<int>(this->_internal_method_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "TheChat.RpcHeader.method_name");
+      "TheChat.RpcMeta.method_name");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_method_name(), target);
   }
 
-  // bytes params = 3;
-  if (!this->_internal_params().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        3, this->_internal_params(), target);
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_error_code(), target);
+  }
+
+  // string error_text = 4;
+  if (!this->_internal_error_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_text().data(), static_cast<int>(this->_internal_error_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.RpcMeta.error_text");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error_text(), target);
+  }
+
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_timeout_ms(), target);
+  }
+
+  // uint32 priority = 6;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_priority(), target);
+  }
+
+  // uint32 window = 7;
+  if (this->_internal_window() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_window(), target);
+  }
+
+  // uint32 compression = 8;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_compression(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:TheChat.RpcHeader)
+  // @@protoc_insertion_point(serialize_to_array_end:TheChat.RpcMeta)
   return target;
 }
 
-size_t RpcHeader::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:TheChat.RpcHeader)
+size_t RpcMeta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TheChat.RpcMeta)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -415,27 +1422,52 @@ size_t RpcHeader::ByteSizeLong() const {
         this->_internal_method_name());
   }
 
-  // bytes params = 3;
-  if (!this->_internal_params().empty()) {
+  // string error_text = 4;
+  if (!this->_internal_error_text().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_params());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_text());
+  }
+
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
+  }
+
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  // uint32 priority = 6;
+  if (this->_internal_priority() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
+  }
+
+  // uint32 window = 7;
+  if (this->_internal_window() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window());
+  }
+
+  // uint32 compression = 8;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcHeader::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RpcMeta::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    RpcHeader::MergeImpl
+    RpcMeta::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcHeader::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RpcMeta::GetClassData() const { return &_class_data_; }
 
 
-void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<RpcHeader*>(&to_msg);
-  auto& from = static_cast<const RpcHeader&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.RpcHeader)
+void RpcMeta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RpcMeta*>(&to_msg);
+  auto& from = static_cast<const RpcMeta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TheChat.RpcMeta)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -446,24 +1478,39 @@ void RpcHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (!from._internal_method_name().empty()) {
     _this->_internal_set_method_name(from._internal_method_name());
   }
-  if (!from._internal_params().empty()) {
-    _this->_internal_set_params(from._internal_params());
+  if (!from._internal_error_text().empty()) {
+    _this->_internal_set_error_text(from._internal_error_text());
+  }
+  if (from._internal_error_code() != 0) {
+    _this->_internal_set_error_code(from._internal_error_code());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_window() != 0) {
+    _this->_internal_set_window(from._internal_window());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RpcHeader::CopyFrom(const RpcHeader& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.RpcHeader)
+void RpcMeta::CopyFrom(const RpcMeta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TheChat.RpcMeta)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RpcHeader::IsInitialized() const {
+bool RpcMeta::IsInitialized() const {
   return true;
 }
 
-void RpcHeader::InternalSwap(RpcHeader* other) {
+void RpcMeta::InternalSwap(RpcMeta* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -477,15 +1524,21 @@ void RpcHeader::InternalSwap(RpcHeader* other) {
       &other->_impl_.method_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.params_, lhs_arena,
-      &other->_impl_.params_, rhs_arena
+      &_impl_.error_text_, lhs_arena,
+      &other->_impl_.error_text_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RpcMeta, _impl_.compression_)
+      + sizeof(RpcMeta::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(RpcMeta, _impl_.error_code_)>(
+          reinterpret_cast<char*>(&_impl_.error_code_),
+          reinterpret_cast<char*>(&other->_impl_.error_code_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RpcHeader::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata RpcMeta::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
-      file_level_metadata_rpcheader_2eproto[0]);
+      file_level_metadata_rpcheader_2eproto[2]);
 }
 
 // ===================================================================
@@ -748,7 +1801,7 @@ void ServiceMeta::InternalSwap(ServiceMeta* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ServiceMeta::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
-      file_level_metadata_rpcheader_2eproto[1]);
+      file_level_metadata_rpcheader_2eproto[3]);
 }
 
 // ===================================================================
@@ -973,7 +2026,7 @@ void RequestHeader::InternalSwap(RequestHeader* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata RequestHeader::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
-      file_level_metadata_rpcheader_2eproto[2]);
+      file_level_metadata_rpcheader_2eproto[4]);
 }
 
 // ===================================================================
@@ -1198,7 +2251,7 @@ void ResponseHeader::InternalSwap(ResponseHeader* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ResponseHeader::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
-      file_level_metadata_rpcheader_2eproto[3]);
+      file_level_metadata_rpcheader_2eproto[5]);
 }
 
 // ===================================================================
@@ -1219,8 +2272,14 @@ ServiceEndpoint::ServiceEndpoint(const ServiceEndpoint& from)
   new (&_impl_) Impl_{
       decltype(_impl_.ip_){}
     , decltype(_impl_.version_){}
+    , decltype(_impl_.unix_path_){}
+    , decltype(_impl_.shm_path_){}
     , decltype(_impl_.port_){}
     , decltype(_impl_.weight_){}
+    , decltype(_impl_.method_id_){}
+    , decltype(_impl_.inflight_){}
+    , decltype(_impl_.cpu_permille_){}
+    , decltype(_impl_.queue_delay_us_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1240,9 +2299,25 @@ ServiceEndpoint::ServiceEndpoint(const ServiceEndpoint& from)
     _this->_impl_.version_.Set(from._internal_version(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.unix_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.unix_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_unix_path().empty()) {
+    _this->_impl_.unix_path_.Set(from._internal_unix_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.shm_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shm_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_shm_path().empty()) {
+    _this->_impl_.shm_path_.Set(from._internal_shm_path(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.port_, &from._impl_.port_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
-    reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.weight_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.queue_delay_us_) -
+    reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.queue_delay_us_));
   // @@protoc_insertion_point(copy_constructor:TheChat.ServiceEndpoint)
 }
 
@@ -1253,8 +2328,14 @@ inline void ServiceEndpoint::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.ip_){}
     , decltype(_impl_.version_){}
+    , decltype(_impl_.unix_path_){}
+    , decltype(_impl_.shm_path_){}
     , decltype(_impl_.port_){0u}
     , decltype(_impl_.weight_){0u}
+    , decltype(_impl_.method_id_){0u}
+    , decltype(_impl_.inflight_){0u}
+    , decltype(_impl_.cpu_permille_){0u}
+    , decltype(_impl_.queue_delay_us_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.ip_.InitDefault();
@@ -1265,6 +2346,14 @@ inline void ServiceEndpoint::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.version_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.unix_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.unix_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.shm_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.shm_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ServiceEndpoint::~ServiceEndpoint() {
@@ -1280,6 +2369,8 @@ inline void ServiceEndpoint::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.ip_.Destroy();
   _impl_.version_.Destroy();
+  _impl_.unix_path_.Destroy();
+  _impl_.shm_path_.Destroy();
 }
 
 void ServiceEndpoint::SetCachedSize(int size) const {
@@ -1294,9 +2385,11 @@ void ServiceEndpoint::Clear() {
 
   _impl_.ip_.ClearToEmpty();
   _impl_.version_.ClearToEmpty();
+  _impl_.unix_path_.ClearToEmpty();
+  _impl_.shm_path_.ClearToEmpty();
   ::memset(&_impl_.port_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.weight_) -
-      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.weight_));
+      reinterpret_cast<char*>(&_impl_.queue_delay_us_) -
+      reinterpret_cast<char*>(&_impl_.port_)) + sizeof(_impl_.queue_delay_us_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1342,6 +2435,58 @@ const char* ServiceEndpoint::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // uint32 method_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.method_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string unix_path = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_unix_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.ServiceEndpoint.unix_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string shm_path = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_shm_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TheChat.ServiceEndpoint.shm_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 inflight = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.inflight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cpu_permille = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.cpu_permille_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 queue_delay_us = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.queue_delay_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1403,6 +2548,50 @@ uint8_t* ServiceEndpoint::_InternalSerialize(
         4, this->_internal_version(), target);
   }
 
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_method_id(), target);
+  }
+
+  // string unix_path = 6;
+  if (!this->_internal_unix_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_unix_path().data(), static_cast<int>(this->_internal_unix_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.ServiceEndpoint.unix_path");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_unix_path(), target);
+  }
+
+  // string shm_path = 7;
+  if (!this->_internal_shm_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_shm_path().data(), static_cast<int>(this->_internal_shm_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TheChat.ServiceEndpoint.shm_path");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_shm_path(), target);
+  }
+
+  // uint32 inflight = 8;
+  if (this->_internal_inflight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_inflight(), target);
+  }
+
+  // uint32 cpu_permille = 9;
+  if (this->_internal_cpu_permille() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_cpu_permille(), target);
+  }
+
+  // uint32 queue_delay_us = 10;
+  if (this->_internal_queue_delay_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_queue_delay_us(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1433,6 +2622,20 @@ size_t ServiceEndpoint::ByteSizeLong() const {
         this->_internal_version());
   }
 
+  // string unix_path = 6;
+  if (!this->_internal_unix_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_unix_path());
+  }
+
+  // string shm_path = 7;
+  if (!this->_internal_shm_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_shm_path());
+  }
+
   // uint32 port = 2;
   if (this->_internal_port() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port());
@@ -1443,6 +2646,26 @@ size_t ServiceEndpoint::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_weight());
   }
 
+  // uint32 method_id = 5;
+  if (this->_internal_method_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_method_id());
+  }
+
+  // uint32 inflight = 8;
+  if (this->_internal_inflight() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_inflight());
+  }
+
+  // uint32 cpu_permille = 9;
+  if (this->_internal_cpu_permille() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cpu_permille());
+  }
+
+  // uint32 queue_delay_us = 10;
+  if (this->_internal_queue_delay_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_queue_delay_us());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1467,12 +2690,30 @@ void ServiceEndpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (!from._internal_version().empty()) {
     _this->_internal_set_version(from._internal_version());
   }
+  if (!from._internal_unix_path().empty()) {
+    _this->_internal_set_unix_path(from._internal_unix_path());
+  }
+  if (!from._internal_shm_path().empty()) {
+    _this->_internal_set_shm_path(from._internal_shm_path());
+  }
   if (from._internal_port() != 0) {
     _this->_internal_set_port(from._internal_port());
   }
   if (from._internal_weight() != 0) {
     _this->_internal_set_weight(from._internal_weight());
   }
+  if (from._internal_method_id() != 0) {
+    _this->_internal_set_method_id(from._internal_method_id());
+  }
+  if (from._internal_inflight() != 0) {
+    _this->_internal_set_inflight(from._internal_inflight());
+  }
+  if (from._internal_cpu_permille() != 0) {
+    _this->_internal_set_cpu_permille(from._internal_cpu_permille());
+  }
+  if (from._internal_queue_delay_us() != 0) {
+    _this->_internal_set_queue_delay_us(from._internal_queue_delay_us());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1500,9 +2741,17 @@ void ServiceEndpoint::InternalSwap(ServiceEndpoint* other) {
       &_impl_.version_, lhs_arena,
       &other->_impl_.version_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.unix_path_, lhs_arena,
+      &other->_impl_.unix_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.shm_path_, lhs_arena,
+      &other->_impl_.shm_path_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ServiceEndpoint, _impl_.weight_)
-      + sizeof(ServiceEndpoint::_impl_.weight_)
+      PROTOBUF_FIELD_OFFSET(ServiceEndpoint, _impl_.queue_delay_us_)
+      + sizeof(ServiceEndpoint::_impl_.queue_delay_us_)
       - PROTOBUF_FIELD_OFFSET(ServiceEndpoint, _impl_.port_)>(
           reinterpret_cast<char*>(&_impl_.port_),
           reinterpret_cast<char*>(&other->_impl_.port_));
@@ -1511,7 +2760,7 @@ void ServiceEndpoint::InternalSwap(ServiceEndpoint* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ServiceEndpoint::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_rpcheader_2eproto_getter, &descriptor_table_rpcheader_2eproto_once,
-      file_level_metadata_rpcheader_2eproto[4]);
+      file_level_metadata_rpcheader_2eproto[6]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1521,6 +2770,14 @@ template<> PROTOBUF_NOINLINE ::TheChat::RpcHeader*
 Arena::CreateMaybeMessage< ::TheChat::RpcHeader >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TheChat::RpcHeader >(arena);
 }
+template<> PROTOBUF_NOINLINE ::TheChat::RpcResponseHeader*
+Arena::CreateMaybeMessage< ::TheChat::RpcResponseHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::RpcResponseHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TheChat::RpcMeta*
+Arena::CreateMaybeMessage< ::TheChat::RpcMeta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TheChat::RpcMeta >(arena);
+}
 template<> PROTOBUF_NOINLINE ::TheChat::ServiceMeta*
 Arena::CreateMaybeMessage< ::TheChat::ServiceMeta >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TheChat::ServiceMeta >(arena);
@@ -4,14 +4,40 @@
 #include "rpcapplication.h"
 #include "zookeeperutil.h"
 #include "rpcheader.pb.h"
+#include "rpcclosure.h"
+#include "rpccodec.h"
 #include <unordered_set>
+#include <cstring>
+#include <arpa/inet.h>
+#include <thread>
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+#include <csignal>
+#include <ctime>
+#include <typeinfo>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
 
 // 远程服务注册
 void RpcProvider::NotifyService(std::unordered_map<std::string, google::protobuf::Service *> service_library,
-                                std::unordered_set<std::string> keep_alive_method_set)
+                                std::unordered_set<std::string> keep_alive_method_set,
+                                std::unordered_set<std::string> cacheable_method_set,
+                                std::unordered_set<std::string> single_flight_method_set)
 {
+    bool has_cacheable_method = false;
     // 当前节点配置的服务信息
     std::unordered_set<std::string> service_set = RpcApplication::GetInstance().GetConfig().LoadService(); // 存储服务名
+    // 内置的自省服务与业务服务一样注册和分发，会暴露在服务端口上，rpcadmin=true时才注册，本地HTTP端点不受影响
+    admin_service_ = std::make_unique<RpcAdminService>("provider", [this](TheChat::StatsResponse *response)
+                                                        { CollectStats(response); });
+    if (RpcApplication::GetInstance().GetConfig().LoadBool("rpcadmin", false))
+    {
+        const std::string &admin_name = admin_service_->GetDescriptor()->name();
+        service_library.emplace(admin_name, admin_service_.get());
+        service_set.insert(admin_name);
+    }
     // std::unordered_set<std::string> method_set = RpcApplication::GetInstance().GetConfig().LoadService();   // 存储方法名
 
     for (const std::string &service_str : service_set)
@@ -31,19 +57,138 @@ void RpcProvider::NotifyService(std::unordered_map<std::string, google::protobuf
         // 获取服务对象的方法的数量
         int method_count = p_service_desc->method_count();
 
+        RpcConfig &config = RpcApplication::GetInstance().GetConfig();
         LOG_INFO << "service name: " << service_name.c_str();
         for (int i = 0; i < method_count; ++i)
         {
             const google::protobuf::MethodDescriptor *p_method_desc = p_service_desc->method(i);
             std::string method_name = p_method_desc->name();
-            service_info.method_map_.insert({method_name, p_method_desc});
+            MethodInfo method_info;
+            method_info.method_ = p_method_desc;
+            // 方法级并发上限和隔舱，如 UserService.Login.rpcmaxconcurrency=50、UserService.Login.rpcworkerthreads=2
+            const std::string prefix = service_name + "." + method_name;
+            int max_concurrency = config.LoadInt(prefix + ".rpcmaxconcurrency", 0);
+            if (max_concurrency > 0)
+            {
+                AdmissionController::Config method_config;
+                method_config.target = std::chrono::milliseconds(0); // 只限制并发数
+                method_config.max_concurrency = static_cast<uint32_t>(max_concurrency);
+                method_info.admission_ = std::make_shared<AdmissionController>(method_config);
+            }
+            method_info.worker_pool_ = CreateBulkhead(prefix);
+            // 可缓存方法的有效期，如 UserService.GetInfo.rpccachettl=500
+            if (cacheable_method_set.count(method_name) > 0 || cacheable_method_set.count(prefix) > 0)
+            {
+                int ttl = config.LoadInt(prefix + ".rpccachettl", config.LoadInt("rpccachettl", 1000));
+                method_info.cache_ttl_ms_ = static_cast<uint32_t>(std::max(ttl, 0));
+                has_cacheable_method = has_cacheable_method || ttl > 0;
+            }
+            method_info.single_flight_ = single_flight_method_set.count(method_name) > 0 ||
+                                         single_flight_method_set.count(prefix) > 0;
+            method_info.metrics_ = std::make_shared<MethodMetrics>();
+            service_info.method_map_.insert({method_name, method_info});
 
             LOG_INFO << "method name: " << method_name.c_str();
         }
         service_info.service_ = it->second;
+        service_info.worker_pool_ = CreateBulkhead(service_name);
+        // 准入控制参数可按服务覆盖，如 UserService.rpcmaxconcurrency=200
+        AdmissionController::Config admission_config;
+        admission_config.target = std::chrono::milliseconds(
+            config.LoadServiceInt(service_name, "rpcadmissiontarget", static_cast<int>(admission_config.target.count())));
+        admission_config.interval = std::chrono::milliseconds(
+            config.LoadServiceInt(service_name, "rpcadmissioninterval", static_cast<int>(admission_config.interval.count())));
+        admission_config.max_concurrency = static_cast<uint32_t>(
+            std::max(config.LoadServiceInt(service_name, "rpcmaxconcurrency", 0), 0));
+        service_info.admission_ = std::make_shared<AdmissionController>(admission_config);
         service_map_.insert({service_name, service_info});
     }
+    BuildMethodTable();
     keep_alive_method_set_ = keep_alive_method_set;
+    if (has_cacheable_method && !response_cache_)
+    {
+        int cache_bytes = RpcApplication::GetInstance().GetConfig().LoadInt("rpccachebytes", 64 * 1024 * 1024);
+        response_cache_ = std::make_unique<ResponseCache>(static_cast<size_t>(std::max(cache_bytes, 0)));
+    }
+}
+
+// 按"prefix.rpcworkerthreads"创建隔舱线程池，未配置时返回空
+std::shared_ptr<WorkerPool> RpcProvider::CreateBulkhead(const std::string &prefix)
+{
+    RpcConfig &config = RpcApplication::GetInstance().GetConfig();
+    int threads = config.LoadInt(prefix + ".rpcworkerthreads", 0);
+    if (threads <= 0)
+    {
+        return nullptr;
+    }
+    int queue_size = config.LoadInt(prefix + ".rpcworkerqueuesize", config.LoadInt("rpcworkerqueuesize", 10000));
+    LOG_INFO << "bulkhead " << prefix << ": threads=" << threads << " queue=" << queue_size;
+    return std::make_shared<WorkerPool>(threads, queue_size, false, prefix);
+}
+
+// 由service_map_重建方法分发表，方法id冲突时退出
+void RpcProvider::BuildMethodTable()
+{
+    size_t method_count = 0;
+    for (auto &sp : service_map_)
+    {
+        method_count += sp.second.method_map_.size();
+    }
+    // 装载因子不超过1/2，绝大多数查找一次命中
+    size_t table_size = 1;
+    while (table_size < method_count * 2)
+    {
+        table_size <<= 1;
+    }
+    method_table_.assign(table_size, MethodEntry{});
+    const size_t mask = table_size - 1;
+    for (auto &sp : service_map_)
+    {
+        for (auto &mp : sp.second.method_map_)
+        {
+            MethodInfo &info = mp.second;
+            uint32_t id = MethodId(info.method_->full_name());
+            size_t index = id & mask;
+            while (method_table_[index].id != 0)
+            {
+                if (method_table_[index].id == id)
+                {
+                    LOG_ERROR << "Method id conflict: " << info.method_->full_name() << " and "
+                              << method_table_[index].method->full_name();
+                    exit(EXIT_FAILURE);
+                }
+                index = (index + 1) & mask;
+            }
+            // 方法隔舱优先于服务隔舱
+            WorkerPool *worker_pool = info.worker_pool_ ? info.worker_pool_.get() : sp.second.worker_pool_.get();
+            method_table_[index] = MethodEntry{id, sp.second.service_, info.method_, sp.second.admission_.get(),
+                                               info.admission_.get(), worker_pool, info.cache_ttl_ms_,
+                                               info.single_flight_, info.metrics_.get()};
+            info.table_index_ = index;
+        }
+    }
+}
+
+// 按方法id查找，不存在时返回nullptr
+const RpcProvider::MethodEntry *RpcProvider::FindMethod(uint32_t method_id) const
+{
+    if (method_id == 0 || method_table_.empty())
+    {
+        return nullptr;
+    }
+    const size_t mask = method_table_.size() - 1;
+    for (size_t index = method_id & mask;; index = (index + 1) & mask)
+    {
+        const MethodEntry &entry = method_table_[index];
+        if (entry.id == method_id)
+        {
+            return &entry;
+        }
+        if (entry.id == 0)
+        {
+            return nullptr;
+        }
+    }
 }
 
 // 启动服务节点
@@ -54,126 +199,1558 @@ void RpcProvider::Run()
     uint16_t port = atoi(RpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
     muduo::net::InetAddress address(ip, port);
 
-    // 创建TcpServer对象
-    muduo::net::TcpServer server(&event_loop_, address, "RpcProvider");
+    RpcConfig &config = RpcApplication::GetInstance().GetConfig();
+    // rpciocpus=0,2,4时IO线程依次绑定到这些CPU上
+    std::vector<int> cpus = ParseCpuList(config.Load("rpciocpus"));
+    // rpcacceptors>1时启动多个各自监听同一端口(SO_REUSEPORT)的事件循环，由内核分散新连接，
+    // 每个循环自己处理接收到的连接；否则使用单个监听循环加rpciothreads个IO线程
+    const int acceptors = config.LoadInt("rpcacceptors", 1);
+    const bool reuse_port = config.LoadBool("rpcreuseport", false);
+    // rpciouring=true时改用io_uring的multishot accept/recv接收连接和读取请求，只用于单监听循环模式，
+    // 内核不支持或创建失败时退回epoll
+    if (acceptors <= 1 && config.LoadBool("rpciouring", false))
+    {
+        uring_server_ = StartUringServer(address, reuse_port, config.LoadInt("rpciothreads", 4), cpus);
+        if (!uring_server_)
+        {
+            LOG_WARN << "io_uring backend unavailable, fall back to epoll";
+        }
+    }
+    if (acceptors <= 1 && !uring_server_)
+    {
+        // 监听socket由本节点持有，摘流量时可以只关闭它；rpcreuseport=true时新进程可以在本进程退出前监听同一端口，重启时没有停止接收的空窗
+        tcp_server_ = std::make_unique<ListenServer>(&event_loop_, address, "RpcProvider", reuse_port);
+        // 绑定连接回调和消息读写回调方法
+        tcp_server_->SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+        tcp_server_->SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        // 设置IO线程数量
+        tcp_server_->SetThreadNum(config.LoadInt("rpciothreads", 4));
+        if (!cpus.empty())
+        {
+            auto next = std::make_shared<std::atomic<size_t>>(0);
+            tcp_server_->SetThreadInitCallback([cpus, next](muduo::net::EventLoop *)
+                                               { PinThread(cpus, next->fetch_add(1)); });
+        }
+    }
+    // rpcunixpath非空时同时监听该Unix域套接字并随注册信息发布，同机的请求方优先用它连接，绕过TCP/IP协议栈；
+    // rpcshmpath非空时再监听一个引导套接字，在其上建立的连接改用共享内存字节环收发帧，
+    // 每个连接占用两个rpcshmcapacity字节的环。监听失败时不发布，请求方仍走TCP
+    std::string unix_path = config.Load("rpcunixpath");
+    if (!unix_path.empty())
+    {
+        unix_server_ = StartUnixServer(unix_path, "RpcProvider-unix", config.LoadInt("rpcunixiothreads", 2), cpus, 0);
+    }
+    std::string shm_path = config.Load("rpcshmpath");
+    if (!shm_path.empty())
+    {
+        shm_server_ = StartUnixServer(shm_path, "RpcProvider-shm", config.LoadInt("rpcshmiothreads", 2), cpus,
+                                      static_cast<size_t>(std::max(config.LoadInt("rpcshmcapacity", 1024 * 1024), 1)));
+    }
+    // 同一连接在一轮事件循环内完成的响应合并写回，rpcflushbytes=0时每个响应单独写回
+    flush_threshold_ = static_cast<size_t>(std::max(config.LoadInt("rpcflushbytes", 64 * 1024), 0));
+    // rpccompression=lz4时与同样支持lz4的请求方协商压缩，不小于rpccompressthreshold字节的v2消息体压缩后发送
+    compression_ = Compression::Parse(config.Load("rpccompression"));
+    compress_threshold_ = static_cast<size_t>(std::max(config.LoadInt("rpccompressthreshold", 4096), 0));
 
-    // 绑定连接回调和消息读写回调方法
-    server.setConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
-    server.setMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-    // 设置muduo库的线程数量
-    server.setThreadNum(4);
+    // 创建业务线程池，rpcworkerthreads=0时在IO线程中直接执行RPC方法
+    int worker_threads = config.LoadInt("rpcworkerthreads", static_cast<int>(std::thread::hardware_concurrency()));
+    if (worker_threads > 0)
+    {
+        worker_pool_ = std::make_unique<WorkerPool>(worker_threads,
+                                                    config.LoadInt("rpcworkerqueuesize", 10000),
+                                                    config.LoadBool("rpcworkstealing", false),
+                                                    "RpcWorker");
+    }
+
+    // rpcmetricsport非0时在rpcmetricsip(默认127.0.0.1)上以Prometheus文本格式输出统计，抓取在独立线程中处理
+    int metrics_port = config.LoadInt("rpcmetricsport", 0);
+    if (metrics_port > 0)
+    {
+        std::string metrics_ip = config.Load("rpcmetricsip");
+        muduo::net::InetAddress metrics_address(metrics_ip.empty() ? "127.0.0.1" : metrics_ip,
+                                                static_cast<uint16_t>(metrics_port));
+        metrics_server_ = std::make_unique<MetricsServer>(metrics_address, [this]
+                                                          {
+                                                              TheChat::StatsResponse stats;
+                                                              admin_service_->Collect(true, &stats);
+                                                              return RpcAdminService::ToPrometheus(stats); });
+        metrics_server_->Start();
+    }
 
     // 把当前节点上要发布的服务全部注册到ZooKeeper上面
-    ZooKeeperClient zookeeper_client;
-    zookeeper_client.Start();
+    zk_client_.Start();
+    // 实例节点中的静态权重可按服务覆盖，如 UserService.rpcweight=50，为0时请求方不再选择本节点
+    const std::string version = config.Load("rpcversion");
+    cpu_time_sample_ = ProcessCpuTime();
+    cpu_sample_time_ = std::chrono::steady_clock::now();
     for (auto &sp : service_map_)
     {
         std::string service_path = "/" + sp.first;
         // 创建服务节点
-        zookeeper_client.Create(service_path);
+        zk_client_.Create(service_path);
+        const uint32_t weight = static_cast<uint32_t>(std::max(config.LoadServiceInt(sp.first, "rpcweight", 100), 0));
         for (auto &mp : sp.second.method_map_)
         {
             std::string method_path = service_path + "/" + mp.first;
-            std::string node_data = ip + ":" + std::to_string(port);
+            // node_data = ip:port;mid=方法id[;uds=套接字路径]，客户端据此改用方法id调用，同机时改走Unix域套接字
+            std::string node_data = ip + ":" + std::to_string(port) +
+                                    ";mid=" + std::to_string(MethodId(mp.second.method_->full_name()));
+            if (unix_server_)
+            {
+                node_data += ";uds=" + unix_server_->Path();
+            }
+            if (shm_server_)
+            {
+                node_data += ";shm=" + shm_server_->Path();
+            }
             // 创建方法节点
-            zookeeper_client.Create(method_path, node_data);
+            zk_client_.Create(method_path, node_data);
+            registered_nodes_.emplace_back(method_path, node_data);
+            // 方法节点下每个实例一个临时节点，值为ServiceEndpoint，进程退出或会话过期时自动删除
+            TheChat::ServiceEndpoint endpoint;
+            endpoint.set_ip(ip);
+            endpoint.set_port(port);
+            endpoint.set_weight(weight);
+            endpoint.set_version(version);
+            endpoint.set_method_id(MethodId(mp.second.method_->full_name()));
+            if (unix_server_)
+            {
+                endpoint.set_unix_path(unix_server_->Path());
+            }
+            if (shm_server_)
+            {
+                endpoint.set_shm_path(shm_server_->Path());
+            }
+            std::string instance_path = method_path + "/" + ip + ":" + std::to_string(port);
+            if (zk_client_.CreateEphemeral(instance_path, endpoint.SerializeAsString()))
+            {
+                instance_nodes_.emplace_back(std::move(instance_path), std::move(endpoint));
+            }
         }
     }
+    // 每rpcloadinterval毫秒采样一次负载，变化明显时最多每rpcloadpublishinterval毫秒改写一次实例节点
+    int load_interval_ms = config.LoadInt("rpcloadinterval", 1000);
+    load_publish_interval_ = std::chrono::milliseconds(std::max(config.LoadInt("rpcloadpublishinterval", 5000), 0));
+    load_published_time_ = std::chrono::steady_clock::now();
+    if (load_interval_ms > 0 && !instance_nodes_.empty())
+    {
+        event_loop_.runEvery(load_interval_ms / 1000.0, std::bind(&RpcProvider::RefreshLoad, this));
+    }
+    // 会话过期时ZooKeeper删除了本会话的实例节点，会话重新建立后重新创建，否则本实例不再被请求方发现
+    zk_client_.SetSessionCallback([this]
+                                  { RegisterInstances(); });
 
     // rpc服务端准备启动，打印信息
-    LOG_INFO << "RpcProvider start service at ip:" << ip << " port:" << port;
+    LOG_INFO << "RpcProvider start service at ip:" << ip << " port:" << port
+             << (acceptors > 1 ? " with " + std::to_string(acceptors) + " reuseport acceptors" : "")
+             << (uring_server_ ? " with io_uring" : "")
+             << (unix_server_ ? " unix:" + unix_server_->Path() : "")
+             << (shm_server_ ? " shm:" + shm_server_->Path() : "");
+
+    // 每10秒输出一次准入统计和队列深度
+    event_loop_.runEvery(10.0, std::bind(&RpcProvider::ReportStats, this));
+    // 收到SIGTERM或SIGINT后优雅退出，rpcdraintimeout为等待未完成调用的最长时间
+    drain_timeout_ms_ = config.LoadInt("rpcdraintimeout", 10000);
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = OnStopSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGTERM, &action, nullptr);
+    sigaction(SIGINT, &action, nullptr);
+    event_loop_.runEvery(0.1, std::bind(&RpcProvider::CheckDrain, this));
 
     // 启动网络服务
-    server.start();
+    if (tcp_server_)
+    {
+        if (!tcp_server_->Start())
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
+    else if (!uring_server_)
+    {
+        StartAcceptors(address, acceptors, cpus);
+    }
     event_loop_.loop();
+    zk_client_.SetSessionCallback(nullptr);
+    // 在主循环线程中销毁TCP、io_uring和Unix域套接字服务端
+    tcp_server_.reset();
+    uring_server_.reset();
+    unix_server_.reset();
+    shm_server_.reset();
+
+    // 摘流量完成，停止各监听循环，服务端在各自的线程中销毁
+    {
+        std::lock_guard<std::mutex> lock(acceptor_mutex_);
+        for (auto &acceptor : acceptors_)
+        {
+            muduo::net::EventLoop *loop = acceptor.first;
+            // 经由任务队列退出，循环尚未开始运行时也不会丢失
+            loop->queueInLoop([loop]
+                              { loop->quit(); });
+        }
+    }
+    for (auto &thread : acceptor_threads_)
+    {
+        thread.join();
+    }
+    acceptor_threads_.clear();
+    metrics_server_.reset();
+    if (size_t inflight = InflightCalls())
+    {
+        // 仍在执行的调用完成时会访问已停止的IO线程，直接退出进程
+        LOG_WARN << "drain timeout, abandon " << inflight << " calls";
+        exit(EXIT_SUCCESS);
+    }
+    LOG_INFO << "RpcProvider stopped";
+}
+
+// 开始优雅退出，可在任意线程调用
+void RpcProvider::Shutdown()
+{
+    event_loop_.runInLoop([this]
+                          { BeginDrain(); });
+}
+
+// 收到退出信号，只设置标志，由主循环的定时器处理
+static std::atomic_bool g_stop_requested{false};
+void RpcProvider::OnStopSignal(int)
+{
+    g_stop_requested.store(true, std::memory_order_relaxed);
+}
+
+// 主循环定时检查：收到退出信号时开始摘流量，摘流量期间未完成的调用全部结束或超时后停止事件循环
+void RpcProvider::CheckDrain()
+{
+    if (!draining_.load(std::memory_order_relaxed))
+    {
+        if (g_stop_requested.load(std::memory_order_relaxed))
+        {
+            BeginDrain();
+        }
+        return;
+    }
+    if (drain_finishing_)
+    {
+        return;
+    }
+    size_t inflight = InflightCalls();
+    if (inflight != 0 && std::chrono::steady_clock::now() < drain_deadline_)
+    {
+        return;
+    }
+    // 再等一个检查周期，让最后完成的调用的响应写出
+    drain_finishing_ = true;
+    LOG_INFO << "drain finished, inflight=" << inflight;
+    event_loop_.runAfter(0.1, [this]
+                         { event_loop_.quit(); });
+}
+
+// 摘流量：先从ZooKeeper删除本节点，再停止接收新连接，之后到达的请求被拒绝，客户端据此重新做服务发现
+void RpcProvider::BeginDrain()
+{
+    if (draining_.exchange(true))
+    {
+        return;
+    }
+    LOG_INFO << "RpcProvider start draining, inflight=" << InflightCalls();
+    drain_deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(drain_timeout_ms_, 0));
+    // 先删实例节点，方法节点下没有其他实例时才能删除
+    for (auto &node : instance_nodes_)
+    {
+        zk_client_.DeleteOwned(node.first);
+    }
+    for (auto &node : registered_nodes_)
+    {
+        zk_client_.Delete(node.first, node.second);
+    }
+    CloseListeners();
+    if (unix_server_)
+    {
+        unix_server_->StopAccepting();
+    }
+    if (shm_server_)
+    {
+        shm_server_->StopAccepting();
+    }
+}
+
+// 关闭本节点在服务端口上的监听socket，已建立的连接不受影响
+void RpcProvider::CloseListeners()
+{
+    if (tcp_server_)
+    {
+        tcp_server_->StopAccepting();
+    }
+    // io_uring的accept请求持有监听socket，由StopAccepting先取消再关闭
+    if (uring_server_)
+    {
+        uring_server_->StopAccepting();
+    }
+    // 各监听循环的服务端只能在自己的线程中操作，循环退出前任务队列中的任务都会执行
+    std::lock_guard<std::mutex> lock(acceptor_mutex_);
+    for (auto &acceptor : acceptors_)
+    {
+        ListenServer *server = acceptor.second;
+        acceptor.first->runInLoop([server]
+                                  { server->StopAccepting(); });
+    }
+}
+
+// 已接纳尚未完成的调用数
+size_t RpcProvider::InflightCalls() const
+{
+    size_t inflight = 0;
+    for (auto &sp : service_map_)
+    {
+        inflight += sp.second.admission_->Inflight();
+    }
+    return inflight;
+}
+
+// 创建并启动监听Unix域套接字的服务端，shm_capacity非0时用于引导共享内存传输，失败时返回空
+std::unique_ptr<ListenServer> RpcProvider::StartUnixServer(const std::string &path, const std::string &name, int threads,
+                                                         const std::vector<int> &cpus, size_t shm_capacity)
+{
+    auto server = std::make_unique<ListenServer>(&event_loop_, path, name);
+    server->SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+    server->SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    server->SetThreadNum(threads);
+    server->SetShmCapacity(shm_capacity);
+    if (!cpus.empty())
+    {
+        auto next = std::make_shared<std::atomic<size_t>>(0);
+        server->SetThreadInitCallback([cpus, next](muduo::net::EventLoop *)
+                                      { PinThread(cpus, next->fetch_add(1)); });
+    }
+    if (!server->Start())
+    {
+        return nullptr;
+    }
+    return server;
+}
+
+// 创建并启动用io_uring接收和读取的TCP服务端，内核不支持或失败时返回空
+std::unique_ptr<UringServer> RpcProvider::StartUringServer(const muduo::net::InetAddress &address, bool reuse_port, int threads,
+                                                           const std::vector<int> &cpus)
+{
+    auto server = std::make_unique<UringServer>(&event_loop_, address, "RpcProvider", reuse_port);
+    server->SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+    server->SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    server->SetThreadNum(threads);
+    if (!cpus.empty())
+    {
+        auto next = std::make_shared<std::atomic<size_t>>(0);
+        server->SetThreadInitCallback([cpus, next](muduo::net::EventLoop *)
+                                      { PinThread(cpus, next->fetch_add(1)); });
+    }
+    if (!server->Start())
+    {
+        return nullptr;
+    }
+    return server;
+}
+
+// 启动num个SO_REUSEPORT监听循环，每个循环在自己的线程中创建、运行和销毁服务端
+void RpcProvider::StartAcceptors(const muduo::net::InetAddress &address, int num, const std::vector<int> &cpus)
+{
+    for (int i = 0; i < num; ++i)
+    {
+        acceptor_threads_.emplace_back([this, address, i, cpus]
+                                       {
+            PinThread(cpus, static_cast<size_t>(i));
+            muduo::net::EventLoop loop;
+            ListenServer server(&loop, address, "RpcProvider-" + std::to_string(i), true);
+            server.SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+            server.SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+            // 不再另开IO线程，接收到的连接就在本循环中处理
+            server.SetThreadNum(0);
+            if (!server.Start())
+            {
+                exit(EXIT_FAILURE);
+            }
+            {
+                std::lock_guard<std::mutex> lock(acceptor_mutex_);
+                acceptors_.emplace_back(&loop, &server);
+            }
+            acceptor_cv_.notify_all();
+            loop.loop(); });
+    }
+    // 等待所有监听循环登记完成，保证退出时能逐个停止
+    std::unique_lock<std::mutex> lock(acceptor_mutex_);
+    acceptor_cv_.wait(lock, [this, num]
+                      { return acceptors_.size() >= static_cast<size_t>(num); });
+}
+
+// 解析逗号分隔的CPU编号列表，忽略非法项
+std::vector<int> RpcProvider::ParseCpuList(const std::string &list)
+{
+    std::vector<int> cpus;
+    size_t start = 0;
+    while (start < list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        std::string item = list.substr(start, end - start);
+        char *tail = nullptr;
+        long cpu = strtol(item.c_str(), &tail, 10);
+        if (!item.empty() && tail != item.c_str() && cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+        start = end + 1;
+    }
+    return cpus;
+}
+
+// 把当前线程绑定到cpus中的第index个CPU(循环取)，cpus为空时不绑定
+void RpcProvider::PinThread(const std::vector<int> &cpus, size_t index)
+{
+    if (cpus.empty())
+    {
+        return;
+    }
+    int cpu = cpus[index % cpus.size()];
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (ret != 0)
+    {
+        LOG_WARN << "pin IO thread to cpu " << cpu << " failed: " << strerror(ret);
+    }
 }
 
 // 连接回调
 void RpcProvider::OnConnection(const muduo::net::TcpConnectionPtr &conn)
 {
-    if (!conn->connected())
+    if (conn->connected())
     {
+        auto ctx = std::make_shared<ConnContext>();
+        // 共享内存引导套接字上的连接，ListenServer预置了共享内存传输
+        bool use_shm = conn->getContext().type() == typeid(std::shared_ptr<ShmTransport>);
+        if (use_shm)
+        {
+            ctx->shm = boost::any_cast<std::shared_ptr<ShmTransport>>(conn->getContext());
+        }
+        conn->setContext(ctx);
+        connection_count_.fetch_add(1, std::memory_order_relaxed);
+        if (use_shm)
+        {
+            StartShm(conn, ctx);
+        }
+    }
+    else
+    {
+        // 唤醒阻塞在该连接的流上的业务线程
+        if (!conn->getContext().empty())
+        {
+            connection_count_.fetch_sub(1, std::memory_order_relaxed);
+            ConnContextPtr ctx = boost::any_cast<ConnContextPtr>(conn->getContext());
+            for (auto &item : ctx->streams)
+            {
+                item.second->Fail(RpcErrorType::NETWORK_ERROR, "connection closed");
+            }
+            ctx->streams.clear();
+            if (ctx->shm)
+            {
+                for (auto *channel : {&ctx->shm_read_channel, &ctx->shm_write_channel})
+                {
+                    (*channel)->disableAll();
+                    (*channel)->remove();
+                    channel->reset();
+                }
+            }
+        }
         conn->shutdown();
     }
 }
 
+// 在连接所属的IO线程中注册共享内存传输的eventfd
+void RpcProvider::StartShm(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx)
+{
+    // 回调只持有弱引用，连接上下文持有Channel，避免循环引用
+    std::weak_ptr<muduo::net::TcpConnection> weak_conn(conn);
+    ctx->shm_read_channel = std::make_unique<muduo::net::Channel>(conn->getLoop(), ctx->shm->ReadableFd());
+    ctx->shm_read_channel->setReadCallback([this, weak_conn](muduo::Timestamp)
+                                           {
+                                               if (auto conn = weak_conn.lock())
+                                               {
+                                                   OnShmReadable(conn, boost::any_cast<ConnContextPtr>(conn->getContext()));
+                                               } });
+    ctx->shm_write_channel = std::make_unique<muduo::net::Channel>(conn->getLoop(), ctx->shm->WritableFd());
+    ctx->shm_write_channel->setReadCallback([this, weak_conn](muduo::Timestamp)
+                                            {
+                                                if (auto conn = weak_conn.lock())
+                                                {
+                                                    OnShmWritable(boost::any_cast<ConnContextPtr>(conn->getContext()));
+                                                } });
+    ctx->shm_read_channel->enableReading();
+    ctx->shm_write_channel->enableReading();
+    // 读一次以登记等待，此后对端写入时才会唤醒
+    OnShmReadable(conn, ctx);
+}
+
+// 对端向字节环写入了数据：读出并按帧处理，与socket上的数据走同一个OnMessage
+void RpcProvider::OnShmReadable(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx)
+{
+    // 每次事件最多读取的轮数和每轮的字节数，对端持续写入时让出IO线程给同一循环中的其他连接
+    static constexpr int kMaxRounds = 16;
+    static constexpr size_t kReadChunk = 64 * 1024;
+    ShmTransport::ClearFd(ctx->shm->ReadableFd());
+    for (int round = 0; round < kMaxRounds; ++round)
+    {
+        if (!conn->connected())
+        {
+            return;
+        }
+        muduo::net::Buffer &input = ctx->shm_input;
+        input.ensureWritableBytes(kReadChunk);
+        size_t n = ctx->shm->Read(input.beginWrite(), input.writableBytes());
+        if (n == 0)
+        {
+            return; // 已登记等待，对端写入后eventfd可读
+        }
+        input.hasWritten(n);
+        OnMessage(conn, &input, muduo::Timestamp::now());
+    }
+    // 未读完且没有登记等待，在本轮事件处理完成后继续
+    conn->getLoop()->queueInLoop([this, conn, ctx]
+                                 { OnShmReadable(conn, ctx); });
+}
+
+// 对端腾出了空间：继续写出暂存的数据
+void RpcProvider::OnShmWritable(const ConnContextPtr &ctx)
+{
+    ShmTransport::ClearFd(ctx->shm->WritableFd());
+    muduo::net::Buffer &output = ctx->shm_output;
+    if (output.readableBytes() > 0)
+    {
+        output.retrieve(ctx->shm->Write(output.peek(), output.readableBytes()));
+    }
+}
+
+// 经由字节环写出数据，环满时暂存，保证顺序
+void RpcProvider::ShmSend(ConnContext &ctx, const char *data, size_t len)
+{
+    // 已有暂存数据时说明环满且已登记等待，新数据排在其后
+    if (ctx.shm_output.readableBytes() == 0)
+    {
+        size_t n = ctx.shm->Write(data, len);
+        data += n;
+        len -= n;
+    }
+    if (len > 0)
+    {
+        ctx.shm_output.append(data, len);
+    }
+}
+
 // 读写事件回调
 void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn,
                             muduo::net::Buffer *buffer,
                             muduo::Timestamp)
 {
-    if (buffer->readableBytes() < 4)
+    ConnContextPtr ctx = boost::any_cast<ConnContextPtr>(conn->getContext());
+    // 循环处理缓冲区中所有完整的帧，不完整的帧留待下次数据到达，v1和v2帧可以在同一连接上混用
+    while (buffer->readableBytes() >= 4)
     {
-        return; // 数据不足，等待后续数据
+        const char *data = buffer->peek();
+        size_t frame_len = 0;
+        bool ok = false;
+        if (IsFrameV2(data, buffer->readableBytes()))
+        {
+            if (buffer->readableBytes() < kFrameHeaderSize)
+            {
+                return; // 数据不足，等待后续数据
+            }
+            FrameHeader header;
+            if (DecodeFrameHeader(data, &header))
+            {
+                frame_len = kFrameHeaderSize + header.meta_len + header.body_len;
+                if (buffer->readableBytes() < frame_len)
+                {
+                    return;
+                }
+                ok = HandleRequestV2(conn, ctx, header, data + kFrameHeaderSize);
+            }
+        }
+        else
+        {
+            uint32_t length = static_cast<uint32_t>(buffer->peekInt32()); // 已转换为本地字节序
+            frame_len = 4 + static_cast<size_t>(length);
+            // 与v2帧使用同样的上限，避免按错误或恶意的长度无限缓存数据
+            if (length <= kMaxFrameBodySize)
+            {
+                if (buffer->readableBytes() < frame_len)
+                {
+                    return; // 数据不足，等待后续数据
+                }
+                ok = HandleRequestV1(conn, ctx, data + 4, length);
+            }
+        }
+        if (!ok)
+        {
+            // 帧无法解析时后续字节流已不可信，写出已完成的响应后断开连接
+            FlushOutput(conn, *ctx);
+            conn->shutdown();
+            buffer->retrieveAll();
+            return;
+        }
+        buffer->retrieve(frame_len);
     }
-    const char *data = buffer->peek();
-    uint32_t network_length = *(reinterpret_cast<const uint32_t *>(data));
-    uint32_t length = ntohl(network_length); // 转换为本地字节序
-    if (buffer->readableBytes() < 4 + length)
+}
+
+// 处理一个完整的v1请求帧：4字节长度 + RpcHeader
+bool RpcProvider::HandleRequestV1(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx,
+                                  const char *data, size_t len)
+{
+    // 请求头、请求和响应都分配在同一个Arena上，响应写回后整体归还
+    auto call = std::make_shared<CallContext>();
+    call->arena = ArenaPool::ThreadLocal().Acquire();
+    auto *rpc_header = google::protobuf::Arena::CreateMessage<TheChat::RpcHeader>(&call->arena->arena);
+    // 请求参数不拷贝，直接从接收缓冲区中解析
+    const char *params = nullptr;
+    size_t params_len = 0;
+    if (!ParseInPlace(data, len, TheChat::RpcHeader::kParamsFieldNumber, rpc_header, &params, &params_len))
     {
-        return; // 数据不足，等待后续数据
+        LOG_ERROR << "RPC header parse error!";
+        return false;
     }
+    call->conn = conn;
+    call->protocol = kProtocolV1;
+    call->request_id = rpc_header->request_id();
+    // 多路复用请求必然是长连接，请求方声明复用连接或方法在长连接列表中时，写回响应后保持连接
+    call->framed = rpc_header->keep_alive() || call->request_id != 0;
+    call->keep_alive = call->framed || keep_alive_method_set_.count(rpc_header->method_name()) > 0;
+    // 请求方支持v2时在响应中告知，请求方后续改用v2帧
+    call->offer_v2 = call->request_id != 0 && rpc_header->max_protocol() >= kProtocolV2;
+    call->deadline = ToDeadline(rpc_header->timeout_ms());
+    call->priority = ToPriority(rpc_header->priority());
+    NegotiateCompression(ctx, call, rpc_header->compression());
+    return DispatchByName(ctx, call, rpc_header->service_name(), rpc_header->method_name(), params, params_len);
+}
 
-    buffer->retrieve(4);
-    std::string recv_buf = buffer->retrieveAllAsString();
+// 处理一个完整的v2请求帧：固定帧头 + RpcMeta + 请求体
+bool RpcProvider::HandleRequestV2(const muduo::net::TcpConnectionPtr &conn, const ConnContextPtr &ctx,
+                                  const FrameHeader &header, const char *data)
+{
+    // 已建立的流的后续帧直接交给流，不创建调用上下文
+    if ((header.flags & kFlagStream) && !(header.flags & kFlagStreamOpen))
+    {
+        auto it = ctx->streams.find(header.request_id);
+        if (it == ctx->streams.end())
+        {
+            return true; // 流已结束，丢弃迟到的帧
+        }
+        std::string storage;
+        const char *body = nullptr;
+        size_t body_len = 0;
+        if (!DecodeFrameBody(header, data + header.meta_len, &storage, &body, &body_len))
+        {
+            LOG_ERROR << "stream frame decompress error!";
+            return false;
+        }
+        return it->second->OnFrame(header.flags, data, header.meta_len, body, body_len);
+    }
+    auto call = std::make_shared<CallContext>();
+    call->arena = ArenaPool::ThreadLocal().Acquire();
+    auto *meta = google::protobuf::Arena::CreateMessage<TheChat::RpcMeta>(&call->arena->arena);
+    if (!meta->ParseFromArray(data, static_cast<int>(header.meta_len)))
+    {
+        LOG_ERROR << "RPC meta parse error!";
+        return false;
+    }
+    call->conn = conn;
+    call->protocol = kProtocolV2;
+    call->request_id = header.request_id;
+    call->framed = true;
+    call->keep_alive = true;
+    call->deadline = ToDeadline(meta->timeout_ms());
+    call->priority = ToPriority(meta->priority());
+    NegotiateCompression(ctx, call, meta->compression());
+    if ((header.flags & kFlagStreamOpen) && !OpenStream(ctx, call, header.flags))
+    {
+        return false;
+    }
+    // 压缩的请求体解压到storage，Dispatch返回前一直有效
+    std::string storage;
+    const char *params = nullptr;
+    size_t params_len = 0;
+    if (!DecodeFrameBody(header, data + header.meta_len, &storage, &params, &params_len))
+    {
+        LOG_ERROR << "request decompress error!";
+        return RejectCall(call, RpcErrorType::PROTOCOL_ERROR, "request decompress error");
+    }
+    // 带方法id的请求一次查表即可分发，不带id或id未知时退回按名字分发
+    if (const MethodEntry *entry = FindMethod(header.method_id))
+    {
+        return Dispatch(ctx, call, *entry, params, params_len);
+    }
+    if (meta->service_name().empty())
+    {
+        LOG_ERROR << "method id " << header.method_id << " is not exist!";
+        return RejectCall(call, RpcErrorType::SERVICE_UNAVAILABLE,
+                          "method id " + std::to_string(header.method_id) + " is not exist");
+    }
+    return DispatchByName(ctx, call, meta->service_name(), meta->method_name(), params, params_len);
+}
 
-    TheChat::RpcHeader rpc_header;
-    if (!rpc_header.ParseFromString(recv_buf))
+// 请求方提出压缩且本节点支持相同算法时，在连接上启用并在响应中告知
+void RpcProvider::NegotiateCompression(const ConnContextPtr &ctx, const CallContextPtr &call, uint32_t compression)
+{
+    if (compression != 0 && compression_ != CompressionType::NONE &&
+        compression == static_cast<uint32_t>(compression_))
     {
-        LOG_ERROR << "RPC header parse error!";
-        return;
+        ctx->compression = compression_;
+        call->ack_compression = true;
     }
-    std::string service_name = rpc_header.service_name();
-    std::string method_name = rpc_header.method_name();
-    std::string params = rpc_header.params();
+    call->compression = ctx->compression;
+}
+
+// 流式调用的首帧：建立流并登记到连接上下文，流id为0或已被占用时返回false断开连接
+bool RpcProvider::OpenStream(const ConnContextPtr &ctx, const CallContextPtr &call, uint8_t flags)
+{
+    const uint64_t stream_id = call->request_id;
+    if (stream_id == 0 || ctx->streams.count(stream_id) > 0)
+    {
+        LOG_ERROR << "invalid stream id " << stream_id;
+        return false;
+    }
+    std::weak_ptr<muduo::net::TcpConnection> weak_conn(call->conn);
+    muduo::net::EventLoop *loop = call->conn->getLoop();
+    const CompressionType compression = call->compression;
+    call->stream = std::make_shared<RpcStream>(
+        [this, weak_conn, loop, stream_id, compression](uint8_t stream_flags, const TheChat::RpcMeta *meta, const char *body, size_t body_len)
+        {
+            if (weak_conn.expired())
+            {
+                return false;
+            }
+            FrameHeader header;
+            header.flags = kFlagResponse | kFlagStream | stream_flags;
+            header.request_id = stream_id;
+            std::string frame;
+            if (!AppendFrame(header, meta, body, body_len, compression, compress_threshold_, &frame))
+            {
+                return false;
+            }
+            // 业务线程写出的消息转到IO线程，与最终响应经过同一个队列，保证先于结束帧写出
+            loop->runInLoop([this, weak_conn, frame = std::move(frame)]
+                            {
+                                if (muduo::net::TcpConnectionPtr conn = weak_conn.lock())
+                                {
+                                    QueueSend(conn, frame);
+                                } });
+            return true;
+        },
+        call->deadline);
+    // 只有一个请求消息的流，首帧即带结束标志
+    if (flags & kFlagStreamEnd)
+    {
+        call->stream->OnFrame(kFlagStreamEnd, nullptr, 0, nullptr, 0);
+    }
+    ctx->streams.emplace(stream_id, call->stream);
+    call->controller.SetStream(call->stream);
+    return true;
+}
 
+// 按名字查找服务方法，找不到时拒绝调用
+bool RpcProvider::DispatchByName(const ConnContextPtr &ctx, const CallContextPtr &call,
+                                 const std::string &service_name, const std::string &method_name,
+                                 const char *params, size_t params_len)
+{
     auto sit = service_map_.find(service_name);
     if (sit == service_map_.end())
     {
         LOG_ERROR << service_name << " is not exist!";
-        return;
+        // 多路复用请求可以单独返回错误，不影响同一连接上的其他调用
+        return RejectCall(call, RpcErrorType::SERVICE_UNAVAILABLE, service_name + " is not exist");
     }
     auto mit = sit->second.method_map_.find(method_name);
     if (mit == sit->second.method_map_.end())
     {
         LOG_ERROR << service_name << ":" << method_name << " is not exist!";
-        return;
+        return RejectCall(call, RpcErrorType::SERVICE_UNAVAILABLE, service_name + ":" + method_name + " is not exist");
+    }
+    return Dispatch(ctx, call, method_table_[mit->second.table_index_], params, params_len);
+}
+
+// 准入检查后解析请求并交给业务线程执行
+bool RpcProvider::Dispatch(const ConnContextPtr &ctx, const CallContextPtr &call, const MethodEntry &entry,
+                           const char *params, size_t params_len)
+{
+    google::protobuf::Service *service = entry.service;
+    const google::protobuf::MethodDescriptor *method = entry.method;
+    // 摘流量期间不再接纳新调用，客户端收到SERVICE_UNAVAILABLE后重新做服务发现
+    if (draining_.load(std::memory_order_relaxed))
+    {
+        return RejectCall(call, RpcErrorType::SERVICE_UNAVAILABLE, "server is draining");
+    }
+    call->receive_time = TheRpcController::Clock::now();
+    // 调用方已经放弃的请求不再解析和执行
+    if (call->receive_time >= call->deadline)
+    {
+        return RejectCall(call, RpcErrorType::DEADLINE_EXCEEDED, "deadline exceeded before dispatch");
+    }
+    // 流式调用的响应是增量写出的，不参与缓存和合并执行
+    const bool cacheable = entry.cache_ttl_ms != 0 && response_cache_ && !call->stream;
+    const bool single_flight = entry.single_flight && !call->stream;
+    if (cacheable || single_flight)
+    {
+        std::string_view params_view(params, params_len);
+        uint64_t hash = ResponseCache::Hash(params_view);
+        // 可缓存方法命中时直接写回缓存的响应，跳过请求解析、方法执行和响应序列化
+        if (cacheable)
+        {
+            if (ResponseCache::ResponsePtr cached = response_cache_->Get(entry.id, hash, params_view))
+            {
+                if (call->request_id == 0)
+                {
+                    call->seq = ctx->next_seq++;
+                }
+                SendSerializedResponse(call, *cached);
+                return true;
+            }
+            call->cache_ttl_ms = entry.cache_ttl_ms;
+        }
+        call->key_method_id = entry.id;
+        call->key_hash = hash;
+        call->key_params.assign(params, params_len);
+    }
+    // 相同的请求正在执行时，等待其结果而不再执行一次
+    if (single_flight)
+    {
+        FlightKey key{call->key_method_id, call->key_hash, call->key_params};
+        std::lock_guard<std::mutex> lock(flight_mutex_);
+        auto it = flights_.find(key);
+        if (it != flights_.end())
+        {
+            if (call->request_id == 0)
+            {
+                call->seq = ctx->next_seq++;
+            }
+            it->second.push_back(call);
+            coalesced_count_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        flights_.emplace(std::move(key), std::vector<CallContextPtr>());
+        call->flight_leader = true;
+    }
+    // 过载时在解析请求之前拒绝，代价只有一个错误响应
+    if (!entry.admission->TryAdmit())
+    {
+        return RejectCall(call, RpcErrorType::RESOURCE_EXHAUSTED, method->service()->name() + " is overloaded");
+    }
+    call->admission = entry.admission;
+    // 方法级并发上限，超过时快速失败，不占用业务线程
+    if (entry.method_admission)
+    {
+        if (!entry.method_admission->TryAdmit())
+        {
+            return RejectCall(call, RpcErrorType::RESOURCE_EXHAUSTED, method->full_name() + " is overloaded");
+        }
+        call->method_admission = entry.method_admission;
     }
-    google::protobuf::Service *service = sit->second.service_;
-    const google::protobuf::MethodDescriptor *method = mit->second;
+    google::protobuf::Arena *arena = &call->arena->arena;
+    call->controller.SetConnection(call->conn);
+    call->controller.SetDeadline(call->deadline);
+    call->controller.SetPriority(call->priority);
 
     // 生成RPC方法调用的请求和响应参数
-    google::protobuf::Message *request = service->GetRequestPrototype(method).New();
-    if (!request->ParseFromString(params))
+    call->request = service->GetRequestPrototype(method).New(arena);
+    if (!call->request->ParseFromArray(params, static_cast<int>(params_len)))
     {
         LOG_ERROR << "request parse error!";
+        return RejectCall(call, RpcErrorType::PROTOCOL_ERROR, "request parse error");
+    }
+    call->response = service->GetResponsePrototype(method).New(arena);
+    call->request_bytes = params_len;
+    // 只有按序写回的请求占用序号，多路复用请求不会阻塞其他响应
+    if (call->request_id == 0)
+    {
+        call->seq = ctx->next_seq++;
+    }
+
+    // 给RPC方法参数准备Closure的回调，业务线程中完成的调用由它转回连接所属的IO线程写回响应
+    google::protobuf::Closure *done = new RpcClosure(call->conn->getLoop(),
+                                                     [this, call]
+                                                     { SendRpcResponse(call); });
+    // 调用上下文只由done持有，保证最后一个引用在IO线程释放，Arena归还到IO线程的池中
+    CallContext *raw_call = call.get();
+    MethodMetrics *metrics = entry.metrics;
+    auto task = [service, method, raw_call, done, metrics]
+    {
+        raw_call->start_time = TheRpcController::Clock::now();
+        raw_call->admission->OnStart(raw_call->start_time - raw_call->receive_time);
+        raw_call->metrics = metrics;
+        metrics->OnStart(raw_call->request_bytes);
+        // 在队列中等待期间截止时间已过，跳过执行
+        if (raw_call->start_time >= raw_call->deadline)
+        {
+            raw_call->error = RpcErrorType::DEADLINE_EXCEEDED;
+            raw_call->controller.SetFailed("deadline exceeded in worker queue");
+            done->Run();
+            return;
+        }
+        // RPC方法内发起的嵌套调用继承剩余时间
+        TheRpcController::DeadlineScope deadline_scope(raw_call->deadline);
+        // 方法内的协程挂起后无法提交回线程池时，回到连接所属的IO线程恢复
+        TheRpcController::LoopScope loop_scope(raw_call->conn->getLoop());
+        service->CallMethod(method, &raw_call->controller, raw_call->request, raw_call->response, done);
+    };
+    // 配置了隔舱的方法在独占线程池中执行，不与其他方法争抢共享线程池
+    WorkerPool *worker_pool = entry.worker_pool ? entry.worker_pool : worker_pool_.get();
+    if (!worker_pool)
+    {
+        // 流的读写会阻塞，不能在IO线程中执行
+        if (call->stream)
+        {
+            delete done;
+            return RejectCall(call, RpcErrorType::SERVICE_UNAVAILABLE, "streaming requires worker threads");
+        }
+        task();
+        return true;
+    }
+    // 解析请求期间可能已经超时，入队前再检查一次
+    if (TheRpcController::Clock::now() >= call->deadline)
+    {
+        delete done;
+        return RejectCall(call, RpcErrorType::DEADLINE_EXCEEDED, "deadline exceeded before queueing");
+    }
+    // 高优先级请求在业务线程池中先于普通和低优先级请求执行
+    if (!worker_pool->Submit(std::move(task), ToQueueLevel(call->priority)))
+    {
+        delete done;
+        LOG_WARN << "worker queue is full, reject " << method->full_name();
+        // 按序写回的请求无法跳过，只能断开连接
+        return RejectCall(call, RpcErrorType::RESOURCE_EXHAUSTED, "worker queue is full");
+    }
+    return true;
+}
+
+// 定期输出响应缓存、合并执行、各服务的准入统计、业务线程池各优先级的队列深度和各方法的调用统计
+void RpcProvider::ReportStats()
+{
+    if (response_cache_)
+    {
+        LOG_INFO << "response cache: hits=" << response_cache_->HitCount() << " misses=" << response_cache_->MissCount()
+                 << " bytes=" << response_cache_->Bytes();
+    }
+    const Compression::Stats &compression = Compression::GetStats();
+    if (uint64_t raw = compression.raw_bytes.load(std::memory_order_relaxed))
+    {
+        LOG_INFO << "compression: raw=" << raw
+                 << " compressed=" << compression.compressed_bytes.load(std::memory_order_relaxed)
+                 << " uncompressed=" << compression.uncompressed_bytes.load(std::memory_order_relaxed)
+                 << " decompressed=" << compression.decompressed_bytes.load(std::memory_order_relaxed);
+    }
+    if (uint64_t coalesced = coalesced_count_.load(std::memory_order_relaxed))
+    {
+        LOG_INFO << "single flight: coalesced=" << coalesced;
+    }
+    if (worker_pool_ && worker_pool_->QueueSize() != 0)
+    {
+        LOG_INFO << "worker queue depth: high=" << worker_pool_->QueueSize(ToQueueLevel(RpcPriority::HIGH))
+                 << " normal=" << worker_pool_->QueueSize(ToQueueLevel(RpcPriority::NORMAL))
+                 << " low=" << worker_pool_->QueueSize(ToQueueLevel(RpcPriority::LOW));
+    }
+    for (auto &sp : service_map_)
+    {
+        const AdmissionController &admission = *sp.second.admission_;
+        if (admission.ShedCount() != 0)
+        {
+            LOG_INFO << "admission " << sp.first << ": admitted=" << admission.AdmittedCount()
+                     << " shed=" << admission.ShedCount() << " inflight=" << admission.Inflight()
+                     << " dropping=" << admission.Dropping();
+        }
+        for (auto &mp : sp.second.method_map_)
+        {
+            const AdmissionController *method_admission = mp.second.admission_.get();
+            if (method_admission && method_admission->ShedCount() != 0)
+            {
+                LOG_INFO << "admission " << sp.first << "." << mp.first << ": admitted=" << method_admission->AdmittedCount()
+                         << " shed=" << method_admission->ShedCount() << " inflight=" << method_admission->Inflight();
+            }
+            // 只输出上个周期有调用完成的方法，计数均为累计值，时延单位微秒
+            MethodMetrics::Snapshot metrics = mp.second.metrics_->Collect();
+            if (metrics.requests != mp.second.reported_requests_)
+            {
+                mp.second.reported_requests_ = metrics.requests;
+                LOG_INFO << "method " << sp.first << "." << mp.first << ": requests=" << metrics.requests
+                         << " errors=" << metrics.errors << " inflight=" << metrics.inflight
+                         << " p50=" << metrics.Percentile(0.5) << " p99=" << metrics.Percentile(0.99)
+                         << " p999=" << metrics.Percentile(0.999) << " max=" << metrics.latency_max_us
+                         << " request_bytes=" << metrics.request_bytes << " response_bytes=" << metrics.response_bytes;
+            }
+        }
+    }
+}
+
+// 收集方法调用统计和节点的连接数、并发数、队列深度等指标，可在任意线程调用，不阻塞业务路径
+void RpcProvider::CollectStats(TheChat::StatsResponse *response) const
+{
+    for (const auto &item : MetricsSnapshot())
+    {
+        RpcAdminService::FillMethodStats(item.first, item.second, response->add_methods());
+    }
+    RpcAdminService::AddMetric(response, "rpc_connections", static_cast<double>(connection_count_.load(std::memory_order_relaxed)), false);
+    RpcAdminService::AddMetric(response, "rpc_draining", draining_.load(std::memory_order_relaxed) ? 1 : 0, false);
+    for (const auto &sp : service_map_)
+    {
+        const AdmissionController &admission = *sp.second.admission_;
+        RpcAdminService::AddMetric(response, "rpc_admission_inflight", admission.Inflight(), false, {{"service", sp.first}});
+        RpcAdminService::AddMetric(response, "rpc_admission_admitted_total", static_cast<double>(admission.AdmittedCount()),
+                                   true, {{"service", sp.first}});
+        RpcAdminService::AddMetric(response, "rpc_admission_shed_total", static_cast<double>(admission.ShedCount()),
+                                   true, {{"service", sp.first}});
+        RpcAdminService::AddMetric(response, "rpc_admission_dropping", admission.Dropping() ? 1 : 0, false,
+                                   {{"service", sp.first}});
+    }
+    if (worker_pool_)
+    {
+        // 按RpcPriority的取值排列
+        static const char *const kPriorityNames[] = {"normal", "high", "low"};
+        for (RpcPriority priority : {RpcPriority::HIGH, RpcPriority::NORMAL, RpcPriority::LOW})
+        {
+            RpcAdminService::AddMetric(response, "rpc_worker_queue_depth",
+                                       static_cast<double>(worker_pool_->QueueSize(ToQueueLevel(priority))), false,
+                                       {{"priority", kPriorityNames[static_cast<int>(priority)]}});
+        }
+    }
+    if (response_cache_)
+    {
+        RpcAdminService::AddMetric(response, "rpc_response_cache_hits_total", static_cast<double>(response_cache_->HitCount()), true);
+        RpcAdminService::AddMetric(response, "rpc_response_cache_misses_total", static_cast<double>(response_cache_->MissCount()), true);
+        RpcAdminService::AddMetric(response, "rpc_response_cache_bytes", static_cast<double>(response_cache_->Bytes()), false);
+    }
+    RpcAdminService::AddMetric(response, "rpc_single_flight_coalesced_total",
+                               static_cast<double>(coalesced_count_.load(std::memory_order_relaxed)), true);
+    const Compression::Stats &compression = Compression::GetStats();
+    RpcAdminService::AddMetric(response, "rpc_compression_raw_bytes_total",
+                               static_cast<double>(compression.raw_bytes.load(std::memory_order_relaxed)), true);
+    RpcAdminService::AddMetric(response, "rpc_compression_compressed_bytes_total",
+                               static_cast<double>(compression.compressed_bytes.load(std::memory_order_relaxed)), true);
+}
+
+// 定期采样负载，与上次发布的相比变化明显且距上次发布超过load_publish_interval_时改写实例节点
+void RpcProvider::RefreshLoad()
+{
+    // 摘流量时实例节点已删除
+    if (draining_.load(std::memory_order_relaxed))
+    {
         return;
     }
-    // service->GetDescriptor()->name();
-    google::protobuf::Message *response = service->GetResponsePrototype(method).New();
+    const auto now = std::chrono::steady_clock::now();
+    TheChat::ServiceEndpoint load;
+    load.set_inflight(static_cast<uint32_t>(InflightCalls()));
+    // 进程CPU时间的增量占整机CPU时间的千分比
+    const std::chrono::nanoseconds cpu_time = ProcessCpuTime();
+    const double elapsed = std::chrono::duration<double, std::nano>(now - cpu_sample_time_).count();
+    const unsigned cpus = std::max(std::thread::hardware_concurrency(), 1u);
+    if (elapsed > 0)
+    {
+        const double busy = static_cast<double>((cpu_time - cpu_time_sample_).count());
+        load.set_cpu_permille(static_cast<uint32_t>(std::min(busy / (elapsed * cpus), 1.0) * 1000));
+    }
+    cpu_time_sample_ = cpu_time;
+    cpu_sample_time_ = now;
+    // 上次采样以来各服务中最大的平均排队时延，空闲时为0
+    AdmissionController::Clock::duration queue_delay{0};
+    for (const auto &sp : service_map_)
+    {
+        queue_delay = std::max(queue_delay, sp.second.admission_->TakeQueueDelay());
+    }
+    load.set_queue_delay_us(static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(queue_delay).count()));
 
-    // 给RPC方法参数准备Closure的回调
-    google::protobuf::Closure *done = google::protobuf::NewCallback<RpcProvider,
-                                                                    const muduo::net::TcpConnectionPtr &,
-                                                                    google::protobuf::Message *>(this,
-                                                                                                 &RpcProvider::SendRpcResponse,
-                                                                                                 conn, response);
-    service->CallMethod(method, nullptr, request, response, done);
+    if (now - load_published_time_ < load_publish_interval_ || !LoadChanged(published_load_, load))
+    {
+        return;
+    }
+    published_load_ = load;
+    load_published_time_ = now;
+    std::lock_guard<std::mutex> lock(instance_mutex_);
+    for (auto &node : instance_nodes_)
+    {
+        node.second.set_inflight(load.inflight());
+        node.second.set_cpu_permille(load.cpu_permille());
+        node.second.set_queue_delay_us(load.queue_delay_us());
+        zk_client_.SetDataAsync(node.first, node.second.SerializeAsString());
+    }
+}
+
+// 会话重新建立后按最近发布的值重新创建实例节点，在ZooKeeper客户端的后台线程中调用，摘流量时跳过
+void RpcProvider::RegisterInstances()
+{
+    std::vector<std::pair<std::string, std::string>> nodes;
+    {
+        std::lock_guard<std::mutex> lock(instance_mutex_);
+        for (const auto &node : instance_nodes_)
+        {
+            nodes.emplace_back(node.first, node.second.SerializeAsString());
+        }
+    }
+    for (const auto &node : nodes)
+    {
+        if (draining_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        zk_client_.CreateEphemeral(node.first, node.second);
+    }
+}
+
+// 负载是否有明显变化：任一项相差超过20%且超过该项的绝对阈值
+bool RpcProvider::LoadChanged(const TheChat::ServiceEndpoint &last, const TheChat::ServiceEndpoint &current)
+{
+    auto differs = [](uint32_t a, uint32_t b, uint32_t threshold)
+    {
+        const uint32_t diff = a > b ? a - b : b - a;
+        return diff > std::max(threshold, std::max(a, b) / 5);
+    };
+    return differs(last.inflight(), current.inflight(), 2) ||
+           differs(last.cpu_permille(), current.cpu_permille(), 50) ||
+           differs(last.queue_delay_us(), current.queue_delay_us(), 1000);
+}
+
+// 本进程累计占用的CPU时间
+std::chrono::nanoseconds RpcProvider::ProcessCpuTime()
+{
+    timespec ts;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+    {
+        return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+// 各方法("Service.Method")的调用统计快照，可在任意线程调用，NotifyService之后方法集合不再变化
+std::vector<std::pair<std::string, MethodMetrics::Snapshot>> RpcProvider::MetricsSnapshot() const
+{
+    std::vector<std::pair<std::string, MethodMetrics::Snapshot>> snapshots;
+    for (const auto &sp : service_map_)
+    {
+        for (const auto &mp : sp.second.method_map_)
+        {
+            snapshots.emplace_back(sp.first + "." + mp.first, mp.second.metrics_->Collect());
+        }
+    }
+    return snapshots;
+}
+
+// 由请求中的优先级取值换算业务线程池的队列级别
+size_t RpcProvider::ToQueueLevel(RpcPriority priority)
+{
+    switch (priority)
+    {
+    case RpcPriority::HIGH:
+        return 0;
+    case RpcPriority::LOW:
+        return 2;
+    default:
+        return WorkerPool::kDefaultPriority;
+    }
+}
+
+// 由请求中的优先级取值得到RpcPriority，未知取值按NORMAL处理
+RpcPriority RpcProvider::ToPriority(uint32_t priority)
+{
+    return priority <= static_cast<uint32_t>(RpcPriority::LOW) ? static_cast<RpcPriority>(priority) : RpcPriority::NORMAL;
+}
+
+// 由请求中的相对超时时间换算本地截止时间
+TheRpcController::Clock::time_point RpcProvider::ToDeadline(uint32_t timeout_ms)
+{
+    if (timeout_ms == 0)
+    {
+        return TheRpcController::Clock::time_point::max();
+    }
+    return TheRpcController::Clock::now() + std::chrono::milliseconds(timeout_ms);
+}
+
+// 拒绝一次调用：多路复用请求写回错误响应，按序写回的请求无法跳过，返回false断开连接
+bool RpcProvider::RejectCall(const CallContextPtr &call, RpcErrorType type, const std::string &error_text)
+{
+    if (call->flight_leader)
+    {
+        FinishFlight(call, nullptr, type, error_text);
+    }
+    if (call->request_id == 0)
+    {
+        return false;
+    }
+    SendErrorResponse(call, type, error_text);
+    return true;
 }
 
 // Closure的回调操作，用于序列化响应和网络发送
+void RpcProvider::SendRpcResponse(const CallContextPtr &call)
+{
+    const muduo::net::TcpConnectionPtr &conn = call->conn;
+    // 时延从业务线程开始执行到IO线程写回响应，不含在业务线程池中排队的时间
+    if (call->metrics)
+    {
+        const bool failed = call->controller.Failed();
+        call->metrics->OnFinish(TheRpcController::Clock::now() - call->start_time,
+                                failed ? 0 : call->response->ByteSizeLong(), failed);
+        call->metrics = nullptr;
+    }
+    if (call->cache_ttl_ms != 0 || call->flight_leader)
+    {
+        // 可缓存和合并执行的方法，响应序列化一次，同时用于写回、写入缓存和分发给等待的调用
+        std::shared_ptr<std::string> response;
+        if (!call->controller.Failed())
+        {
+            response = std::make_shared<std::string>();
+            if (!call->response->SerializeToString(response.get()))
+            {
+                response.reset();
+            }
+        }
+        if (call->flight_leader)
+        {
+            if (response)
+            {
+                FinishFlight(call, response, RpcErrorType::SUCCESS, "");
+            }
+            else if (call->controller.Failed())
+            {
+                FinishFlight(call, nullptr, call->error != RpcErrorType::SUCCESS ? call->error : RpcErrorType::BUSINESS_ERROR,
+                             call->controller.ErrorText());
+            }
+            else
+            {
+                FinishFlight(call, nullptr, RpcErrorType::SYSTEM_ERROR, "serialize response error");
+            }
+        }
+        if (response)
+        {
+            SendSerializedResponse(call, *response);
+            if (call->cache_ttl_ms != 0)
+            {
+                response_cache_->Put(call->key_method_id, call->key_hash, std::move(call->key_params),
+                                     std::move(response), std::chrono::milliseconds(call->cache_ttl_ms));
+            }
+            return;
+        }
+    }
+    if (call->protocol == kProtocolV2)
+    {
+        // 响应体只序列化一次，直接写在固定帧头之后；业务失败时只带错误扩展头
+        TheChat::RpcMeta *meta = nullptr;
+        if (call->controller.Failed() || call->ack_compression)
+        {
+            meta = google::protobuf::Arena::CreateMessage<TheChat::RpcMeta>(&call->arena->arena);
+            meta->set_compression(call->ack_compression ? static_cast<uint32_t>(call->compression) : 0);
+        }
+        if (call->controller.Failed())
+        {
+            RpcErrorType type = call->error != RpcErrorType::SUCCESS ? call->error : RpcErrorType::BUSINESS_ERROR;
+            meta->set_error_code(static_cast<int32_t>(type));
+            meta->set_error_text(call->controller.ErrorText());
+        }
+        FrameHeader header;
+        header.flags = kFlagResponse;
+        header.request_id = call->request_id;
+        if (call->stream)
+        {
+            // 流式调用的最终响应即流的结束帧
+            header.flags |= kFlagStream | kFlagStreamEnd;
+            EndStream(call);
+        }
+        std::string response_str;
+        if (!AppendFrame(header, meta, call->controller.Failed() ? nullptr : call->response,
+                         call->compression, compress_threshold_, &response_str))
+        {
+            LOG_ERROR << "serialize response_str error!";
+            SendErrorResponse(call, RpcErrorType::SYSTEM_ERROR, "serialize response error");
+            return;
+        }
+        if (call->request_id == 0)
+        {
+            WriteInOrder(conn, call->seq, std::move(response_str), true);
+        }
+        else
+        {
+            QueueSend(conn, response_str);
+        }
+        return;
+    }
+    if (call->controller.Failed() && call->request_id != 0)
+    {
+        SendErrorResponse(call, call->error != RpcErrorType::SUCCESS ? call->error : RpcErrorType::BUSINESS_ERROR,
+                          call->controller.ErrorText());
+        return;
+    }
+    if (call->request_id != 0)
+    {
+        // 多路复用请求，响应带RpcResponseHeader立即写回，不等待先到的请求
+        auto *response_header = google::protobuf::Arena::CreateMessage<TheChat::RpcResponseHeader>(&call->arena->arena);
+        if (!call->response->SerializeToString(response_header->mutable_response()))
+        {
+            LOG_ERROR << "serialize response_str error!";
+            SendErrorResponse(call, RpcErrorType::SYSTEM_ERROR, "serialize response error");
+            return;
+        }
+        SendResponseHeader(call, response_header);
+        return;
+    }
 
-void RpcProvider::SendRpcResponse(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message *response)
+    std::string response_str;
+    if (call->framed)
+    {
+        // 长连接上响应带4字节长度头，调用方据此切分响应
+        response_str.resize(4);
+    }
+    if (!call->response->AppendToString(&response_str)) // response进行序列化
+    {
+        LOG_ERROR << "serialize response_str error!";
+        // 序列化失败时无法保持响应顺序，断开连接
+        FlushOutput(conn, *boost::any_cast<ConnContextPtr>(conn->getContext()));
+        conn->shutdown();
+        return;
+    }
+    if (call->framed)
+    {
+        uint32_t network_length = htonl(static_cast<uint32_t>(response_str.size() - 4));
+        memcpy(&response_str[0], &network_length, 4);
+    }
+    WriteInOrder(conn, call->seq, std::move(response_str), call->keep_alive);
+}
+
+// 合并执行完成，把结果分发给等待的调用，response为空时分发错误
+void RpcProvider::FinishFlight(const CallContextPtr &call, const std::shared_ptr<const std::string> &response,
+                               RpcErrorType type, const std::string &error_text)
+{
+    call->flight_leader = false;
+    std::vector<CallContextPtr> waiters;
+    {
+        std::lock_guard<std::mutex> lock(flight_mutex_);
+        auto it = flights_.find(FlightKey{call->key_method_id, call->key_hash, call->key_params});
+        if (it == flights_.end())
+        {
+            return;
+        }
+        waiters.swap(it->second);
+        flights_.erase(it);
+    }
+    // 等待的调用可能属于其他IO线程，在各自连接所属的线程中写回
+    for (auto &waiter : waiters)
+    {
+        waiter->conn->getLoop()->runInLoop([this, waiter, response, type, error_text]
+                                           {
+            if (response)
+            {
+                SendSerializedResponse(waiter, *response);
+            }
+            else if (waiter->request_id != 0)
+            {
+                SendErrorResponse(waiter, type, error_text);
+            }
+            else
+            {
+                // 按序写回的请求无法单独返回错误，与RejectCall一致断开连接
+                FlushOutput(waiter->conn, *boost::any_cast<ConnContextPtr>(waiter->conn->getContext()));
+                waiter->conn->shutdown();
+            } });
+    }
+}
+
+// 写回已经序列化好的响应，用于缓存命中、写入缓存和合并执行的调用
+void RpcProvider::SendSerializedResponse(const CallContextPtr &call, const std::string &response)
 {
+    const muduo::net::TcpConnectionPtr &conn = call->conn;
+    if (call->protocol == kProtocolV2)
+    {
+        FrameHeader header;
+        header.flags = kFlagResponse;
+        header.request_id = call->request_id;
+        TheChat::RpcMeta *meta = nullptr;
+        if (call->ack_compression)
+        {
+            meta = google::protobuf::Arena::CreateMessage<TheChat::RpcMeta>(&call->arena->arena);
+            meta->set_compression(static_cast<uint32_t>(call->compression));
+        }
+        std::string response_str;
+        if (!AppendFrame(header, meta, response.data(), response.size(), call->compression, compress_threshold_,
+                         &response_str))
+        {
+            SendErrorResponse(call, RpcErrorType::SYSTEM_ERROR, "response too large");
+            return;
+        }
+        if (call->request_id == 0)
+        {
+            WriteInOrder(conn, call->seq, std::move(response_str), true);
+        }
+        else
+        {
+            QueueSend(conn, response_str);
+        }
+        return;
+    }
+    if (call->request_id != 0)
+    {
+        auto *response_header = google::protobuf::Arena::CreateMessage<TheChat::RpcResponseHeader>(&call->arena->arena);
+        response_header->set_response(response);
+        SendResponseHeader(call, response_header);
+        return;
+    }
     std::string response_str;
-    if (response->SerializeToString(&response_str)) // response进行序列化
+    if (call->framed)
     {
-        // 序列化成功后，通过网络把rpc方法执行的结果发送会rpc的调用方
-        conn->send(response_str);
+        uint32_t network_length = htonl(static_cast<uint32_t>(response.size()));
+        response_str.assign(reinterpret_cast<const char *>(&network_length), 4);
+    }
+    response_str.append(response);
+    WriteInOrder(conn, call->seq, std::move(response_str), call->keep_alive);
+}
+
+// 向多路复用请求或v2请求写回错误响应
+void RpcProvider::SendErrorResponse(const CallContextPtr &call, RpcErrorType type, const std::string &error_text)
+{
+    google::protobuf::Arena *arena = &call->arena->arena;
+    if (call->protocol == kProtocolV2)
+    {
+        auto *meta = google::protobuf::Arena::CreateMessage<TheChat::RpcMeta>(arena);
+        meta->set_error_code(static_cast<int32_t>(type));
+        meta->set_error_text(error_text);
+        if (call->ack_compression)
+        {
+            meta->set_compression(static_cast<uint32_t>(call->compression));
+        }
+        FrameHeader header;
+        header.flags = kFlagResponse;
+        header.request_id = call->request_id;
+        if (call->stream)
+        {
+            header.flags |= kFlagStream | kFlagStreamEnd;
+            EndStream(call);
+        }
+        std::string response_str;
+        AppendFrame(header, meta, nullptr, &response_str);
+        // 按序写回的v2请求已占用序号，错误响应也必须按序写回，否则后续响应一直等待
+        if (call->request_id == 0)
+        {
+            WriteInOrder(call->conn, call->seq, std::move(response_str), true);
+        }
+        else
+        {
+            QueueSend(call->conn, response_str);
+        }
+        return;
+    }
+    auto *response_header = google::protobuf::Arena::CreateMessage<TheChat::RpcResponseHeader>(arena);
+    response_header->set_error_code(static_cast<int32_t>(type));
+    response_header->set_error_text(error_text);
+    SendResponseHeader(call, response_header);
+}
+
+// 流式调用随最终响应结束，从连接上下文中移除，必须在连接所属的IO线程中调用
+void RpcProvider::EndStream(const CallContextPtr &call)
+{
+    call->stream->Close();
+    boost::any_cast<ConnContextPtr>(call->conn->getContext())->streams.erase(call->request_id);
+}
+
+// 写回带4字节长度头的RpcResponseHeader
+void RpcProvider::SendResponseHeader(const CallContextPtr &call, TheChat::RpcResponseHeader *response_header)
+{
+    response_header->set_request_id(call->request_id);
+    if (call->offer_v2)
+    {
+        response_header->set_protocol(kProtocolV2);
+    }
+    if (call->ack_compression)
+    {
+        response_header->set_compression(static_cast<uint32_t>(call->compression));
+    }
+    std::string response_str(4, '\0');
+    response_header->AppendToString(&response_str);
+    uint32_t network_length = htonl(static_cast<uint32_t>(response_str.size() - 4));
+    memcpy(&response_str[0], &network_length, 4);
+    QueueSend(call->conn, response_str);
+}
+
+// 暂存待写回的数据，在本轮事件循环末尾或超过阈值时合并写入，必须在连接所属的IO线程中调用
+void RpcProvider::QueueSend(const muduo::net::TcpConnectionPtr &conn, const std::string &data)
+{
+    if (!conn->connected())
+    {
+        return;
+    }
+    ConnContextPtr ctx = boost::any_cast<ConnContextPtr>(conn->getContext());
+    ctx->output.append(data);
+    if (ctx->output.size() >= flush_threshold_)
+    {
+        FlushOutput(conn, *ctx);
+        return;
+    }
+    if (!ctx->flush_queued)
+    {
+        // IO线程中queueInLoop的回调在本轮事件处理完成后执行，期间完成的响应都会合并到一次写入中
+        ctx->flush_queued = true;
+        conn->getLoop()->queueInLoop([this, conn, ctx]
+                                     {
+                                         ctx->flush_queued = false;
+                                         FlushOutput(conn, *ctx); });
+    }
+}
+
+// 立即写出暂存的数据
+void RpcProvider::FlushOutput(const muduo::net::TcpConnectionPtr &conn, ConnContext &ctx)
+{
+    if (ctx.output.empty())
+    {
+        return;
+    }
+    if (conn->connected())
+    {
+        if (ctx.shm)
+        {
+            ShmSend(ctx, ctx.output.data(), ctx.output.size());
+        }
+        else
+        {
+            conn->send(ctx.output);
+        }
+    }
+    // 保留缓冲区容量供下一轮复用，偶发的大响应之后释放
+    if (ctx.output.capacity() > flush_threshold_ * 4)
+    {
+        std::string().swap(ctx.output);
     }
     else
     {
-        std::cout << "serialize response_str error!" << std::endl;
+        ctx.output.clear();
+    }
+}
+
+// 按请求顺序写回响应，必须在连接所属的IO线程中调用
+void RpcProvider::WriteInOrder(const muduo::net::TcpConnectionPtr &conn, uint64_t seq, std::string &&data, bool keep_alive)
+{
+    if (!conn->connected())
+    {
+        return;
+    }
+    ConnContextPtr ctx = boost::any_cast<ConnContextPtr>(conn->getContext());
+    ctx->pending.emplace(seq, std::make_pair(std::move(data), keep_alive));
+    // 依次写回已轮到的响应，先到达的后序响应暂存等待
+    while (!ctx->pending.empty() && ctx->pending.begin()->first == ctx->send_seq)
+    {
+        auto node = ctx->pending.extract(ctx->pending.begin());
+        ++ctx->send_seq;
+        // 通过网络把rpc方法执行的结果发送回rpc的调用方
+        QueueSend(conn, node.mapped().first);
+        if (!node.mapped().second)
+        {
+            FlushOutput(conn, *ctx);
+            conn->shutdown(); // 短连接请求，由rpcprovider主动断开连接
+            ctx->pending.clear();
+            return;
+        }
     }
-    conn->shutdown(); // 模拟http的短链接服务，由rpcprovider主动断开连接
 }
@@ -0,0 +1,666 @@
+#include "rpcsession.h"
+#include "rpcchannel.h"
+#include "asynclogger.h"
+#include <poll.h>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+// 读线程io_uring的提交队列长度和提供缓冲区：16个16KB的缓冲区
+static const unsigned kUringEntries = 4;
+static const uint16_t kUringBufferGroup = 0;
+static const unsigned kUringBufferCount = 16;
+static const unsigned kUringBufferSize = 16 * 1024;
+
+/**
+ * @brief 构造函数，从连接池获取连接并启动读线程，连接失败则抛出异常
+ * @param ep 端点信息，包括host+port
+ * @param connect_timeout_ms 连接超时时间，单位毫秒
+ * @param max_protocol 允许协商的最高协议版本，会话先用v1，服务端同意后升级为v2
+ * @param compression 向服务端提出的压缩算法，服务端同意后压缩v2帧中不小于compress_threshold字节的消息体
+ * @param compress_threshold 压缩阈值，单位字节
+ * @param use_io_uring 读线程是否改用io_uring的multishot recv读取，内核不支持或共享内存传输时忽略
+ */
+RpcSession::RpcSession(const Endpoint &ep, time_t connect_timeout_ms, uint8_t max_protocol,
+                       CompressionType compression, size_t compress_threshold, bool use_io_uring)
+    : endpoint_(ep),
+      fd_(ConnectionPool::GetInstance().Get(ep, connect_timeout_ms)),
+      max_protocol_(max_protocol),
+      local_compression_(compression),
+      compress_threshold_(compress_threshold)
+{
+    if (ep.transport == Transport::SHM)
+    {
+        // 服务端接收连接后立即交来共享内存段
+        shm_ = ShmTransport::Receive(fd_, static_cast<int>(connect_timeout_ms));
+        if (!shm_)
+        {
+            ConnectionPool::GetInstance().Discard(fd_, endpoint_);
+            throw RpcException("Failed to set up shared memory with " + ep.path, RpcErrorType::NETWORK_ERROR);
+        }
+    }
+    else if (use_io_uring && IoUring::Supported())
+    {
+        // 响应由内核直接写入提供缓冲区，读线程等待和读取合并为一次io_uring_enter；创建失败时仍用poll+recv
+        uring_ = std::make_unique<IoUring>();
+        if (uring_->Init(kUringEntries) && uring_->SetupBufferRing(kUringBufferGroup, kUringBufferCount, kUringBufferSize))
+        {
+            ArmUringRecv();
+        }
+        else
+        {
+            LOG_WARN << "create io_uring failed, fall back to poll: " << strerror(errno);
+            uring_.reset();
+        }
+    }
+    reader_ = std::thread([this]
+                          { ReadLoop(); });
+}
+
+/**
+ * @brief 析构函数，失败所有未完成的调用，停止读线程并归还连接配额
+ */
+RpcSession::~RpcSession()
+{
+    closed_.store(true, std::memory_order_release);
+    // 唤醒阻塞在poll上的读线程
+    shutdown(fd_, SHUT_RDWR);
+    if (reader_.joinable())
+    {
+        if (reader_.get_id() == std::this_thread::get_id())
+            reader_.detach();
+        else
+            reader_.join();
+    }
+    FailAll(RpcErrorType::NETWORK_ERROR, "session closed");
+    ConnectionPool::GetInstance().Discard(fd_, endpoint_);
+}
+
+/**
+ * @brief 发送一次调用，按当前协商的协议版本编码请求
+ * @param method 要远程调用的方法
+ * @param request 请求参数
+ * @param cb 完成回调
+ * @param options 调用选项
+ * @return 本次调用的request_id
+ */
+uint64_t RpcSession::AsyncCall(const google::protobuf::MethodDescriptor *method,
+                               const google::protobuf::Message &request, Callback &&cb,
+                               const CallOptions &options)
+{
+    const uint64_t request_id = next_request_id_.fetch_add(1, std::memory_order_relaxed);
+    std::string send_buf;
+    if (!EncodeRequest(request_id, method, options, request, &send_buf))
+    {
+        throw RpcException("Failed to serialize request", RpcErrorType::PROTOCOL_ERROR);
+    }
+
+    // 先登记再发送，避免响应先于登记到达
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        if (closed_.load(std::memory_order_acquire))
+        {
+            throw RpcException("session closed", RpcErrorType::NETWORK_ERROR);
+        }
+        pending_.emplace(request_id, std::move(cb));
+    }
+
+    SendFrame(send_buf);
+    return request_id;
+}
+
+/**
+ * @brief 取消一个未完成的调用
+ * @param request_id 调用的request_id
+ * @return 取消成功返回true，此后回调不会再执行；回调已经或正在执行时返回false
+ */
+bool RpcSession::Cancel(uint64_t request_id)
+{
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    return pending_.erase(request_id) > 0;
+}
+
+/**
+ * @brief 发起一次流式调用，总是使用v2帧，会话必须由std::make_shared创建
+ * @param method 要远程调用的方法
+ * @param request 第一个请求消息
+ * @param options 调用选项，timeout_ms非0时作为整个流的超时时间
+ * @return 已建立的流，发送失败时流处于失败状态
+ */
+std::shared_ptr<RpcStream> RpcSession::OpenStream(const google::protobuf::MethodDescriptor *method,
+                                                  const google::protobuf::Message &request,
+                                                  const CallOptions &options)
+{
+    if (max_protocol_ < kProtocolV2)
+    {
+        throw RpcException("streaming requires protocol v2", RpcErrorType::PROTOCOL_ERROR);
+    }
+    const uint64_t stream_id = next_request_id_.fetch_add(1, std::memory_order_relaxed);
+    std::string send_buf;
+    if (!EncodeFrameV2(stream_id, kFlagStream | kFlagStreamOpen, method, options, request, &send_buf))
+    {
+        throw RpcException("Failed to serialize request", RpcErrorType::PROTOCOL_ERROR);
+    }
+    // 流可能比会话活得久，会话析构后流的发送直接失败
+    std::weak_ptr<RpcSession> weak_session = weak_from_this();
+    auto deadline = options.timeout_ms == 0 ? RpcStream::Clock::time_point::max()
+                                            : RpcStream::Clock::now() + std::chrono::milliseconds(options.timeout_ms);
+    auto stream = std::make_shared<RpcStream>(
+        [weak_session, stream_id](uint8_t flags, const TheChat::RpcMeta *meta, const char *body, size_t body_len)
+        {
+            std::shared_ptr<RpcSession> session = weak_session.lock();
+            if (!session)
+            {
+                return false;
+            }
+            FrameHeader header;
+            header.flags = kFlagStream | flags;
+            header.request_id = stream_id;
+            std::string frame;
+            return AppendFrame(header, meta, body, body_len, session->NegotiatedCompression(), session->compress_threshold_, &frame) &&
+                   session->SendFrame(frame);
+        },
+        deadline);
+
+    // 先登记再发送，避免服务端的帧先于登记到达
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        if (closed_.load(std::memory_order_acquire))
+        {
+            throw RpcException("session closed", RpcErrorType::NETWORK_ERROR);
+        }
+        streams_.emplace(stream_id, stream);
+    }
+    SendFrame(send_buf);
+    return stream;
+}
+
+// 会话是否已关闭，关闭后不能再发起调用
+bool RpcSession::IsClosed() const
+{
+    return closed_.load(std::memory_order_acquire);
+}
+
+// 未完成的调用数量
+size_t RpcSession::PendingCount() const
+{
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    return pending_.size();
+}
+
+// 当前使用的协议版本
+uint8_t RpcSession::Protocol() const
+{
+    return protocol_.load(std::memory_order_relaxed);
+}
+
+// 与服务端协商的压缩算法，服务端同意之前为NONE
+CompressionType RpcSession::NegotiatedCompression() const
+{
+    return static_cast<CompressionType>(compression_.load(std::memory_order_relaxed));
+}
+
+// 完整写出一帧，失败时关闭整个会话
+bool RpcSession::SendFrame(const std::string &frame)
+{
+    if (shm_)
+    {
+        return SendFrameShm(frame);
+    }
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    const char *data = frame.data();
+    size_t left = frame.size();
+    while (left > 0)
+    {
+        ssize_t n = send(fd_, data, left, MSG_NOSIGNAL);
+        if (n > 0)
+        {
+            data += n;
+            left -= n;
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            pollfd pfd{fd_, POLLOUT, 0};
+            if (poll(&pfd, 1, SOCKET_RW_TIMEOUT_MS) > 0)
+                continue;
+        }
+        // 半帧已写入，连接上的字节流不再可信，关闭整个会话
+        FailAll(RpcErrorType::NETWORK_ERROR, "send() error: " + std::string(strerror(errno)));
+        shutdown(fd_, SHUT_RDWR);
+        return false;
+    }
+    return true;
+}
+
+// 经由共享内存字节环完整写出一帧，环满时等待服务端消费
+bool RpcSession::SendFrameShm(const std::string &frame)
+{
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    const char *data = frame.data();
+    size_t left = frame.size();
+    while (true)
+    {
+        size_t n = shm_->Write(data, left);
+        data += n;
+        left -= n;
+        if (left == 0)
+        {
+            return true;
+        }
+        // 环满且已登记等待，服务端消费后唤醒；服务端不会向socket写数据，socket可读说明连接已关闭
+        pollfd pfds[2] = {{shm_->WritableFd(), POLLIN, 0}, {fd_, POLLIN, 0}};
+        int ret = poll(pfds, 2, SOCKET_RW_TIMEOUT_MS);
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0 || pfds[1].revents != 0)
+        {
+            // 半帧已写入，字节环上的数据不再可信，关闭整个会话
+            FailAll(RpcErrorType::NETWORK_ERROR, ret == 0 ? "shared memory ring full" : "connection closed by peer");
+            shutdown(fd_, SHUT_RDWR);
+            return false;
+        }
+        ShmTransport::ClearFd(shm_->WritableFd());
+    }
+}
+
+// 编码请求帧
+bool RpcSession::EncodeRequest(uint64_t request_id, const google::protobuf::MethodDescriptor *method, const CallOptions &options,
+                               const google::protobuf::Message &request, std::string *out)
+{
+    if (protocol_.load(std::memory_order_relaxed) >= kProtocolV2)
+    {
+        return EncodeFrameV2(request_id, 0, method, options, request, out);
+    }
+
+    // v1：请求先序列化到RpcHeader.params，再序列化整个RpcHeader
+    TheChat::RpcHeader rpc_header;
+    rpc_header.set_service_name(method->service()->name());
+    rpc_header.set_method_name(method->name());
+    rpc_header.set_request_id(request_id);
+    rpc_header.set_keep_alive(true);
+    rpc_header.set_max_protocol(max_protocol_);
+    rpc_header.set_timeout_ms(options.timeout_ms);
+    rpc_header.set_priority(options.priority);
+    rpc_header.set_compression(static_cast<uint32_t>(local_compression_));
+    if (!request.SerializeToString(rpc_header.mutable_params()))
+    {
+        return false;
+    }
+    // 预留4字节长度头，序列化后回填
+    out->assign(4, '\0');
+    if (!rpc_header.AppendToString(out))
+    {
+        return false;
+    }
+    uint32_t network_length = htonl(static_cast<uint32_t>(out->size() - 4));
+    memcpy(&(*out)[0], &network_length, 4);
+    return true;
+}
+
+// 编码v2请求帧
+bool RpcSession::EncodeFrameV2(uint64_t request_id, uint8_t flags, const google::protobuf::MethodDescriptor *method,
+                               const CallOptions &options, const google::protobuf::Message &request, std::string *out)
+{
+    // v2：请求直接序列化在固定帧头和扩展头之后，只编码一次
+    FrameHeader header;
+    header.flags = flags;
+    header.request_id = request_id;
+    header.method_id = options.method_id;
+    TheChat::RpcMeta meta;
+    // 服务端按方法id查表分发时不需要方法名
+    if (options.method_id == 0)
+    {
+        meta.set_service_name(method->service()->name());
+        meta.set_method_name(method->name());
+    }
+    meta.set_timeout_ms(options.timeout_ms);
+    meta.set_priority(options.priority);
+    // 服务端同意之前每个请求都提出压缩，同意之后按协商结果压缩请求体
+    const CompressionType compression = NegotiatedCompression();
+    if (compression == CompressionType::NONE)
+    {
+        meta.set_compression(static_cast<uint32_t>(local_compression_));
+    }
+    // 扩展头没有任何字段时省略
+    bool has_meta = options.method_id == 0 || options.timeout_ms != 0 || options.priority != 0 || meta.compression() != 0;
+    return AppendFrame(header, has_meta ? &meta : nullptr, &request, compression, compress_threshold_, out);
+}
+
+// 解析缓冲区开头的一个响应帧，数据不足时返回0，格式错误时返回-1，否则返回帧长度；
+// 流帧直接交给对应的流，request_id置0表示没有需要完成的调用
+ssize_t RpcSession::DecodeResponse(const char *data, size_t len, RpcResult &result, uint64_t &request_id)
+{
+    if (len < 4 || (IsFrameV2(data, len) && len < kFrameHeaderSize))
+    {
+        return 0;
+    }
+    if (IsFrameV2(data, len))
+    {
+        FrameHeader header;
+        if (!DecodeFrameHeader(data, &header) || !(header.flags & kFlagResponse))
+        {
+            return -1;
+        }
+        const size_t frame_len = kFrameHeaderSize + header.meta_len + header.body_len;
+        if (len < frame_len)
+        {
+            return 0;
+        }
+        const char *meta_data = data + kFrameHeaderSize;
+        if (header.flags & kFlagStream)
+        {
+            request_id = 0;
+            return DispatchStream(header, meta_data) ? static_cast<ssize_t>(frame_len) : -1;
+        }
+        if (header.meta_len > 0)
+        {
+            TheChat::RpcMeta meta;
+            if (!meta.ParseFromArray(meta_data, static_cast<int>(header.meta_len)))
+            {
+                return -1;
+            }
+            result.type = static_cast<RpcErrorType>(meta.error_code());
+            result.error_text = meta.error_text();
+            OnCompressionAck(meta.compression());
+        }
+        // 压缩的响应体直接解压到result.response
+        const char *body = nullptr;
+        size_t body_len = 0;
+        if (!DecodeFrameBody(header, meta_data + header.meta_len, &result.response, &body, &body_len))
+        {
+            return -1;
+        }
+        if (body != result.response.data())
+        {
+            result.response.assign(body, body_len);
+        }
+        request_id = header.request_id;
+        return static_cast<ssize_t>(frame_len);
+    }
+
+    uint32_t network_length = 0;
+    memcpy(&network_length, data, 4);
+    const size_t frame_len = 4 + static_cast<size_t>(ntohl(network_length));
+    if (len < frame_len)
+    {
+        return 0;
+    }
+    TheChat::RpcResponseHeader response_header;
+    if (!response_header.ParseFromArray(data + 4, static_cast<int>(frame_len - 4)))
+    {
+        return -1;
+    }
+    // 服务端同意升级后，后续请求改用v2帧
+    if (response_header.protocol() >= kProtocolV2 && max_protocol_ >= kProtocolV2)
+    {
+        protocol_.store(kProtocolV2, std::memory_order_relaxed);
+    }
+    OnCompressionAck(response_header.compression());
+    result.type = static_cast<RpcErrorType>(response_header.error_code());
+    result.error_text = response_header.error_text();
+    result.response = std::move(*response_header.mutable_response());
+    request_id = response_header.request_id();
+    return static_cast<ssize_t>(frame_len);
+}
+
+// 完成一次调用
+void RpcSession::Complete(uint64_t request_id, RpcResult &&result)
+{
+    Callback cb;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        auto it = pending_.find(request_id);
+        if (it == pending_.end())
+        {
+            return; // 调用已超时取消，丢弃迟到的响应
+        }
+        cb = std::move(it->second);
+        pending_.erase(it);
+    }
+    cb(std::move(result));
+}
+
+// 把流帧交给对应的流，流结束后不再跟踪
+bool RpcSession::DispatchStream(const FrameHeader &header, const char *data)
+{
+    std::shared_ptr<RpcStream> stream;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        auto it = streams_.find(header.request_id);
+        if (it == streams_.end())
+        {
+            return true; // 流已取消，丢弃迟到的帧
+        }
+        stream = it->second;
+        if (header.flags & kFlagStreamEnd)
+        {
+            streams_.erase(it);
+        }
+    }
+    std::string storage;
+    const char *body = nullptr;
+    size_t body_len = 0;
+    if (!DecodeFrameBody(header, data + header.meta_len, &storage, &body, &body_len))
+    {
+        return false;
+    }
+    return stream->OnFrame(header.flags, data, header.meta_len, body, body_len);
+}
+
+// 服务端在响应中同意压缩时启用
+void RpcSession::OnCompressionAck(uint32_t compression)
+{
+    if (compression != 0 && compression == static_cast<uint32_t>(local_compression_))
+    {
+        compression_.store(compression, std::memory_order_relaxed);
+    }
+}
+
+// 读线程，按request_id分发响应
+void RpcSession::ReadLoop()
+{
+    std::string recv_buf;
+    std::vector<char> chunk(64 * 1024);
+    while (!closed_.load(std::memory_order_acquire))
+    {
+        ssize_t n;
+        if (uring_)
+        {
+            n = ReadUring(&recv_buf);
+        }
+        else if (shm_)
+        {
+            n = ReadShm(chunk.data(), chunk.size());
+            if (n < 0)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            pollfd pfd{fd_, POLLIN, 0};
+            int ret = poll(&pfd, 1, 100);
+            if (ret == 0 || (ret < 0 && errno == EINTR))
+            {
+                continue;
+            }
+            n = ret < 0 ? -1 : recv(fd_, chunk.data(), chunk.size(), 0);
+        }
+        if (n == 0)
+        {
+            FailAll(RpcErrorType::NETWORK_ERROR, "connection closed by peer");
+            return;
+        }
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                continue;
+            FailAll(RpcErrorType::NETWORK_ERROR, "recv() error: " + std::string(strerror(errno)));
+            return;
+        }
+        if (!uring_)
+        {
+            recv_buf.append(chunk.data(), n);
+        }
+
+        // 切分缓冲区中所有完整的响应帧，v1和v2帧逐帧识别
+        size_t offset = 0;
+        while (true)
+        {
+            RpcResult result;
+            uint64_t request_id = 0;
+            ssize_t frame_len = DecodeResponse(recv_buf.data() + offset, recv_buf.size() - offset, result, request_id);
+            if (frame_len == 0)
+            {
+                break;
+            }
+            if (frame_len < 0)
+            {
+                FailAll(RpcErrorType::PROTOCOL_ERROR, "Failed to parse response");
+                return;
+            }
+            offset += frame_len;
+            if (request_id != 0)
+            {
+                Complete(request_id, std::move(result));
+            }
+        }
+        recv_buf.erase(0, offset);
+    }
+}
+
+// 从共享内存字节环读取，没有数据时最多等待100毫秒；返回-1表示暂无数据，0表示服务端已关闭连接
+ssize_t RpcSession::ReadShm(char *buf, size_t len)
+{
+    // 响应通常在很短时间内到达，先自旋等待一小段时间，省去服务端写eventfd和本线程被唤醒的开销；
+    // 只有一个CPU时自旋会占住服务端需要的CPU，直接等待
+    static const auto spin = std::chrono::microseconds(std::thread::hardware_concurrency() > 1 ? 50 : 0);
+    const auto spin_deadline = std::chrono::steady_clock::now() + spin;
+    while (shm_->Readable() == 0 && std::chrono::steady_clock::now() < spin_deadline)
+    {
+    }
+    size_t n = shm_->Read(buf, len);
+    if (n > 0)
+    {
+        return static_cast<ssize_t>(n);
+    }
+    // 字节环已空且已登记等待，服务端写入后唤醒
+    pollfd pfds[2] = {{shm_->ReadableFd(), POLLIN, 0}, {fd_, POLLIN, 0}};
+    if (poll(pfds, 2, 100) <= 0)
+    {
+        return -1;
+    }
+    ShmTransport::ClearFd(shm_->ReadableFd());
+    n = shm_->Read(buf, len);
+    if (n > 0)
+    {
+        return static_cast<ssize_t>(n);
+    }
+    // 服务端关闭连接前写入的响应已读完
+    return pfds[1].revents != 0 ? 0 : -1;
+}
+
+// 从multishot recv的完成项读取，数据直接追加到out，没有数据时最多等待100毫秒；
+// 返回读取的字节数，0表示服务端已关闭连接，-1时errno为EAGAIN表示暂无数据
+ssize_t RpcSession::ReadUring(std::string *out)
+{
+    if (uring_state_ <= 0)
+    {
+        // 上一轮已读到关闭或错误，先交付了同一轮的数据
+        errno = -uring_state_;
+        return uring_state_ == 0 ? 0 : -1;
+    }
+    int ret = uring_->SubmitAndWait(100);
+    if (ret < 0 && ret != -ETIME && ret != -EINTR)
+    {
+        errno = -ret;
+        return -1;
+    }
+    ssize_t total = 0;
+    bool rearm = false;
+    uring_->ForEachCqe([this, out, &total, &rearm](const io_uring_cqe &cqe)
+                       {
+                           const int32_t res = IoUring::Result(cqe);
+                           uint16_t buffer_id = 0;
+                           const bool has_buffer = IoUring::BufferId(cqe, &buffer_id);
+                           if (res > 0)
+                           {
+                               out->append(uring_->Buffer(buffer_id), static_cast<size_t>(res));
+                               total += res;
+                           }
+                           if (has_buffer)
+                           {
+                               uring_->RecycleBuffer(buffer_id);
+                           }
+                           if (IoUring::HasMore(cqe))
+                           {
+                               return;
+                           }
+                           // 提供缓冲区暂时用完时请求结束，缓冲区已归还，重新挂上
+                           if (res > 0 || res == -ENOBUFS)
+                           {
+                               rearm = true;
+                           }
+                           else
+                           {
+                               uring_state_ = res;
+                           } });
+    if (rearm && uring_state_ > 0)
+    {
+        ArmUringRecv();
+    }
+    if (total > 0)
+    {
+        return total;
+    }
+    if (uring_state_ <= 0)
+    {
+        errno = -uring_state_;
+        return uring_state_ == 0 ? 0 : -1;
+    }
+    errno = EAGAIN;
+    return -1;
+}
+
+// 在fd_上挂multishot recv，下一次SubmitAndWait时提交
+void RpcSession::ArmUringRecv()
+{
+    if (io_uring_sqe *sqe = uring_->GetSqe())
+    {
+        IoUring::PrepMultishotRecv(sqe, fd_, kUringBufferGroup, 0);
+    }
+}
+
+// 关闭会话并以指定错误完成所有未完成的调用
+void RpcSession::FailAll(RpcErrorType type, const std::string &reason)
+{
+    std::unordered_map<uint64_t, Callback> pending;
+    std::unordered_map<uint64_t, std::shared_ptr<RpcStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        closed_.store(true, std::memory_order_release);
+        pending.swap(pending_);
+        streams.swap(streams_);
+    }
+    for (auto &item : streams)
+    {
+        item.second->Fail(type, reason);
+    }
+    if (!pending.empty())
+    {
+        LOG_WARN << "RpcSession " << endpoint_.host << ":" << endpoint_.port << " failed "
+                 << pending.size() << " calls: " << reason;
+    }
+    for (auto &item : pending)
+    {
+        RpcResult result;
+        result.type = type;
+        result.error_text = reason;
+        item.second(std::move(result));
+    }
+}
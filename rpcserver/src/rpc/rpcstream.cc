@@ -0,0 +1,263 @@
+#include "rpcstream.h"
+
+/**
+ * @brief 构造函数
+ * @param sender 发送帧的回调
+ * @param deadline 截止时间，读写等待超过该时间时流以DEADLINE_EXCEEDED失败
+ */
+RpcStream::RpcStream(FrameSender &&sender, Clock::time_point deadline)
+    : sender_(std::move(sender)),
+      deadline_(deadline)
+{
+}
+
+/**
+ * @brief 发送一条消息，没有发送额度时阻塞等待
+ * @param message 消息
+ * @return 流已结束或失败时返回false
+ */
+bool RpcStream::Write(const google::protobuf::Message &message)
+{
+    std::string body;
+    if (!message.SerializeToString(&body))
+    {
+        return false;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // 对端消费跟不上时在此等待，已发出未消费的消息不超过对端授予的额度
+        if (!WaitLocked(lock, [this]
+                        { return send_credit_ > 0 || send_closed_ || status_ != RpcErrorType::SUCCESS; }))
+        {
+            return false;
+        }
+        if (send_closed_ || status_ != RpcErrorType::SUCCESS)
+        {
+            return false;
+        }
+        --send_credit_;
+    }
+    if (!sender_(0, nullptr, body.data(), body.size()))
+    {
+        Fail(RpcErrorType::NETWORK_ERROR, "connection closed");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 接收一条消息，没有消息时阻塞等待
+ * @param message 输出
+ * @return 对端已结束发送且消息已读完、或流失败时返回false
+ */
+bool RpcStream::Read(google::protobuf::Message *message)
+{
+    std::string body;
+    uint32_t grant = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!WaitLocked(lock, [this]
+                        { return !inbound_.empty() || recv_closed_ || status_ != RpcErrorType::SUCCESS; }))
+        {
+            return false;
+        }
+        if (inbound_.empty() || status_ != RpcErrorType::SUCCESS)
+        {
+            return false;
+        }
+        body = std::move(inbound_.front());
+        inbound_.pop_front();
+        // 攒够一半额度再授予对端，避免每条消息都回一个流量控制帧
+        if (++consumed_ >= kStreamWindow / 2 && !recv_closed_)
+        {
+            grant = consumed_;
+            consumed_ = 0;
+        }
+    }
+    if (grant != 0)
+    {
+        TheChat::RpcMeta meta;
+        meta.set_window(grant);
+        sender_(kFlagWindowUpdate, &meta, nullptr, 0);
+    }
+    return message->ParseFromString(body);
+}
+
+// 客户端：请求消息发送完毕，之后不能再Write
+bool RpcStream::CloseSend()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (send_closed_ || status_ != RpcErrorType::SUCCESS)
+        {
+            return false;
+        }
+        send_closed_ = true;
+    }
+    cv_.notify_all();
+    return sender_(kFlagStreamEnd, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief 客户端：等待服务端结束流
+ * @param response 输出服务端的最终响应，可为nullptr
+ * @return 流正常结束返回true，失败时原因见Status()和ErrorText()
+ */
+bool RpcStream::Finish(google::protobuf::Message *response)
+{
+    std::string body;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!WaitLocked(lock, [this]
+                        { return recv_closed_ || status_ != RpcErrorType::SUCCESS; }))
+        {
+            return false;
+        }
+        if (status_ != RpcErrorType::SUCCESS)
+        {
+            return false;
+        }
+        body.swap(final_body_);
+    }
+    if (response && !response->ParseFromString(body))
+    {
+        Fail(RpcErrorType::INVALID_RESPONSE, "Failed to parse response");
+        return false;
+    }
+    return true;
+}
+
+// 放弃流并通知对端，阻塞在该流上的读写立即返回
+void RpcStream::Cancel(const std::string &reason)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (status_ != RpcErrorType::SUCCESS || (send_closed_ && recv_closed_))
+        {
+            return;
+        }
+        status_ = RpcErrorType::BUSINESS_ERROR;
+        error_text_ = "stream cancelled: " + reason;
+        send_closed_ = true;
+        recv_closed_ = true;
+        inbound_.clear();
+    }
+    cv_.notify_all();
+    TheChat::RpcMeta meta;
+    meta.set_error_code(static_cast<int32_t>(RpcErrorType::BUSINESS_ERROR));
+    meta.set_error_text("stream cancelled: " + reason);
+    sender_(kFlagStreamEnd, &meta, nullptr, 0);
+}
+
+// 流的状态，SUCCESS表示未失败
+RpcErrorType RpcStream::Status() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return status_;
+}
+
+std::string RpcStream::ErrorText() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_text_;
+}
+
+// 收到对端的流帧，由连接的IO线程或会话读线程调用，扩展头格式错误时返回false
+bool RpcStream::OnFrame(uint8_t flags, const char *meta_data, size_t meta_len, const char *body, size_t body_len)
+{
+    TheChat::RpcMeta meta;
+    if (meta_len > 0 && !meta.ParseFromArray(meta_data, static_cast<int>(meta_len)))
+    {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (status_ != RpcErrorType::SUCCESS)
+        {
+            return true; // 流已失败，丢弃迟到的帧
+        }
+        if (meta.error_code() != 0)
+        {
+            // 错误帧：对端失败或取消了流
+            status_ = static_cast<RpcErrorType>(meta.error_code());
+            error_text_ = meta.error_text();
+            recv_closed_ = true;
+            inbound_.clear();
+        }
+        else if (flags & kFlagWindowUpdate)
+        {
+            send_credit_ += meta.window();
+        }
+        else if (flags & kFlagStreamEnd)
+        {
+            recv_closed_ = true;
+            final_body_.assign(body, body_len);
+        }
+        else if (recv_closed_)
+        {
+            return true; // 本端已关闭，丢弃
+        }
+        else if (inbound_.size() >= kStreamWindow)
+        {
+            // 对端不遵守额度，不再缓存，保证内存占用有上界
+            status_ = RpcErrorType::PROTOCOL_ERROR;
+            error_text_ = "stream window exceeded";
+            inbound_.clear();
+        }
+        else
+        {
+            inbound_.emplace_back(body, body_len);
+        }
+    }
+    cv_.notify_all();
+    return true;
+}
+
+// 流因连接断开等原因失败，唤醒阻塞的读写
+void RpcStream::Fail(RpcErrorType type, const std::string &error_text)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (status_ == RpcErrorType::SUCCESS && !(send_closed_ && recv_closed_))
+        {
+            status_ = type;
+            error_text_ = error_text;
+        }
+        send_closed_ = true;
+        recv_closed_ = true;
+    }
+    cv_.notify_all();
+}
+
+// 服务端：RPC方法已完成，流随最终响应结束，之后的读写立即返回false
+void RpcStream::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        send_closed_ = true;
+        recv_closed_ = true;
+        inbound_.clear();
+    }
+    cv_.notify_all();
+}
+
+// 等待条件成立，超过截止时间时流失败并返回false，调用时持有mutex_
+template <typename Predicate>
+bool RpcStream::WaitLocked(std::unique_lock<std::mutex> &lock, Predicate predicate)
+{
+    if (deadline_ == Clock::time_point::max())
+    {
+        cv_.wait(lock, predicate);
+        return true;
+    }
+    if (cv_.wait_until(lock, deadline_, predicate))
+    {
+        return true;
+    }
+    status_ = RpcErrorType::DEADLINE_EXCEEDED;
+    error_text_ = "stream deadline exceeded";
+    send_closed_ = true;
+    recv_closed_ = true;
+    cv_.notify_all();
+    return false;
+}
@@ -0,0 +1,344 @@
+#include "uringserver.h"
+#include "asynclogger.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// 每个事件循环的提交队列长度和提供缓冲区：256个16KB的缓冲区由该循环上的所有连接共用
+static const unsigned kRingEntries = 256;
+static const uint16_t kBufferGroup = 0;
+static const unsigned kBufferCount = 256;
+static const unsigned kBufferSize = 16 * 1024;
+
+/**
+ * @brief 构造函数
+ * @param loop 监听所在的事件循环
+ * @param address 监听地址
+ * @param name 名称，用作连接名前缀和IO线程名
+ * @param reuse_port 是否设置SO_REUSEPORT
+ */
+UringServer::UringServer(muduo::net::EventLoop *loop, const muduo::net::InetAddress &address, const std::string &name, bool reuse_port)
+    : loop_(loop),
+      address_(address),
+      name_(name),
+      reuse_port_(reuse_port),
+      idle_fd_(open("/dev/null", O_RDONLY | O_CLOEXEC))
+{
+}
+
+UringServer::~UringServer()
+{
+    StopAccepting();
+    // 与TcpServer一样，在各连接所在的IO线程中销毁连接
+    for (auto &item : connections_)
+    {
+        muduo::net::TcpConnectionPtr conn(item.second);
+        item.second.reset();
+        conn->getLoop()->runInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+    }
+    // io_uring的fd在各自的线程中从epoll移除，IO线程退出后随rings_一起关闭
+    for (auto &item : rings_)
+    {
+        LoopRing *ring = item.second.get();
+        if (ring->channel)
+        {
+            item.first->runInLoop([ring]
+                                  {
+                                      ring->channel->disableAll();
+                                      ring->channel->remove(); });
+        }
+    }
+    thread_pool_.reset();
+    if (idle_fd_ >= 0)
+    {
+        close(idle_fd_);
+    }
+}
+
+/**
+ * @brief 创建各事件循环的io_uring，绑定并开始监听
+ * @return 内核不支持io_uring或监听失败时返回false，失败时已记录日志，调用方应改用epoll的ListenServer
+ */
+bool UringServer::Start()
+{
+    if (!IoUring::Supported())
+    {
+        LOG_WARN << "io_uring with multishot recv is not supported by this kernel";
+        return false;
+    }
+    if (!CreateRing(loop_))
+    {
+        return false;
+    }
+    // 线程池依次启动各IO线程，每个线程在进入循环前创建自己的io_uring，此时本线程在等待，rings_不会被并发修改；
+    // 没有IO线程时回调以loop_调用，其io_uring已经创建
+    bool rings_ok = true;
+    thread_pool_ = std::make_unique<muduo::net::EventLoopThreadPool>(loop_, name_);
+    thread_pool_->setThreadNum(thread_num_);
+    thread_pool_->start([this, &rings_ok](muduo::net::EventLoop *loop)
+                        {
+                            if (rings_.count(loop) == 0 && !CreateRing(loop))
+                            {
+                                rings_ok = false;
+                            }
+                            if (thread_init_callback_)
+                            {
+                                thread_init_callback_(loop);
+                            } });
+    if (!rings_ok)
+    {
+        return false;
+    }
+
+    const sockaddr *addr = address_.getSockAddr();
+    listen_fd_ = socket(addr->sa_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+    if (listen_fd_ < 0)
+    {
+        LOG_ERROR << "socket() failed: " << strerror(errno);
+        return false;
+    }
+    int on = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (reuse_port_)
+    {
+        setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on));
+    }
+    const socklen_t addr_len = addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
+    if (bind(listen_fd_, addr, addr_len) < 0 || listen(listen_fd_, SOMAXCONN) < 0)
+    {
+        LOG_ERROR << "listen on " << address_.toIpPort() << " failed: " << strerror(errno);
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    ArmAccept();
+    rings_[loop_]->ring.Submit();
+    LOG_INFO << name_ << " accepting on " << address_.toIpPort() << " with io_uring";
+    return true;
+}
+
+// 停止接收新连接并关闭监听socket，已建立的连接不受影响
+void UringServer::StopAccepting()
+{
+    if (listen_fd_ < 0)
+    {
+        return;
+    }
+    // 请求持有监听socket的引用，只关闭fd不会停止接收，必须先取消
+    LoopRing *ring = FindRing(loop_);
+    if (io_uring_sqe *sqe = ring->ring.GetSqe())
+    {
+        IoUring::PrepCancel(sqe, kAcceptId, kCancelId);
+        ring->ring.Submit();
+    }
+    close(listen_fd_);
+    listen_fd_ = -1;
+    LOG_INFO << "stopped accepting on " << address_.toIpPort();
+}
+
+// 在loop所在线程中创建其io_uring，失败返回false
+bool UringServer::CreateRing(muduo::net::EventLoop *loop)
+{
+    auto ring = std::make_unique<LoopRing>();
+    if (!ring->ring.Init(kRingEntries) || !ring->ring.SetupBufferRing(kBufferGroup, kBufferCount, kBufferSize))
+    {
+        LOG_ERROR << "create io_uring failed: " << strerror(errno);
+        return false;
+    }
+    ring->channel = std::make_unique<muduo::net::Channel>(loop, ring->ring.Fd());
+    ring->channel->setReadCallback(std::bind(&UringServer::HandleCompletions, this, ring.get()));
+    ring->channel->enableReading();
+    rings_[loop] = std::move(ring);
+    return true;
+}
+
+UringServer::LoopRing *UringServer::FindRing(muduo::net::EventLoop *loop)
+{
+    return rings_.at(loop).get();
+}
+
+// io_uring的fd可读：处理所有完成项，再一次提交处理过程中产生的新请求
+void UringServer::HandleCompletions(LoopRing *ring)
+{
+    ring->ring.ForEachCqe([this, ring](const io_uring_cqe &cqe)
+                          {
+                              const uint64_t id = IoUring::UserData(cqe);
+                              if (id == kAcceptId)
+                              {
+                                  HandleAccept(cqe);
+                              }
+                              else if (id != kCancelId)
+                              {
+                                  HandleRecv(ring, cqe);
+                              } });
+    ring->ring.Submit();
+}
+
+// 在监听socket上挂multishot accept
+void UringServer::ArmAccept()
+{
+    if (io_uring_sqe *sqe = FindRing(loop_)->ring.GetSqe())
+    {
+        IoUring::PrepMultishotAccept(sqe, listen_fd_, kAcceptId);
+    }
+}
+
+void UringServer::HandleAccept(const io_uring_cqe &cqe)
+{
+    const int32_t res = IoUring::Result(cqe);
+    if (res >= 0)
+    {
+        NewConnection(res);
+    }
+    else if (res == -EMFILE && idle_fd_ >= 0 && listen_fd_ >= 0)
+    {
+        // 让出预留的fd接收并关闭这个连接，对端会看到连接被关闭而不是一直等待
+        close(idle_fd_);
+        idle_fd_ = accept(listen_fd_, nullptr, nullptr);
+        close(idle_fd_);
+        idle_fd_ = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    }
+    else if (res != -ECANCELED && res != -EAGAIN && res != -EINTR && res != -ECONNABORTED)
+    {
+        LOG_ERROR << "accept on " << address_.toIpPort() << " failed: " << strerror(-res);
+    }
+    // 出错时multishot accept随之结束，仍在监听时重新挂上
+    if (!IoUring::HasMore(cqe) && listen_fd_ >= 0)
+    {
+        ArmAccept();
+    }
+}
+
+// 为接收的连接创建TcpConnection并分配给IO线程
+void UringServer::NewConnection(int fd)
+{
+    sockaddr_in6 local{};
+    sockaddr_in6 peer{};
+    socklen_t len = sizeof(local);
+    getsockname(fd, reinterpret_cast<sockaddr *>(&local), &len);
+    len = sizeof(peer);
+    getpeername(fd, reinterpret_cast<sockaddr *>(&peer), &len);
+    muduo::net::EventLoop *io_loop = thread_pool_->getNextLoop();
+    std::string conn_name = name_ + "-" + address_.toIpPort() + "#" + std::to_string(next_conn_id_++);
+    auto conn = std::make_shared<muduo::net::TcpConnection>(io_loop, conn_name, fd,
+                                                            muduo::net::InetAddress(local), muduo::net::InetAddress(peer));
+    connections_[conn_name] = conn;
+    conn->setConnectionCallback(std::bind(&UringServer::OnConnection, this, std::placeholders::_1, fd));
+    conn->setMessageCallback(message_callback_);
+    conn->setCloseCallback(std::bind(&UringServer::RemoveConnection, this, std::placeholders::_1));
+    io_loop->runInLoop(std::bind(&muduo::net::TcpConnection::connectEstablished, conn));
+}
+
+void UringServer::ArmRecv(LoopRing *ring, int fd, uint64_t id)
+{
+    if (io_uring_sqe *sqe = ring->ring.GetSqe())
+    {
+        IoUring::PrepMultishotRecv(sqe, fd, kBufferGroup, id);
+    }
+}
+
+void UringServer::HandleRecv(LoopRing *ring, const io_uring_cqe &cqe)
+{
+    uint16_t buffer_id = 0;
+    const bool has_buffer = IoUring::BufferId(cqe, &buffer_id);
+    const int32_t res = IoUring::Result(cqe);
+    const uint64_t id = IoUring::UserData(cqe);
+    auto it = ring->receivers.find(id);
+    if (it == ring->receivers.end())
+    {
+        if (has_buffer)
+        {
+            ring->ring.RecycleBuffer(buffer_id);
+        }
+        return;
+    }
+    const int fd = it->second.fd;
+    muduo::net::TcpConnectionPtr conn = it->second.conn.lock();
+    const bool alive = conn && conn->connected();
+    if (res > 0 && alive)
+    {
+        conn->inputBuffer()->append(ring->ring.Buffer(buffer_id), static_cast<size_t>(res));
+    }
+    // 数据已拷入连接的输入缓冲区，立即归还缓冲区，消息回调中积压的数据不占用提供缓冲区
+    if (has_buffer)
+    {
+        ring->ring.RecycleBuffer(buffer_id);
+    }
+    const bool more = IoUring::HasMore(cqe);
+    if (!more)
+    {
+        // 提供缓冲区暂时用完(ENOBUFS)时请求结束，已归还缓冲区后重新挂上；对端关闭(0)或出错时关闭连接
+        if (alive && (res > 0 || res == -ENOBUFS))
+        {
+            ArmRecv(ring, fd, id);
+        }
+        else
+        {
+            ring->receivers.erase(it);
+            if (alive)
+            {
+                if (res < 0 && res != -ECANCELED)
+                {
+                    LOG_WARN << conn->name() << " recv failed: " << strerror(-res);
+                }
+                conn->forceClose();
+            }
+        }
+    }
+    // 最后调用消息回调，回调中关闭连接时不影响上面对receivers的处理
+    if (res > 0 && alive && message_callback_)
+    {
+        message_callback_(conn, conn->inputBuffer(), muduo::Timestamp::now());
+    }
+}
+
+// 包装用户的连接回调：连接建立后改由io_uring读取，断开时取消recv请求
+void UringServer::OnConnection(const muduo::net::TcpConnectionPtr &conn, int fd)
+{
+    LoopRing *ring = FindRing(conn->getLoop());
+    if (conn->connected())
+    {
+        if (connection_callback_)
+        {
+            connection_callback_(conn);
+        }
+        // connectEstablished已经打开读事件，关闭后socket不再注册到epoll，由multishot recv读取
+        conn->stopRead();
+        const uint64_t id = ring->next_id++;
+        ring->receivers[id] = LoopRing::Receiver{conn, fd};
+        ring->ids[conn.get()] = id;
+        ArmRecv(ring, fd, id);
+        ring->ring.Submit();
+        return;
+    }
+    auto it = ring->ids.find(conn.get());
+    if (it != ring->ids.end())
+    {
+        // recv请求结束时从receivers中删除
+        if (io_uring_sqe *sqe = ring->ring.GetSqe())
+        {
+            IoUring::PrepCancel(sqe, it->second, kCancelId);
+            ring->ring.Submit();
+        }
+        ring->ids.erase(it);
+    }
+    if (connection_callback_)
+    {
+        connection_callback_(conn);
+    }
+}
+
+// 连接关闭，由连接所在的IO线程调用
+void UringServer::RemoveConnection(const muduo::net::TcpConnectionPtr &conn)
+{
+    loop_->runInLoop(std::bind(&UringServer::RemoveConnectionInLoop, this, conn));
+}
+
+void UringServer::RemoveConnectionInLoop(const muduo::net::TcpConnectionPtr &conn)
+{
+    connections_.erase(conn->name());
+    conn->getLoop()->queueInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+}
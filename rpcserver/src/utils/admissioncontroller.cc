@@ -0,0 +1,106 @@
+#include "admissioncontroller.h"
+#include <algorithm>
+
+AdmissionController::AdmissionController(const Config &config) : config_(config) {}
+
+/**
+ * @brief 新请求到达时调用，决定是否接纳，不阻塞
+ * @return 接纳返回true，此后必须调用一次OnFinish；过载时返回false并计入拒绝数
+ */
+bool AdmissionController::TryAdmit()
+{
+    // 排队时延持续超标时拒绝新请求，每个interval放行一个探测请求，探测请求的时延回落后恢复接纳
+    if (dropping_.load(std::memory_order_relaxed) && inflight_.load(std::memory_order_relaxed) > 0)
+    {
+        const int64_t now = Clock::now().time_since_epoch().count();
+        int64_t next_probe_time = next_probe_time_.load(std::memory_order_relaxed);
+        const int64_t interval = std::chrono::duration_cast<Clock::duration>(config_.interval).count();
+        if (now < next_probe_time ||
+            !next_probe_time_.compare_exchange_strong(next_probe_time, now + interval, std::memory_order_relaxed))
+        {
+            shed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    uint32_t inflight = inflight_.fetch_add(1, std::memory_order_acq_rel);
+    if (config_.max_concurrency != 0 && inflight >= config_.max_concurrency)
+    {
+        inflight_.fetch_sub(1, std::memory_order_acq_rel);
+        shed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    admitted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief 已接纳的请求开始执行时调用，上报其排队时延
+ * @param queue_delay 从请求到达到开始执行的时间
+ */
+void AdmissionController::OnStart(Clock::duration queue_delay)
+{
+    queue_delay_sum_.fetch_add(queue_delay.count(), std::memory_order_relaxed);
+    queue_delay_count_.fetch_add(1, std::memory_order_relaxed);
+    if (config_.target.count() == 0)
+    {
+        return;
+    }
+    if (queue_delay < config_.target)
+    {
+        // 时延回落，退出拒绝状态
+        first_above_time_.store(0, std::memory_order_relaxed);
+        dropping_.store(false, std::memory_order_relaxed);
+        return;
+    }
+    // 与CoDel相同，只有时延在整个interval内都超过target才认为是持续排队，短暂的突发不触发拒绝
+    const int64_t now = Clock::now().time_since_epoch().count();
+    int64_t first_above_time = first_above_time_.load(std::memory_order_relaxed);
+    if (first_above_time == 0)
+    {
+        const int64_t deadline = now + std::chrono::duration_cast<Clock::duration>(config_.interval).count();
+        first_above_time_.compare_exchange_strong(first_above_time, deadline, std::memory_order_relaxed);
+    }
+    else if (now >= first_above_time)
+    {
+        dropping_.store(true, std::memory_order_relaxed);
+    }
+}
+
+// 已接纳的请求完成时调用
+void AdmissionController::OnFinish()
+{
+    inflight_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+// 是否处于过载拒绝状态
+bool AdmissionController::Dropping() const
+{
+    return dropping_.load(std::memory_order_relaxed);
+}
+
+// 已接纳未完成的请求数
+uint32_t AdmissionController::Inflight() const
+{
+    return inflight_.load(std::memory_order_relaxed);
+}
+
+// 累计接纳数
+uint64_t AdmissionController::AdmittedCount() const
+{
+    return admitted_.load(std::memory_order_relaxed);
+}
+
+// 累计拒绝数
+uint64_t AdmissionController::ShedCount() const
+{
+    return shed_.load(std::memory_order_relaxed);
+}
+
+// 取出上次调用以来开始执行的请求的平均排队时延并重新计数，期间没有请求开始执行时返回0
+AdmissionController::Clock::duration AdmissionController::TakeQueueDelay()
+{
+    // 两次交换之间开始执行的请求可能只计入其中一项，作为负载信号足够
+    const int64_t count = queue_delay_count_.exchange(0, std::memory_order_relaxed);
+    const int64_t sum = queue_delay_sum_.exchange(0, std::memory_order_relaxed);
+    return count > 0 ? Clock::duration(std::max<int64_t>(sum, 0) / count) : Clock::duration(0);
+}
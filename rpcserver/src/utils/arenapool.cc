@@ -0,0 +1,70 @@
+#include "arenapool.h"
+
+// 构造带初始内存块的Arena
+static google::protobuf::ArenaOptions MakeOptions(char *block, size_t size)
+{
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = size;
+    return options;
+}
+
+PooledArena::PooledArena(size_t initial_block_size)
+    : initial_block(new char[initial_block_size]),
+      arena(MakeOptions(initial_block.get(), initial_block_size)) {}
+
+// Arena指针析构时重置并归还到当前线程的池中
+void ArenaPool::Recycler::operator()(PooledArena *pooled) const noexcept
+{
+    ArenaPool::ThreadLocal().Release(pooled);
+}
+
+// 获取当前线程的Arena池
+ArenaPool &ArenaPool::ThreadLocal()
+{
+    static thread_local ArenaPool pool;
+    return pool;
+}
+
+ArenaPool::~ArenaPool()
+{
+    for (PooledArena *pooled : free_list_)
+    {
+        delete pooled;
+    }
+}
+
+// 获取一个空的Arena，池为空时新建
+ArenaPool::ArenaPtr ArenaPool::Acquire()
+{
+    if (free_list_.empty())
+    {
+        return ArenaPtr(new PooledArena(kInitialBlockSize));
+    }
+    PooledArena *pooled = free_list_.back();
+    free_list_.pop_back();
+    return ArenaPtr(pooled);
+}
+
+// 池中缓存的Arena数量
+size_t ArenaPool::CachedCount() const
+{
+    return free_list_.size();
+}
+
+// 重置并缓存Arena，超出上限时直接释放
+void ArenaPool::Release(PooledArena *pooled) noexcept
+{
+    if (pooled == nullptr)
+    {
+        return;
+    }
+    // Reset析构Arena上的所有对象并释放初始块以外的内存
+    pooled->arena.Reset();
+    if (free_list_.size() >= kMaxCached)
+    {
+        delete pooled;
+        return;
+    }
+    free_list_.push_back(pooled);
+}
@@ -82,8 +82,7 @@ void CircuitBreaker::TransitionToState(CircuitBreaker::State new_state)
 
 CircuitBreaker &CircuitBreakerManager::GetInstance(const std::string &service_name)
 {
-    static std::mutex instance_mutex;
-    std::lock_guard<std::mutex> lock(instance_mutex);
+    std::lock_guard<std::mutex> lock(mutex_);
 
     // 在第一次访问时创建熔断器
     auto &breaker = breakers_[service_name];
@@ -95,6 +94,19 @@ CircuitBreaker &CircuitBreakerManager::GetInstance(const std::string &service_na
     return *breaker;
 }
 
+// 已创建的各服务熔断器的当前状态，只在复制状态期间持锁
+std::vector<std::pair<std::string, CircuitBreaker::State>> CircuitBreakerManager::GetStates()
+{
+    std::vector<std::pair<std::string, CircuitBreaker::State>> states;
+    std::lock_guard<std::mutex> lock(mutex_);
+    states.reserve(breakers_.size());
+    for (const auto &item : breakers_)
+    {
+        states.emplace_back(item.first, item.second->GetState());
+    }
+    return states;
+}
+
 CircuitBreaker::Config CircuitBreakerManager::GetConfigForService(const std::string &service)
 {
     // 目前设置返回默认熔断器
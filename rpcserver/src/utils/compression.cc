@@ -0,0 +1,273 @@
+#include "compression.h"
+#include <arpa/inet.h>
+#include <cstring>
+
+// LZ4块格式的常量：最短匹配长度，结尾必须保留为字面量的字节数，最后一个匹配距结尾的最小距离
+static constexpr size_t kMinMatch = 4;
+static constexpr size_t kLastLiterals = 5;
+static constexpr size_t kMatchFindLimit = 12;
+static constexpr size_t kMaxOffset = 65535;
+static constexpr int kHashLog = 12;
+// 压缩数据前的格式头：算法(1) + 原始长度(4)
+static constexpr size_t kCompressHeaderSize = 5;
+
+static inline uint32_t Read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t Hash32(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - kHashLog);
+}
+
+// 写出长度的扩展字节，每个255表示还有后续
+static inline uint8_t *WriteLength(uint8_t *op, size_t len)
+{
+    while (len >= 255)
+    {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = static_cast<uint8_t>(len);
+    return op;
+}
+
+// 读取长度的扩展字节，数据不足时返回false
+static inline bool ReadLength(const uint8_t *&ip, const uint8_t *iend, size_t &len)
+{
+    uint8_t b;
+    do
+    {
+        if (ip >= iend)
+        {
+            return false;
+        }
+        b = *ip++;
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+// 进程内所有连接共享的压缩统计
+Compression::Stats &Compression::GetStats()
+{
+    static Stats stats;
+    return stats;
+}
+
+// 由配置值("lz4"或"none")得到压缩算法，未知取值按NONE处理
+CompressionType Compression::Parse(const std::string &name)
+{
+    if (name == "lz4" || name == "LZ4")
+    {
+        return CompressionType::LZ4;
+    }
+    return CompressionType::NONE;
+}
+
+/**
+ * @brief 压缩数据并追加到out，格式为：算法(1) | 原始长度(4，网络字节序) | 压缩数据
+ * @param type 压缩算法
+ * @param data 原始数据
+ * @param len 原始数据长度
+ * @param out 输出
+ * @return 算法为NONE或压缩后不比原始数据小时返回false，out不变
+ */
+bool Compression::Compress(CompressionType type, const char *data, size_t len, std::string *out)
+{
+    if (type != CompressionType::LZ4 || len > UINT32_MAX)
+    {
+        return false;
+    }
+    const size_t origin = out->size();
+    out->resize(origin + kCompressHeaderSize + Lz4Bound(len));
+    uint8_t *header = reinterpret_cast<uint8_t *>(&(*out)[origin]);
+    header[0] = static_cast<uint8_t>(type);
+    uint32_t network_length = htonl(static_cast<uint32_t>(len));
+    memcpy(header + 1, &network_length, 4);
+    size_t compressed = Lz4Compress(reinterpret_cast<const uint8_t *>(data), len, header + kCompressHeaderSize);
+    if (kCompressHeaderSize + compressed >= len)
+    {
+        out->resize(origin);
+        return false;
+    }
+    out->resize(origin + kCompressHeaderSize + compressed);
+    return true;
+}
+
+/**
+ * @brief 解压Compress的输出
+ * @param data 压缩数据
+ * @param len 压缩数据长度
+ * @param max_len 允许的最大原始长度，防止恶意数据导致过量分配
+ * @param out 输出，原有内容被替换
+ * @return 算法未知、原始长度超限或数据损坏时返回false
+ */
+bool Compression::Decompress(const char *data, size_t len, size_t max_len, std::string *out)
+{
+    if (len < kCompressHeaderSize || static_cast<uint8_t>(data[0]) != static_cast<uint8_t>(CompressionType::LZ4))
+    {
+        return false;
+    }
+    uint32_t network_length = 0;
+    memcpy(&network_length, data + 1, 4);
+    const size_t raw_len = ntohl(network_length);
+    if (raw_len > max_len)
+    {
+        return false;
+    }
+    out->resize(raw_len);
+    return Lz4Decompress(reinterpret_cast<const uint8_t *>(data + kCompressHeaderSize), len - kCompressHeaderSize,
+                         reinterpret_cast<uint8_t *>(&(*out)[0]), raw_len);
+}
+
+// LZ4块压缩输出的最大长度
+size_t Compression::Lz4Bound(size_t len)
+{
+    return len + len / 255 + 16;
+}
+
+// LZ4块压缩，dst至少有Lz4Bound(len)字节，返回压缩后的长度
+size_t Compression::Lz4Compress(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    const uint8_t *const end = src + len;
+    const uint8_t *anchor = src; // 尚未输出的字面量起点
+    uint8_t *op = dst;
+    if (len > kMatchFindLimit)
+    {
+        // 记录每个4字节序列最近出现的位置，贪心地取第一个候选
+        uint32_t table[1 << kHashLog] = {};
+        const uint8_t *const match_find_limit = end - kMatchFindLimit;
+        const uint8_t *const match_limit = end - kLastLiterals;
+        const uint8_t *ip = src + 1;
+        while (ip < match_find_limit)
+        {
+            const uint32_t sequence = Read32(ip);
+            const uint32_t h = Hash32(sequence);
+            const uint8_t *ref = src + table[h];
+            table[h] = static_cast<uint32_t>(ip - src);
+            if (static_cast<size_t>(ip - ref) > kMaxOffset || Read32(ref) != sequence)
+            {
+                ++ip;
+                continue;
+            }
+            // 向前扩展匹配
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                --ip;
+                --ref;
+            }
+            // 向后扩展匹配，结尾的kLastLiterals字节必须是字面量
+            const uint8_t *match_end = ip + kMinMatch;
+            const uint8_t *ref_end = ref + kMinMatch;
+            while (match_end < match_limit && *match_end == *ref_end)
+            {
+                ++match_end;
+                ++ref_end;
+            }
+            const size_t literal_len = static_cast<size_t>(ip - anchor);
+            const size_t match_len = static_cast<size_t>(match_end - ip) - kMinMatch;
+            uint8_t *token = op++;
+            if (literal_len >= 15)
+            {
+                *token = 15 << 4;
+                op = WriteLength(op, literal_len - 15);
+            }
+            else
+            {
+                *token = static_cast<uint8_t>(literal_len << 4);
+            }
+            memcpy(op, anchor, literal_len);
+            op += literal_len;
+            const uint16_t offset = static_cast<uint16_t>(ip - ref);
+            *op++ = static_cast<uint8_t>(offset & 0xff);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            if (match_len >= 15)
+            {
+                *token |= 15;
+                op = WriteLength(op, match_len - 15);
+            }
+            else
+            {
+                *token |= static_cast<uint8_t>(match_len);
+            }
+            ip = match_end;
+            anchor = ip;
+        }
+    }
+    // 最后一个序列只有字面量
+    const size_t literal_len = static_cast<size_t>(end - anchor);
+    uint8_t *token = op++;
+    if (literal_len >= 15)
+    {
+        *token = 15 << 4;
+        op = WriteLength(op, literal_len - 15);
+    }
+    else
+    {
+        *token = static_cast<uint8_t>(literal_len << 4);
+    }
+    memcpy(op, anchor, literal_len);
+    op += literal_len;
+    return static_cast<size_t>(op - dst);
+}
+
+// LZ4块解压，输出必须恰好填满dst_len字节
+bool Compression::Lz4Decompress(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len)
+{
+    const uint8_t *ip = src;
+    const uint8_t *const iend = src + len;
+    uint8_t *op = dst;
+    uint8_t *const oend = dst + dst_len;
+    while (ip < iend)
+    {
+        const uint8_t token = *ip++;
+        size_t literal_len = token >> 4;
+        if (literal_len == 15 && !ReadLength(ip, iend, literal_len))
+        {
+            return false;
+        }
+        if (literal_len > static_cast<size_t>(iend - ip) || literal_len > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+        memcpy(op, ip, literal_len);
+        ip += literal_len;
+        op += literal_len;
+        if (ip == iend)
+        {
+            break; // 最后一个序列
+        }
+        if (iend - ip < 2)
+        {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst))
+        {
+            return false;
+        }
+        size_t match_len = token & 15;
+        if (match_len == 15 && !ReadLength(ip, iend, match_len))
+        {
+            return false;
+        }
+        match_len += kMinMatch;
+        if (match_len > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+        // 匹配可能与输出重叠(offset小于匹配长度)，逐字节复制
+        const uint8_t *match = op - offset;
+        for (size_t i = 0; i < match_len; ++i)
+        {
+            op[i] = match[i];
+        }
+        op += match_len;
+    }
+    return op == oend;
+}
@@ -1,5 +1,7 @@
 #include "connectionpool.h"
 #include "poolexecption.h"
+#include <cstddef>
+#include <cstring>
 
 /**
  * @brief 构造函数，实现初始化epoll和启动清理线程
@@ -40,13 +42,34 @@ ConnectionPool::~ConnectionPool()
     close(state_.epoll_fd);
 }
 
+// 已创建的单例
+static std::atomic<ConnectionPool *> existing_instance{nullptr};
+
 // 获取单例
 ConnectionPool &ConnectionPool::GetInstance()
 {
     static ConnectionPool pool;
+    static const bool published = (existing_instance.store(&pool, std::memory_order_release), true);
+    (void)published;
     return pool;
 }
 
+// 单例已创建时返回它，否则返回nullptr，用于只查看状态而不创建连接池的场合
+ConnectionPool *ConnectionPool::ExistingInstance()
+{
+    return existing_instance.load(std::memory_order_acquire);
+}
+
+// 占用情况，只读原子计数，不加锁
+ConnectionPool::Stats ConnectionPool::GetStats() const
+{
+    Stats stats;
+    stats.connections = state_.total_conn.load(std::memory_order_relaxed);
+    stats.max_connections = max_conn_;
+    stats.waiters = state_.waiters.load(std::memory_order_relaxed);
+    return stats;
+}
+
 /**
  * @brief 获取一个连接，如果超时则抛出异常
  * @param ep 端点信息，包括host+port
@@ -74,6 +97,7 @@ int ConnectionPool::Get(const Endpoint &ep, time_t timeout_ms)
         }
         // 关闭无效连接
         CloseFd(fd);
+        state_.total_conn.fetch_sub(1, std::memory_order_relaxed);
     }
 
     // 慢速路径：创建新连接
@@ -91,15 +115,16 @@ void ConnectionPool::Release(int fd, const Endpoint &ep) noexcept
     std::lock_guard lock(shard.mutex);
 
     // 如果空闲连接数小于最大空闲连接数，则放入空闲队列中，否则关闭连接
-    if (shard.idle_fds.size() < max_idle_per_shard_)
+    shard.active_count--;
+    if (shard.idle_fds.size() < max_idle_per_shard_ && Validate(fd))
     {
         shard.idle_fds.push(fd);
-        shard.active_count--;
         shard.last_active = Now();
     }
     else
     {
         CloseFd(fd);
+        state_.total_conn.fetch_sub(1, std::memory_order_relaxed);
     }
 
     // 唤醒等待的线程
@@ -109,6 +134,27 @@ void ConnectionPool::Release(int fd, const Endpoint &ep) noexcept
     }
 }
 
+/**
+ * @brief 丢弃一个已损坏的连接，关闭并归还连接配额
+ * @param fd 连接文件描述符
+ * @param ep 端点信息，包括host+port
+ */
+void ConnectionPool::Discard(int fd, const Endpoint &ep) noexcept
+{
+    auto &shard = GetShard(ep);
+    std::lock_guard lock(shard.mutex);
+
+    shard.active_count--;
+    CloseFd(fd);
+    state_.total_conn.fetch_sub(1, std::memory_order_relaxed);
+
+    // 唤醒等待的线程
+    if (state_.waiters > 0)
+    {
+        shard.cv.notify_one();
+    }
+}
+
 ConnectionPool::PoolShard &ConnectionPool::GetShard(const Endpoint &ep)
 {
     size_t idx = hash_fn_(ep) % shards_.size();
@@ -121,8 +167,14 @@ bool ConnectionPool::Validate(int fd) noexcept
     // 通过getsockopt检查socket状态
     int error = 0;
     socklen_t len = sizeof(error);
-    return getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) == 0 &&
-           error == 0;
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error != 0)
+    {
+        return false;
+    }
+    // 空闲长连接上不应有可读数据，可读说明对端已关闭(返回0)或残留了脏数据
+    char c;
+    ssize_t n = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
 }
 
 /**
@@ -186,17 +238,19 @@ int ConnectionPool::CreateNewConnection(const Endpoint &ep, PoolShard &shard,
 int ConnectionPool::ConnectWithTimeout(const Endpoint &ep, time_t timeout_ms)
 {
     // 创建socket
-    ScopedFd fd(socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+    const int domain = ep.transport == Transport::TCP ? AF_INET : AF_UNIX;
+    ScopedFd fd(socket(domain, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
     if (fd < 0)
     {
         throw ConnectionError(errno, "socket() failed");
     }
 
     // 根据ep构建地址结构体
-    sockaddr_in addr = BuildAddress(ep);
+    sockaddr_storage addr{};
+    socklen_t addr_len = BuildAddress(ep, &addr);
 
-    // 异步连接
-    int ret = connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    // 异步连接，Unix域套接字要么立即完成，要么因对端积压队列已满返回EAGAIN
+    int ret = connect(fd, reinterpret_cast<sockaddr *>(&addr), addr_len);
 
     // 立即连接成功
     if (ret == 0)
@@ -271,6 +325,7 @@ void ConnectionPool::CleanerTask()
                 {
                     shard.idle_fds.pop();
                     CloseFd(fd);
+                    state_.total_conn.fetch_sub(1, std::memory_order_relaxed);
                     cleaned++;
                 }
                 else
@@ -290,17 +345,28 @@ time_t ConnectionPool::Now() noexcept
         .count();
 }
 
-// 构建地址结构体
-sockaddr_in ConnectionPool::BuildAddress(const Endpoint &ep)
+// 构建地址结构体，返回地址长度
+socklen_t ConnectionPool::BuildAddress(const Endpoint &ep, sockaddr_storage *addr)
 {
-    sockaddr_in addr{};
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(ep.port);
-    if (inet_pton(AF_INET, ep.host.c_str(), &addr.sin_addr) <= 0)
+    if (ep.transport != Transport::TCP)
+    {
+        sockaddr_un *un = reinterpret_cast<sockaddr_un *>(addr);
+        if (ep.path.empty() || ep.path.size() >= sizeof(un->sun_path))
+        {
+            throw std::invalid_argument("Invalid unix socket path: " + ep.path);
+        }
+        un->sun_family = AF_UNIX;
+        memcpy(un->sun_path, ep.path.c_str(), ep.path.size() + 1);
+        return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + ep.path.size() + 1);
+    }
+    sockaddr_in *in = reinterpret_cast<sockaddr_in *>(addr);
+    in->sin_family = AF_INET;
+    in->sin_port = htons(ep.port);
+    if (inet_pton(AF_INET, ep.host.c_str(), &in->sin_addr) <= 0)
     {
         throw std::invalid_argument("Invalid address: " + ep.host);
     }
-    return addr;
+    return sizeof(sockaddr_in);
 }
 
 // 获取socket错误
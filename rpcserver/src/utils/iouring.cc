@@ -0,0 +1,327 @@
+#include "iouring.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#ifdef RPC_WITH_IO_URING
+
+// 共享队列的头尾指针与内核并发访问
+static inline unsigned LoadAcquire(const unsigned *p)
+{
+    return std::atomic_ref<const unsigned>(*p).load(std::memory_order_acquire);
+}
+
+static inline void StoreRelease(unsigned *p, unsigned v)
+{
+    std::atomic_ref<unsigned>(*p).store(v, std::memory_order_release);
+}
+
+// 内核是否支持本封装用到的全部特性(multishot recv需要6.0以上)，容器中io_uring可能被seccomp禁止
+bool IoUring::Supported()
+{
+    static const bool supported = []
+    {
+        utsname name;
+        int major = 0, minor = 0;
+        if (uname(&name) != 0 || sscanf(name.release, "%d.%d", &major, &minor) != 2 || major < 6)
+        {
+            return false;
+        }
+        IoUring probe;
+        return probe.Init(4) && probe.ext_arg_ && probe.SetupBufferRing(0, 1, 4096);
+    }();
+    return supported;
+}
+
+// 创建io_uring实例，entries为提交队列长度，失败返回false
+bool IoUring::Init(unsigned entries)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CLAMP;
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0)
+    {
+        return false;
+    }
+    // 只支持5.4以后提交队列和完成队列共用一次映射的内核
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP))
+    {
+        return false;
+    }
+    ext_arg_ = (params.features & IORING_FEAT_EXT_ARG) != 0;
+    sq_ring_size_ = std::max<size_t>(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                                     params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    void *ring = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+    if (ring == MAP_FAILED)
+    {
+        return false;
+    }
+    sq_ring_ = ring;
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        return false;
+    }
+    sqes_ = static_cast<io_uring_sqe *>(sqes);
+    char *base = static_cast<char *>(ring);
+    sq_head_ = reinterpret_cast<unsigned *>(base + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(base + params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+    cq_head_ = reinterpret_cast<unsigned *>(base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(base + params.cq_off.cqes);
+    // 提交项与索引数组一一对应，之后不再修改
+    unsigned *array = reinterpret_cast<unsigned *>(base + params.sq_off.array);
+    for (unsigned i = 0; i < sq_entries_; ++i)
+    {
+        array[i] = i;
+    }
+    sqe_tail_ = *sq_tail_;
+    return true;
+}
+
+IoUring::~IoUring()
+{
+    if (buf_ring_ != nullptr)
+    {
+        munmap(buf_ring_, buf_ring_size_);
+    }
+    if (sqes_ != nullptr)
+    {
+        munmap(sqes_, sqes_size_);
+    }
+    if (sq_ring_ != nullptr)
+    {
+        munmap(sq_ring_, sq_ring_size_);
+    }
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+/**
+ * @brief 注册提供给multishot recv的缓冲区环
+ * @param group 缓冲区组id
+ * @param count 缓冲区数量，必须是2的幂
+ * @param size 每个缓冲区的字节数
+ * @return 内核不支持或内存不足时返回false
+ */
+bool IoUring::SetupBufferRing(uint16_t group, unsigned count, unsigned size)
+{
+    if (count == 0 || (count & (count - 1)) != 0 || count > 32768)
+    {
+        return false;
+    }
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    buf_ring_size_ = (count * sizeof(io_uring_buf) + page - 1) / page * page;
+    void *ring = mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED)
+    {
+        return false;
+    }
+    buf_ring_ = ring;
+    io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = reinterpret_cast<uint64_t>(ring);
+    reg.ring_entries = count;
+    reg.bgid = group;
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        return false;
+    }
+    buf_count_ = count;
+    buffer_size_ = size;
+    buffers_.resize(static_cast<size_t>(count) * size);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        RecycleBuffer(static_cast<uint16_t>(i));
+    }
+    return true;
+}
+
+// 归还缓冲区，内核可以再次用它接收数据
+void IoUring::RecycleBuffer(uint16_t id)
+{
+    io_uring_buf_ring *ring = static_cast<io_uring_buf_ring *>(buf_ring_);
+    std::atomic_ref<__u16> tail(ring->tail);
+    const __u16 index = tail.load(std::memory_order_relaxed);
+    // C++中__DECLARE_FLEX_ARRAY展开的空结构体占一个字节，bufs的偏移与内核不一致，直接按数组访问
+    io_uring_buf *buf = static_cast<io_uring_buf *>(buf_ring_) + (index & (buf_count_ - 1));
+    buf->addr = reinterpret_cast<uint64_t>(Buffer(id));
+    buf->len = buffer_size_;
+    buf->bid = id;
+    tail.store(static_cast<__u16>(index + 1), std::memory_order_release);
+}
+
+// 取一个空闲的提交项，提交队列已满时先提交已有的提交项
+io_uring_sqe *IoUring::GetSqe()
+{
+    if (sqe_tail_ - LoadAcquire(sq_head_) >= sq_entries_)
+    {
+        Submit();
+        if (sqe_tail_ - LoadAcquire(sq_head_) >= sq_entries_)
+        {
+            return nullptr;
+        }
+    }
+    io_uring_sqe *sqe = &sqes_[sqe_tail_ & sq_mask_];
+    memset(sqe, 0, sizeof(*sqe));
+    ++sqe_tail_;
+    return sqe;
+}
+
+// 把提交项交给内核，返回提交的数量，失败返回-errno
+int IoUring::Submit()
+{
+    const unsigned to_submit = sqe_tail_ - *sq_tail_;
+    if (to_submit == 0)
+    {
+        return 0;
+    }
+    return Enter(to_submit, 0, -1);
+}
+
+// 提交并等待至少一个完成项，timeout_ms<0表示一直等待，超时或被信号中断时返回-errno
+int IoUring::SubmitAndWait(int timeout_ms)
+{
+    if (PeekCqe() != nullptr)
+    {
+        return Submit();
+    }
+    return Enter(sqe_tail_ - *sq_tail_, 1, timeout_ms);
+}
+
+int IoUring::Enter(unsigned to_submit, unsigned wait_nr, int timeout_ms)
+{
+    StoreRelease(sq_tail_, sqe_tail_);
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    io_uring_getevents_arg arg;
+    __kernel_timespec ts;
+    void *argp = nullptr;
+    size_t argsz = 0;
+    if (wait_nr > 0 && timeout_ms >= 0 && ext_arg_)
+    {
+        ts.tv_sec = timeout_ms / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+        memset(&arg, 0, sizeof(arg));
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = reinterpret_cast<uint64_t>(&ts);
+        argp = &arg;
+        argsz = sizeof(arg);
+        flags |= IORING_ENTER_EXT_ARG;
+    }
+    long ret = syscall(__NR_io_uring_enter, fd_, to_submit, wait_nr, flags, argp, argsz);
+    return ret < 0 ? -errno : static_cast<int>(ret);
+}
+
+// 取得下一个完成项，没有时返回nullptr
+io_uring_cqe *IoUring::PeekCqe()
+{
+    const unsigned head = *cq_head_;
+    if (head == LoadAcquire(cq_tail_))
+    {
+        return nullptr;
+    }
+    return &cqes_[head & cq_mask_];
+}
+
+// 消费一个完成项
+void IoUring::AdvanceCq()
+{
+    StoreRelease(cq_head_, *cq_head_ + 1);
+}
+
+// 准备multishot accept，每接收一个连接产生一个完成项，res为新连接的fd
+void IoUring::PrepMultishotAccept(io_uring_sqe *sqe, int fd, uint64_t user_data)
+{
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data = user_data;
+}
+
+// 准备multishot recv，每次收到数据产生一个完成项，数据在flags指明的缓冲区中
+void IoUring::PrepMultishotRecv(io_uring_sqe *sqe, int fd, uint16_t group, uint64_t user_data)
+{
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = group;
+    sqe->user_data = user_data;
+}
+
+// 准备取消user_data对应的请求
+void IoUring::PrepCancel(io_uring_sqe *sqe, uint64_t target, uint64_t user_data)
+{
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = target;
+    sqe->user_data = user_data;
+}
+
+// 完成项的结果，accept为新连接的fd，recv为接收的字节数，失败时为-errno
+int32_t IoUring::Result(const io_uring_cqe &cqe)
+{
+    return cqe.res;
+}
+
+// 完成项对应提交项的user_data
+uint64_t IoUring::UserData(const io_uring_cqe &cqe)
+{
+    return cqe.user_data;
+}
+
+// 完成项是否还会有后续(multishot未结束)
+bool IoUring::HasMore(const io_uring_cqe &cqe)
+{
+    return (cqe.flags & IORING_CQE_F_MORE) != 0;
+}
+
+// 完成项使用了提供缓冲区时返回true并输出缓冲区id
+bool IoUring::BufferId(const io_uring_cqe &cqe, uint16_t *id)
+{
+    if (!(cqe.flags & IORING_CQE_F_BUFFER))
+    {
+        return false;
+    }
+    *id = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+    return true;
+}
+
+#else
+
+// 内核头文件不支持时退回epoll
+bool IoUring::Supported() { return false; }
+bool IoUring::Init(unsigned) { return false; }
+IoUring::~IoUring() {}
+bool IoUring::SetupBufferRing(uint16_t, unsigned, unsigned) { return false; }
+void IoUring::RecycleBuffer(uint16_t) {}
+io_uring_sqe *IoUring::GetSqe() { return nullptr; }
+int IoUring::Submit() { return -ENOSYS; }
+int IoUring::SubmitAndWait(int) { return -ENOSYS; }
+io_uring_cqe *IoUring::PeekCqe() { return nullptr; }
+void IoUring::AdvanceCq() {}
+void IoUring::PrepMultishotAccept(io_uring_sqe *, int, uint64_t) {}
+void IoUring::PrepMultishotRecv(io_uring_sqe *, int, uint16_t, uint64_t) {}
+void IoUring::PrepCancel(io_uring_sqe *, uint64_t, uint64_t) {}
+int32_t IoUring::Result(const io_uring_cqe &) { return -ENOSYS; }
+uint64_t IoUring::UserData(const io_uring_cqe &) { return 0; }
+bool IoUring::HasMore(const io_uring_cqe &) { return false; }
+bool IoUring::BufferId(const io_uring_cqe &, uint16_t *) { return false; }
+
+#endif
@@ -0,0 +1,152 @@
+#include "methodmetrics.h"
+#include <algorithm>
+
+// 线程的分片编号，第一次记录时分配
+static std::atomic<size_t> next_thread_index{0};
+static thread_local size_t tls_shard = next_thread_index.fetch_add(1, std::memory_order_relaxed) % MethodMetrics::kShardCount;
+
+MethodMetrics::MethodMetrics()
+{
+    for (Shard &shard : shards_)
+    {
+        for (auto &bucket : shard.buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief 调用开始执行时调用
+ * @param request_bytes 请求消息体字节数
+ */
+void MethodMetrics::OnStart(size_t request_bytes)
+{
+    Shard &shard = LocalShard();
+    shard.started.fetch_add(1, std::memory_order_relaxed);
+    shard.request_bytes.fetch_add(request_bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 调用完成时调用，与OnStart可以在不同线程
+ * @param latency 从开始执行到完成的时间
+ * @param response_bytes 响应消息体字节数
+ * @param failed 调用是否失败
+ */
+void MethodMetrics::OnFinish(Clock::duration latency, size_t response_bytes, bool failed)
+{
+    const uint64_t latency_us = static_cast<uint64_t>(
+        std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count(), 0));
+    Shard &shard = LocalShard();
+    shard.finished.fetch_add(1, std::memory_order_relaxed);
+    if (failed)
+    {
+        shard.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    shard.response_bytes.fetch_add(response_bytes, std::memory_order_relaxed);
+    shard.latency_sum_us.fetch_add(latency_us, std::memory_order_relaxed);
+    shard.buckets[BucketIndex(latency_us)].fetch_add(1, std::memory_order_relaxed);
+    // 多数调用不刷新最大值，先读再比较交换
+    uint64_t max = shard.latency_max_us.load(std::memory_order_relaxed);
+    while (latency_us > max && !shard.latency_max_us.compare_exchange_weak(max, latency_us, std::memory_order_relaxed))
+    {
+    }
+}
+
+// 合并所有分片得到快照
+MethodMetrics::Snapshot MethodMetrics::Collect() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.assign(kBucketCount, 0);
+    uint64_t started = 0;
+    for (const Shard &shard : shards_)
+    {
+        started += shard.started.load(std::memory_order_relaxed);
+        snapshot.requests += shard.finished.load(std::memory_order_relaxed);
+        snapshot.errors += shard.errors.load(std::memory_order_relaxed);
+        snapshot.request_bytes += shard.request_bytes.load(std::memory_order_relaxed);
+        snapshot.response_bytes += shard.response_bytes.load(std::memory_order_relaxed);
+        snapshot.latency_sum_us += shard.latency_sum_us.load(std::memory_order_relaxed);
+        snapshot.latency_max_us = std::max(snapshot.latency_max_us, shard.latency_max_us.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < kBucketCount; ++i)
+        {
+            snapshot.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    // 开始和完成计在不同分片上，读取期间可能短暂出现完成数大于开始数
+    snapshot.inflight = started > snapshot.requests ? started - snapshot.requests : 0;
+    return snapshot;
+}
+
+// 微秒值所在的桶
+size_t MethodMetrics::BucketIndex(uint64_t value_us)
+{
+    if (value_us < kSubBucketCount)
+    {
+        return static_cast<size_t>(value_us);
+    }
+    const unsigned msb = 63 - static_cast<unsigned>(__builtin_clzll(value_us));
+    if (msb >= kMaxValueBits)
+    {
+        return kBucketCount - 1;
+    }
+    // 最高位之后的kSubBucketBits位决定区间内的桶
+    const unsigned shift = msb - kSubBucketBits;
+    return (shift + 1) * kSubBucketCount + static_cast<size_t>((value_us >> shift) - kSubBucketCount);
+}
+
+// 桶中最大的微秒值
+uint64_t MethodMetrics::BucketUpperBound(size_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+    const unsigned shift = static_cast<unsigned>(index / kSubBucketCount) - 1;
+    const uint64_t sub = kSubBucketCount + index % kSubBucketCount;
+    return ((sub + 1) << shift) - 1;
+}
+
+// 当前线程使用的分片
+MethodMetrics::Shard &MethodMetrics::LocalShard()
+{
+    return shards_[tls_shard];
+}
+
+// 时延的q分位数(0<q<=1)，取所在桶的上界，单位微秒，没有调用时返回0
+uint64_t MethodMetrics::Snapshot::Percentile(double q) const
+{
+    uint64_t total = 0;
+    for (uint64_t count : buckets)
+    {
+        total += count;
+    }
+    if (total == 0)
+    {
+        return 0;
+    }
+    // 第rank个样本所在的桶，rank从1开始
+    const uint64_t rank = std::max<uint64_t>(static_cast<uint64_t>(q * static_cast<double>(total) + 0.5), 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= rank)
+        {
+            // 桶的上界可能超过实际出现过的最大值
+            return std::min(BucketUpperBound(i), latency_max_us);
+        }
+    }
+    return latency_max_us;
+}
+
+// 平均时延，单位微秒
+double MethodMetrics::Snapshot::MeanLatencyUs() const
+{
+    uint64_t total = 0;
+    for (uint64_t count : buckets)
+    {
+        total += count;
+    }
+    return total == 0 ? 0.0 : static_cast<double>(latency_sum_us) / static_cast<double>(total);
+}
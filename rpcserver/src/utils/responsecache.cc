@@ -0,0 +1,133 @@
+#include "responsecache.h"
+#include <functional>
+
+// 每项除参数和响应外的固定开销估算
+static constexpr size_t kEntryOverhead = 128;
+
+/**
+ * @brief 构造函数
+ * @param capacity_bytes 缓存占用内存上限，按请求参数和响应的字节数估算，平均分给各分片
+ * @param shard_num 分片数，分片之间互不加锁
+ */
+ResponseCache::ResponseCache(size_t capacity_bytes, size_t shard_num)
+    : shard_capacity_(capacity_bytes / (shard_num > 0 ? shard_num : 1))
+{
+    if (shard_num == 0)
+    {
+        shard_num = 1;
+    }
+    for (size_t i = 0; i < shard_num; ++i)
+    {
+        shards_.emplace_back(std::make_unique<Shard>());
+    }
+}
+
+// 计算请求参数的哈希
+uint64_t ResponseCache::Hash(std::string_view params)
+{
+    return std::hash<std::string_view>()(params);
+}
+
+/**
+ * @brief 查找缓存的响应
+ * @param method_id 方法id
+ * @param hash 请求参数的哈希，由Hash计算
+ * @param params 请求参数，用于排除哈希冲突
+ * @return 命中时返回响应，未命中或已过期时返回空
+ */
+ResponseCache::ResponsePtr ResponseCache::Get(uint32_t method_id, uint64_t hash, std::string_view params)
+{
+    Shard &shard = GetShard(hash);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(Key{method_id, hash});
+        if (it != shard.index.end())
+        {
+            auto entry = it->second;
+            if (Clock::now() >= entry->expire_time)
+            {
+                Erase(shard, entry);
+            }
+            else if (entry->params == params)
+            {
+                // 移到链表头部
+                shard.lru.splice(shard.lru.begin(), shard.lru, entry);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return entry->response;
+            }
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+/**
+ * @brief 写入响应，超过分片内存上限时淘汰最久未使用的项
+ * @param method_id 方法id
+ * @param hash 请求参数的哈希
+ * @param params 请求参数
+ * @param response 序列化后的响应
+ * @param ttl 有效期
+ */
+void ResponseCache::Put(uint32_t method_id, uint64_t hash, std::string params, ResponsePtr response,
+                        std::chrono::milliseconds ttl)
+{
+    const size_t bytes = params.size() + response->size() + kEntryOverhead;
+    if (bytes > shard_capacity_)
+    {
+        return; // 单项超过分片容量，不缓存
+    }
+    const Key key{method_id, hash};
+    Shard &shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+        Erase(shard, it->second);
+    }
+    shard.lru.push_front(Entry{key, std::move(params), std::move(response), Clock::now() + ttl, bytes});
+    shard.index.emplace(key, shard.lru.begin());
+    shard.bytes += bytes;
+    while (shard.bytes > shard_capacity_)
+    {
+        Erase(shard, std::prev(shard.lru.end()));
+    }
+}
+
+// 缓存占用的字节数
+size_t ResponseCache::Bytes() const
+{
+    size_t bytes = 0;
+    for (auto &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        bytes += shard->bytes;
+    }
+    return bytes;
+}
+
+// 累计命中数
+uint64_t ResponseCache::HitCount() const
+{
+    return hits_.load(std::memory_order_relaxed);
+}
+
+// 累计未命中数
+uint64_t ResponseCache::MissCount() const
+{
+    return misses_.load(std::memory_order_relaxed);
+}
+
+ResponseCache::Shard &ResponseCache::GetShard(uint64_t hash)
+{
+    // 高位选分片，避免与分片内哈希表使用的低位相关
+    return *shards_[(hash >> 32) % shards_.size()];
+}
+
+// 删除一项，调用方持有分片锁
+void ResponseCache::Erase(Shard &shard, std::list<Entry>::iterator it)
+{
+    shard.bytes -= it->bytes;
+    shard.index.erase(it->key);
+    shard.lru.erase(it);
+}
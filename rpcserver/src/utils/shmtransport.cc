@@ -0,0 +1,318 @@
+#include "shmtransport.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 共享内存段格式标识和版本
+static constexpr uint32_t kShmMagic = 0x52504353; // "RPCS"
+static constexpr uint32_t kShmVersion = 1;
+// 单个方向字节环的大小范围
+static constexpr size_t kMinCapacity = 4096;
+static constexpr size_t kMaxCapacity = 64 * 1024 * 1024;
+// 随共享内存段一起传递的fd数量：memfd + 4个eventfd
+static constexpr int kPassedFds = 5;
+
+// 数据区的起始偏移，按缓存行对齐
+size_t ShmTransport::DataOffset()
+{
+    return (sizeof(SegmentHeader) + 63) / 64 * 64;
+}
+
+// 服务端：创建共享内存段和eventfd，capacity为每个方向字节环的大小，向上取整为2的幂，失败返回nullptr
+std::unique_ptr<ShmTransport> ShmTransport::Create(size_t capacity)
+{
+    size_t rounded = kMinCapacity;
+    while (rounded < capacity && rounded < kMaxCapacity)
+    {
+        rounded <<= 1;
+    }
+    std::unique_ptr<ShmTransport> transport(new ShmTransport());
+    transport->memfd_ = memfd_create("rpc-shm", MFD_CLOEXEC);
+    if (transport->memfd_ < 0)
+    {
+        return nullptr;
+    }
+    const size_t size = DataOffset() + 2 * rounded;
+    if (ftruncate(transport->memfd_, static_cast<off_t>(size)) != 0)
+    {
+        return nullptr;
+    }
+    for (int &fd : transport->eventfds_)
+    {
+        fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+    }
+    void *segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, transport->memfd_, 0);
+    if (segment == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    // 新建的memfd内容全为0，在其上构造头部
+    SegmentHeader *header = new (segment) SegmentHeader();
+    header->magic = kShmMagic;
+    header->version = kShmVersion;
+    header->capacity = rounded;
+    munmap(segment, size);
+    if (!transport->Map(transport->memfd_, size, true, transport->eventfds_))
+    {
+        return nullptr;
+    }
+    return transport;
+}
+
+/**
+ * @brief 客户端：从Unix域套接字接收服务端创建的共享内存段和eventfd
+ * @param sock 已连接的Unix域套接字
+ * @param timeout_ms 等待超时时间，单位毫秒
+ * @return 超时、对端关闭或共享内存段格式不符时返回nullptr
+ */
+std::unique_ptr<ShmTransport> ShmTransport::Receive(int sock, int timeout_ms)
+{
+    pollfd pfd{sock, POLLIN, 0};
+    int ret;
+    do
+    {
+        ret = poll(&pfd, 1, timeout_ms);
+    } while (ret < 0 && errno == EINTR);
+    if (ret <= 0)
+    {
+        return nullptr;
+    }
+    char byte = 0;
+    iovec iov{&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kPassedFds)];
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    ssize_t n;
+    do
+    {
+        n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+    } while (n < 0 && errno == EINTR);
+    cmsghdr *cmsg = n > 0 ? CMSG_FIRSTHDR(&msg) : nullptr;
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+    {
+        return nullptr;
+    }
+    // 先接管收到的fd，之后任何校验失败都由析构函数关闭
+    std::unique_ptr<ShmTransport> transport(new ShmTransport());
+    const size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    int fds[kPassedFds];
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * std::min<size_t>(count, kPassedFds));
+    if (count != kPassedFds || (msg.msg_flags & MSG_CTRUNC))
+    {
+        for (size_t i = 0; i < std::min<size_t>(count, kPassedFds); ++i)
+        {
+            close(fds[i]);
+        }
+        return nullptr;
+    }
+    transport->memfd_ = fds[0];
+    std::copy(fds + 1, fds + kPassedFds, transport->eventfds_);
+    struct stat st;
+    if (fstat(transport->memfd_, &st) != 0 || static_cast<size_t>(st.st_size) < DataOffset())
+    {
+        return nullptr;
+    }
+    if (!transport->Map(transport->memfd_, static_cast<size_t>(st.st_size), false, transport->eventfds_))
+    {
+        return nullptr;
+    }
+    return transport;
+}
+
+ShmTransport::~ShmTransport()
+{
+    if (segment_ != nullptr)
+    {
+        munmap(segment_, segment_size_);
+    }
+    for (int fd : eventfds_)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+    if (memfd_ >= 0)
+    {
+        close(memfd_);
+    }
+}
+
+// 服务端：把共享内存段和eventfd发给客户端，sock为刚接收的连接，发送缓冲区为空，不会阻塞
+bool ShmTransport::Send(int sock) const
+{
+    int fds[kPassedFds] = {memfd_, eventfds_[0], eventfds_[1], eventfds_[2], eventfds_[3]};
+    char byte = 'S';
+    iovec iov{&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))];
+    memset(control, 0, sizeof(control));
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    ssize_t n;
+    do
+    {
+        n = sendmsg(sock, &msg, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+    return n == 1;
+}
+
+/**
+ * @brief 写入尽量多的数据，不阻塞
+ * @return 写入的字节数，小于len时已登记等待，对端腾出空间后WritableFd()可读
+ */
+size_t ShmTransport::Write(const char *data, size_t len)
+{
+    RingControl *control = tx_.control;
+    const size_t mask = capacity_ - 1;
+    size_t written = 0;
+    while (true)
+    {
+        const uint64_t tail = control->tail.load(std::memory_order_relaxed);
+        const uint64_t head = control->head.load(std::memory_order_acquire);
+        const size_t used = std::min<uint64_t>(tail - head, capacity_);
+        const size_t n = std::min(len - written, capacity_ - used);
+        if (n > 0)
+        {
+            // 环形区域可能在末尾折返，分两段拷贝
+            const size_t offset = tail & mask;
+            const size_t first = std::min(n, capacity_ - offset);
+            memcpy(tx_.data + offset, data + written, first);
+            memcpy(tx_.data, data + written + first, n - first);
+            control->tail.store(tail + n, std::memory_order_release);
+            written += n;
+            // 与消费者登记等待构成Dekker式同步：先发布数据再检查标志，对方先登记再检查数据，至少一方能看到另一方
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (control->consumer_waiting.load(std::memory_order_relaxed) &&
+                control->consumer_waiting.exchange(0, std::memory_order_relaxed))
+            {
+                Notify(tx_.data_fd);
+            }
+        }
+        if (written == len)
+        {
+            return written;
+        }
+        // 环已满：登记等待后再检查一次，避免消费者在登记前已腾出空间而错过唤醒
+        control->producer_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (control->head.load(std::memory_order_acquire) == head)
+        {
+            return written;
+        }
+    }
+}
+
+/**
+ * @brief 读取尽量多的数据，不阻塞
+ * @return 读取的字节数，为0时已登记等待，对端写入后ReadableFd()可读
+ */
+size_t ShmTransport::Read(char *buf, size_t len)
+{
+    RingControl *control = rx_.control;
+    const size_t mask = capacity_ - 1;
+    while (true)
+    {
+        const uint64_t head = control->head.load(std::memory_order_relaxed);
+        const uint64_t tail = control->tail.load(std::memory_order_acquire);
+        // 对端写坏控制字段时也只在环内拷贝，不会越界
+        const size_t n = std::min<uint64_t>(std::min<uint64_t>(tail - head, capacity_), len);
+        if (n > 0)
+        {
+            const size_t offset = head & mask;
+            const size_t first = std::min(n, capacity_ - offset);
+            memcpy(buf, rx_.data + offset, first);
+            memcpy(buf + first, rx_.data, n - first);
+            control->head.store(head + n, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (control->producer_waiting.load(std::memory_order_relaxed) &&
+                control->producer_waiting.exchange(0, std::memory_order_relaxed))
+            {
+                Notify(rx_.space_fd);
+            }
+            return n;
+        }
+        // 环已空：登记等待后再检查一次，避免生产者在登记前已写入而错过唤醒
+        control->consumer_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (control->tail.load(std::memory_order_acquire) == tail)
+        {
+            return 0;
+        }
+    }
+}
+
+// 可读的字节数，不登记等待，用于在阻塞等待前短暂自旋
+size_t ShmTransport::Readable() const
+{
+    const uint64_t head = rx_.control->head.load(std::memory_order_relaxed);
+    const uint64_t tail = rx_.control->tail.load(std::memory_order_acquire);
+    return std::min<uint64_t>(tail - head, capacity_);
+}
+
+// 清除eventfd上的通知，之后再调用Read或Write
+void ShmTransport::ClearFd(int fd)
+{
+    uint64_t value;
+    while (read(fd, &value, sizeof(value)) < 0 && errno == EINTR)
+    {
+    }
+}
+
+// 通知等待在fd上的对端
+void ShmTransport::Notify(int fd)
+{
+    uint64_t one = 1;
+    while (write(fd, &one, sizeof(one)) < 0 && errno == EINTR)
+    {
+    }
+}
+
+// 映射共享内存段并按本端角色设置收发方向，is_server决定哪个环用于发送
+bool ShmTransport::Map(int memfd, size_t size, bool is_server, const int *eventfds)
+{
+    void *segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (segment == MAP_FAILED)
+    {
+        return false;
+    }
+    segment_ = segment;
+    segment_size_ = size;
+    SegmentHeader *header = static_cast<SegmentHeader *>(segment);
+    const uint64_t capacity = header->capacity;
+    if (header->magic != kShmMagic || header->version != kShmVersion ||
+        capacity < kMinCapacity || capacity > kMaxCapacity || (capacity & (capacity - 1)) != 0 ||
+        size != DataOffset() + 2 * capacity)
+    {
+        return false;
+    }
+    capacity_ = static_cast<size_t>(capacity);
+    char *data = static_cast<char *>(segment) + DataOffset();
+    // 环0为客户端到服务端，环1为服务端到客户端
+    Ring to_server{&header->rings[0], data, eventfds[0], eventfds[1]};
+    Ring to_client{&header->rings[1], data + capacity_, eventfds[2], eventfds[3]};
+    tx_ = is_server ? to_client : to_server;
+    rx_ = is_server ? to_server : to_client;
+    return true;
+}
@@ -0,0 +1,192 @@
+#include "workerpool.h"
+#include <algorithm>
+
+// 当前线程所属的线程池及其队列下标，工作线程提交的任务优先放入自己的队列
+static thread_local WorkerPool *tls_pool = nullptr;
+static thread_local size_t tls_index = 0;
+
+/**
+ * @brief 构造函数，启动工作线程
+ * @param thread_num 工作线程数
+ * @param queue_capacity 队列容量，所有待执行任务的总数上限
+ * @param work_stealing 是否开启工作窃取，开启后每个线程有独立队列，空闲时从其他队列窃取
+ * @param name 线程池名称，用于日志
+ */
+WorkerPool::WorkerPool(size_t thread_num, size_t queue_capacity, bool work_stealing, const std::string &name)
+    : capacity_(queue_capacity),
+      work_stealing_(work_stealing && thread_num > 1),
+      name_(name)
+{
+    if (thread_num == 0)
+    {
+        thread_num = 1;
+    }
+    size_t queue_num = work_stealing_ ? thread_num : 1;
+    for (size_t i = 0; i < queue_num; ++i)
+    {
+        queues_.emplace_back(std::make_unique<TaskQueue>());
+    }
+    for (size_t i = 0; i < thread_num; ++i)
+    {
+        threads_.emplace_back([this, i]
+                              { WorkerLoop(i); });
+    }
+}
+
+/**
+ * @brief 析构函数，停止并等待所有工作线程退出，未执行的任务被丢弃
+ */
+WorkerPool::~WorkerPool()
+{
+    Stop();
+}
+
+/**
+ * @brief 提交任务，不阻塞
+ * @param task 任务
+ * @param priority 优先级，0最高，超出范围时按最低优先级处理
+ * @return 队列已满或线程池已停止时返回false
+ */
+bool WorkerPool::Submit(Task &&task, size_t priority)
+{
+    priority = std::min(priority, kPriorityLevels - 1);
+    if (!running_.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    // 先占位再入队，保证总数不超过容量
+    if (size_.fetch_add(1, std::memory_order_acq_rel) >= capacity_)
+    {
+        size_.fetch_sub(1, std::memory_order_acq_rel);
+        return false;
+    }
+
+    size_t index = 0;
+    if (work_stealing_)
+    {
+        index = tls_pool == this ? tls_index
+                                 : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks[priority].push_back(std::move(task));
+        // 与PopTask中的减少同在队列锁内，取出任务前计数已增加，不会短暂下溢
+        level_size_[priority].fetch_add(1, std::memory_order_relaxed);
+    }
+    // 在等待锁内通知，避免工作线程检查size_后、进入等待前错过唤醒
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+    }
+    cv_.notify_one();
+    return true;
+}
+
+// 停止线程池
+void WorkerPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        if (!running_.exchange(false))
+        {
+            return;
+        }
+    }
+    cv_.notify_all();
+    for (auto &thread : threads_)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+// 待执行任务数
+size_t WorkerPool::QueueSize() const
+{
+    return size_.load(std::memory_order_relaxed);
+}
+
+// 指定优先级的待执行任务数
+size_t WorkerPool::QueueSize(size_t priority) const
+{
+    return priority < kPriorityLevels ? level_size_[priority].load(std::memory_order_relaxed) : 0;
+}
+
+// 工作线程数
+size_t WorkerPool::ThreadNum() const
+{
+    return threads_.size();
+}
+
+// 当前线程所属的线程池，不是工作线程时返回nullptr
+WorkerPool *WorkerPool::Current()
+{
+    return tls_pool;
+}
+
+// 工作线程
+void WorkerPool::WorkerLoop(size_t index)
+{
+    tls_pool = this;
+    tls_index = work_stealing_ ? index : 0;
+    Task task;
+    while (running_.load(std::memory_order_acquire))
+    {
+        if (PopTask(tls_index, task))
+        {
+            size_.fetch_sub(1, std::memory_order_acq_rel);
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        cv_.wait(lock, [this]
+                 { return size_.load(std::memory_order_acquire) > 0 || !running_.load(std::memory_order_acquire); });
+    }
+}
+
+// 从本线程队列头部按优先级取任务，取不到时从其他队列尾部窃取
+bool WorkerPool::PopTask(size_t index, Task &task)
+{
+    {
+        auto &queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        // 通常从最高优先级开始取；每kStarvationInterval次轮流从一个较低优先级开始，保证低优先级任务持续有进展
+        size_t start = 0;
+        if (++queue.pops % kStarvationInterval == 0)
+        {
+            start = 1 + (queue.pops / kStarvationInterval) % (kPriorityLevels - 1);
+        }
+        for (size_t i = 0; i < kPriorityLevels; ++i)
+        {
+            size_t level = (start + i) % kPriorityLevels;
+            if (!queue.tasks[level].empty())
+            {
+                task = std::move(queue.tasks[level].front());
+                queue.tasks[level].pop_front();
+                level_size_[level].fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        --queue.pops; // 没有取到任务，不计数
+    }
+    if (!work_stealing_)
+    {
+        return false;
+    }
+    for (size_t i = 1; i < queues_.size(); ++i)
+    {
+        auto &victim = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        for (size_t level = 0; level < kPriorityLevels; ++level)
+        {
+            if (!victim.tasks[level].empty())
+            {
+                task = std::move(victim.tasks[level].back());
+                victim.tasks[level].pop_back();
+                level_size_[level].fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -1,6 +1,6 @@
 #include "zookeeperutil.h"
 #include "rpcapplication.h"
-#include <semaphore.h>
+#include <cstring>
 #include "asynclogger.h"
 
 /**
@@ -8,18 +8,27 @@
  * @param zh ZooKeeper服务端句柄
  * @param type 回调的消息类型
  * @param state 回调的消息状态
- * @param watcherCtx 回调函数的参数
+ * @param watcherCtx 回调函数的参数，为所属的ZooKeeperClient
  */
 void GlobalWatcher(zhandle_t *zh, int type, int state, const char *path, void *watcherCtx)
 {
-	if (type == ZOO_SESSION_EVENT)
+	if (type != ZOO_SESSION_EVENT)
 	{
-		if (state == ZOO_CONNECTED_STATE) // ZooKeeper服务端和客户端连接成功
-		{
-			sem_t *sem = (sem_t *)zoo_get_context(zh);
-			sem_post(sem);
-		}
+		return;
+	}
+	ZooKeeperClient *client = static_cast<ZooKeeperClient *>(watcherCtx);
+	std::lock_guard<std::mutex> lock(client->state_mutex_);
+	if (state == ZOO_CONNECTED_STATE) // ZooKeeper服务端和客户端连接成功
+	{
+		client->connected_ = true;
 	}
+	else if (state == ZOO_EXPIRED_SESSION_STATE)
+	{
+		// 会话过期后句柄不能再使用，本会话的临时节点已被删除，交给后台线程重建
+		client->connected_ = false;
+		client->expired_ = true;
+	}
+	client->state_cv_.notify_all();
 }
 
 ZooKeeperClient::ZooKeeperClient()
@@ -27,37 +36,102 @@ ZooKeeperClient::ZooKeeperClient()
 
 ZooKeeperClient::~ZooKeeperClient()
 {
+	{
+		std::lock_guard<std::mutex> lock(state_mutex_);
+		stopping_ = true;
+	}
+	state_cv_.notify_all();
+	if (reconnect_thread_.joinable())
+	{
+		reconnect_thread_.join();
+	}
 	if (zhandle_ != nullptr)
 	{
 		zookeeper_close(zhandle_);
 	}
 }
 
-// 启动ZooKeeper客户端，连接ZooKeeper服务端
+// 启动ZooKeeper客户端，连接ZooKeeper服务端；会话过期后在后台线程中重新建立会话
 void ZooKeeperClient::Start()
+{
+	if (!Connect())
+	{
+		LOG_ERROR << "Failed to wait for ZooKeeper connection!";
+		exit(EXIT_FAILURE);
+	}
+	LOG_INFO << "ZooKeeper initial success!";
+	reconnect_thread_ = std::thread(&ZooKeeperClient::ReconnectLoop, this);
+}
+
+// 创建句柄并等待连接成功，stopping_时返回false
+bool ZooKeeperClient::Connect()
 {
 	std::string host = RpcApplication::GetInstance().GetConfig().Load("zookeeperip");
 	std::string port = RpcApplication::GetInstance().GetConfig().Load("zookeeperport");
 	std::string connstr = host + ":" + port;
 
-	zhandle_ = zookeeper_init(connstr.c_str(), GlobalWatcher, 30000, nullptr, nullptr, 0);
-	if (nullptr == zhandle_)
+	{
+		std::lock_guard<std::mutex> lock(state_mutex_);
+		connected_ = false;
+	}
+	zhandle_t *zhandle = zookeeper_init(connstr.c_str(), GlobalWatcher, 30000, nullptr, this, 0);
+	if (nullptr == zhandle)
 	{
 		LOG_ERROR << "ZooKeeper initial error!";
 		exit(EXIT_FAILURE);
 	}
-
-	sem_t sem;
-	sem_init(&sem, 0, 0);
-	zoo_set_context(zhandle_, &sem);
+	{
+		std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+		zhandle_ = zhandle;
+	}
 
 	// 等待连接成功
-	if (sem_wait(&sem) != 0)
+	std::unique_lock<std::mutex> lock(state_mutex_);
+	state_cv_.wait(lock, [this]
+				   { return connected_ || stopping_; });
+	return connected_;
+}
+
+// 后台线程：等待会话过期，关闭旧句柄后重新连接，再调用会话回调
+void ZooKeeperClient::ReconnectLoop()
+{
+	while (true)
 	{
-		LOG_ERROR << "Failed to wait for ZooKeeper connection!";
-		exit(EXIT_FAILURE);
+		{
+			std::unique_lock<std::mutex> lock(state_mutex_);
+			state_cv_.wait(lock, [this]
+						   { return expired_ || stopping_; });
+			if (stopping_)
+			{
+				return;
+			}
+			expired_ = false;
+		}
+		LOG_WARN << "ZooKeeper session expired, reconnecting";
+		{
+			// 等待正在使用旧句柄的操作结束，关闭时未完成的异步请求以ZCLOSING完成
+			std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+			zookeeper_close(zhandle_);
+			zhandle_ = nullptr;
+		}
+		if (!Connect())
+		{
+			return;
+		}
+		LOG_INFO << "ZooKeeper session re-established";
+		std::lock_guard<std::mutex> lock(callback_mutex_);
+		if (session_callback_)
+		{
+			session_callback_();
+		}
 	}
-	LOG_INFO << "ZooKeeper initial success!";
+}
+
+// 会话过期并重新建立后在后台线程中调用，用于重新创建临时节点；传入空函数取消，返回时已没有正在执行的回调
+void ZooKeeperClient::SetSessionCallback(std::function<void()> callback)
+{
+	std::lock_guard<std::mutex> lock(callback_mutex_);
+	session_callback_ = std::move(callback);
 }
 
 /**
@@ -68,6 +142,7 @@ void ZooKeeperClient::Start()
  */
 void ZooKeeperClient::Create(const std::string &path, std::string data, int state)
 {
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
 	char path_buffer[128];
 	int bufferlen = sizeof(path_buffer);
 	int flag;
@@ -98,6 +173,7 @@ void ZooKeeperClient::Create(const std::string &path, std::string data, int stat
 
 bool ZooKeeperClient::GetData(const std::string &path, std::string &data)
 {
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
 	char buffer[1024];
 	int buffer_len = sizeof(buffer);
 	struct Stat stat;
@@ -113,4 +189,160 @@ bool ZooKeeperClient::GetData(const std::string &path, std::string &data)
 	data.assign(buffer, buffer_len);
 
 	return true;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief 删除节点
+ * @param path 节点路径
+ * @param expected_data 期望的节点值，非空时只在节点的值与之相同时删除
+ * @return 节点已删除或不存在返回true
+ */
+bool ZooKeeperClient::Delete(const std::string &path, const std::string &expected_data)
+{
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
+	int version = -1;
+	if (!expected_data.empty())
+	{
+		char buffer[1024];
+		int buffer_len = sizeof(buffer);
+		struct Stat stat;
+		int rc = zoo_get(zhandle_, path.c_str(), 0, buffer, &buffer_len, &stat);
+		if (rc == ZNONODE)
+		{
+			return true;
+		}
+		if (rc != ZOK || std::string(buffer, buffer_len > 0 ? buffer_len : 0) != expected_data)
+		{
+			return false;
+		}
+		// 按读到的版本删除，期间节点被改写时删除失败
+		version = stat.version;
+	}
+	int rc = zoo_delete(zhandle_, path.c_str(), version);
+	if (rc == ZNOTEMPTY)
+	{
+		// 方法节点下还有其他实例注册的子节点，保留
+		return false;
+	}
+	if (rc != ZOK && rc != ZNONODE)
+	{
+		LOG_ERROR << "znode delete error... path:" << path << " flag:" << rc;
+		return false;
+	}
+	LOG_INFO << "znode delete success... path:" << path;
+	return true;
+}
+
+/**
+ * @brief 创建临时节点，会话结束后自动删除；同路径的节点(如上次运行留下、会话尚未过期的节点)先删除再创建
+ * @param path 节点路径
+ * @param data 节点的值
+ * @return 创建成功返回true
+ */
+bool ZooKeeperClient::CreateEphemeral(const std::string &path, const std::string &data)
+{
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+		int rc = zoo_create(zhandle_, path.c_str(), data.data(), static_cast<int>(data.size()),
+							&ZOO_OPEN_ACL_UNSAFE, ZOO_EPHEMERAL, nullptr, 0);
+		if (rc == ZOK)
+		{
+			LOG_INFO << "ephemeral znode create success... path:" << path;
+			return true;
+		}
+		if (rc != ZNODEEXISTS)
+		{
+			LOG_ERROR << "ephemeral znode create error... path:" << path << " flag:" << rc;
+			return false;
+		}
+		// 同一地址上次运行留下的节点，在其会话过期前删除
+		zoo_delete(zhandle_, path.c_str(), -1);
+	}
+	LOG_ERROR << "ephemeral znode create error... path:" << path << " exists";
+	return false;
+}
+
+/**
+ * @brief 只在临时节点属于本会话时删除，避免删掉重启后的新进程注册的同名节点
+ * @param path 节点路径
+ * @return 节点已删除、不存在或不属于本会话返回true
+ */
+bool ZooKeeperClient::DeleteOwned(const std::string &path)
+{
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
+	struct Stat stat;
+	int rc = zoo_exists(zhandle_, path.c_str(), 0, &stat);
+	if (rc == ZNONODE)
+	{
+		return true;
+	}
+	const clientid_t *client_id = zoo_client_id(zhandle_);
+	if (rc != ZOK || client_id == nullptr || stat.ephemeralOwner != client_id->client_id)
+	{
+		return rc == ZOK;
+	}
+	// 按读到的版本删除，期间节点被其他会话重建时删除失败
+	rc = zoo_delete(zhandle_, path.c_str(), stat.version);
+	if (rc != ZOK && rc != ZNONODE)
+	{
+		LOG_ERROR << "znode delete error... path:" << path << " flag:" << rc;
+		return false;
+	}
+	LOG_INFO << "znode delete success... path:" << path;
+	return true;
+}
+
+// 异步改写的完成回调，只记录失败
+static void SetDataCompletion(int rc, const struct Stat *, const void *data)
+{
+	if (rc != ZOK)
+	{
+		LOG_WARN << "znode set error... path:" << static_cast<const char *>(data) << " flag:" << rc;
+	}
+	delete[] static_cast<const char *>(data);
+}
+
+/**
+ * @brief 异步改写节点的值，不等待结果，失败时只记录日志
+ * @param path 节点路径
+ * @param data 节点的值
+ */
+void ZooKeeperClient::SetDataAsync(const std::string &path, const std::string &data)
+{
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
+	// 路径的副本交给完成回调用于记录日志并由它释放
+	char *path_copy = new char[path.size() + 1];
+	memcpy(path_copy, path.c_str(), path.size() + 1);
+	int rc = zoo_aset(zhandle_, path.c_str(), data.data(), static_cast<int>(data.size()), -1, SetDataCompletion, path_copy);
+	if (rc != ZOK)
+	{
+		LOG_WARN << "znode set error... path:" << path << " flag:" << rc;
+		delete[] path_copy;
+	}
+}
+
+/**
+ * @brief 获取子节点名称列表
+ * @param path 节点路径
+ * @param children 子节点名称
+ * @return 成功返回true，节点不存在或出错返回false
+ */
+bool ZooKeeperClient::GetChildren(const std::string &path, std::vector<std::string> &children)
+{
+	std::shared_lock<std::shared_mutex> handle_lock(handle_mutex_);
+	struct String_vector strings;
+	int rc = zoo_get_children(zhandle_, path.c_str(), 0, &strings);
+	if (rc != ZOK)
+	{
+		return false;
+	}
+	children.clear();
+	children.reserve(strings.count);
+	for (int32_t i = 0; i < strings.count; ++i)
+	{
+		children.emplace_back(strings.data[i]);
+	}
+	deallocate_String_vector(&strings);
+	return true;
+}